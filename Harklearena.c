@@ -0,0 +1,367 @@
+#include "Harklearena.h"
+#include "Harklecurse.h"
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harkleswarm.h"        // rando_distinct_coordinates(), rando_line_coordinates()
+#include <stdlib.h>             // calloc(), free()
+#include <string.h>             // memset()
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Add a new, empty, slab to an arena
+    INPUT
+        arena_ptr - Pointer to a shawarma arena
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This function does not perform input validation
+ */
+bool grow_shawarma_arena(hsArena_ptr arena_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;              // Set this to false if anything fails
+    hsArenaSlab_ptr newSlab = NULL;   // The new slab
+
+    // ALLOCATE
+    newSlab = calloc(1, sizeof(hsArenaSlab) + (arena_ptr->slabNodes * sizeof(shawarma)));
+
+    if (!newSlab)
+    {
+        HARKLE_ERROR(Harklearena, grow_shawarma_arena, calloc failed);
+        success = false;
+    }
+    else
+    {
+        newSlab->numNodes = arena_ptr->slabNodes;
+        newSlab->nextSlab = arena_ptr->headSlab;
+        arena_ptr->headSlab = newSlab;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Build a linked list of arena nodes from an array of coordinates
+    INPUT
+        arena_ptr - Pointer to a shawarma arena
+        coord_arr - Array of listLen coordinates
+        listLen - Number of nodes to build
+        shChar - The character to print for each node (If 0, will use the node's posNum member value)
+        shStatus - shStatus member value for each node
+    OUTPUT
+        On success, pointer to the head node of a linked list of listLen nodes numbered 1 through listLen
+        On failure, NULL (and any nodes already handed out are recycled)
+    NOTES
+        This function does not perform input validation
+ */
+shawarma_ptr arena_list_from_coords(hsArena_ptr arena_ptr, hsLineLen_ptr coord_arr, int listLen, char shChar,
+                                    unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;       // Store the head node to the new linked list here
+    shawarma_ptr tmp_ptr = NULL;      // Newly handed out node
+    shawarma_ptr tmpTail_ptr = NULL;  // Last node in the linked list
+    int i = 0;                        // Iterating variable
+
+    // ALLOCATE NODES
+    for (i = 1; i <= listLen; i++)
+    {
+        tmp_ptr = alloc_arena_shawarma(arena_ptr, coord_arr[i - 1].xCoord, coord_arr[i - 1].yCoord, i,
+                                       (0 == shChar) ? i + 48 : shChar, shStatus);
+
+        if (!tmp_ptr)
+        {
+            HARKLE_ERROR(Harklearena, arena_list_from_coords, alloc_arena_shawarma failed);
+
+            if (retVal)
+            {
+                recycle_arena_shawarma(arena_ptr, &retVal);
+            }
+            break;
+        }
+        else if (!retVal)
+        {
+            retVal = tmp_ptr;  // First node
+        }
+        else
+        {
+            tmpTail_ptr->nextPnt = tmp_ptr;  // Additional node
+        }
+        tmpTail_ptr = tmp_ptr;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsArena_ptr build_shawarma_arena(int slabNodes)
+{
+    // LOCAL VARIABLES
+    hsArena_ptr retVal = NULL;  // Arena to return
+
+    // INPUT VALIDATION
+    if (0 > slabNodes)
+    {
+        HARKLE_ERROR(Harklearena, build_shawarma_arena, Invalid slabNodes);
+    }
+    else
+    {
+        // ALLOCATE
+        retVal = calloc(1, sizeof(hsArena));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklearena, build_shawarma_arena, calloc failed);
+        }
+        else
+        {
+            retVal->slabNodes = (0 == slabNodes) ? HS_ARENA_DEFAULT_SLAB_NODES : slabNodes;
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+shawarma_ptr alloc_arena_shawarma(hsArena_ptr arena_ptr, int xVal, int yVal, int shNum, char shChar,
+                                  unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;  // Node to hand out
+
+    // INPUT VALIDATION
+    if (!arena_ptr)
+    {
+        HARKLE_ERROR(Harklearena, alloc_arena_shawarma, Invalid arena_ptr);
+    }
+    else
+    {
+        // 1. Reuse a recycled node
+        if (arena_ptr->freeList)
+        {
+            retVal = arena_ptr->freeList;
+            arena_ptr->freeList = retVal->nextPnt;
+        }
+        // 2. Carve a new node out of the newest slab
+        else if ((arena_ptr->headSlab && arena_ptr->headSlab->numUsed < arena_ptr->headSlab->numNodes)
+                 || true == grow_shawarma_arena(arena_ptr))
+        {
+            retVal = &(arena_ptr->headSlab->nodes[arena_ptr->headSlab->numUsed]);
+            arena_ptr->headSlab->numUsed++;
+        }
+        else
+        {
+            HARKLE_ERROR(Harklearena, alloc_arena_shawarma, grow_shawarma_arena failed);
+        }
+
+        // 3. Initialize it
+        if (retVal)
+        {
+            memset(retVal, 0x0, sizeof(shawarma));
+            retVal->absX = xVal;
+            retVal->absY = yVal;
+            retVal->posNum = shNum;
+            retVal->graphic = shChar;
+            retVal->hcFlags = shStatus;
+            arena_ptr->numLive++;
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool recycle_arena_shawarma(hsArena_ptr arena_ptr, shawarma_ptr *oldHeadNode_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;            // Set this to true if the nodes are recycled
+    shawarma_ptr tmpNode_ptr = NULL;  // Node being recycled
+    shawarma_ptr nextNode_ptr = NULL; // Next node to recycle
+
+    // INPUT VALIDATION
+    if (!arena_ptr)
+    {
+        HARKLE_ERROR(Harklearena, recycle_arena_shawarma, Invalid arena_ptr);
+    }
+    else if (!oldHeadNode_ptr || !(*oldHeadNode_ptr))
+    {
+        HARKLE_ERROR(Harklearena, recycle_arena_shawarma, Invalid oldHeadNode_ptr);
+    }
+    else
+    {
+        // RECYCLE
+        tmpNode_ptr = *oldHeadNode_ptr;
+
+        while (tmpNode_ptr)
+        {
+            nextNode_ptr = tmpNode_ptr->nextPnt;
+            tmpNode_ptr->nextPnt = arena_ptr->freeList;
+            arena_ptr->freeList = tmpNode_ptr;
+            arena_ptr->numLive--;
+            tmpNode_ptr = nextNode_ptr;
+        }
+
+        *oldHeadNode_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+shawarma_ptr create_arena_shawarma_list(hsArena_ptr arena_ptr, int xMin, int xMax, int yMin, int yMax,
+                                        int listLen, char shChar, unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;        // Store the head node to the new linked list here
+    hsLineLen_ptr coord_arr = NULL;    // Distinct coordinates for every node
+
+    // INPUT VALIDATION
+    if (!arena_ptr)
+    {
+        HARKLE_ERROR(Harklearena, create_arena_shawarma_list, Invalid arena_ptr);
+    }
+    else if (listLen < 1)
+    {
+        HARKLE_ERROR(Harklearena, create_arena_shawarma_list, Invalid list length);
+    }
+    else
+    {
+        // RANDOMIZE COORDINATES
+        coord_arr = calloc(listLen, sizeof(hsLineLen));
+
+        if (!coord_arr)
+        {
+            HARKLE_ERROR(Harklearena, create_arena_shawarma_list, calloc failed);
+        }
+        else if (false == rando_distinct_coordinates(xMin, xMax, yMin, yMax, listLen, coord_arr))
+        {
+            HARKLE_ERROR(Harklearena, create_arena_shawarma_list, rando_distinct_coordinates failed);
+        }
+        // ALLOCATE NODES
+        else
+        {
+            retVal = arena_list_from_coords(arena_ptr, coord_arr, listLen, shChar, shStatus);
+
+            if (!retVal)
+            {
+                HARKLE_ERROR(Harklearena, create_arena_shawarma_list, arena_list_from_coords failed);
+            }
+        }
+    }
+
+    // CLEAN UP
+    if (coord_arr)
+    {
+        free(coord_arr);
+        coord_arr = NULL;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+shawarma_ptr create_arena_shawarma_line(hsArena_ptr arena_ptr, int x0, int y0, int x1, int y1,
+                                        int listLen, char shChar, unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;        // Store the head node to the new linked list here
+    hsLineLen_ptr coord_arr = NULL;    // Distinct coordinates for every node
+
+    // INPUT VALIDATION
+    if (!arena_ptr)
+    {
+        HARKLE_ERROR(Harklearena, create_arena_shawarma_line, Invalid arena_ptr);
+    }
+    else if (listLen < 1)
+    {
+        HARKLE_ERROR(Harklearena, create_arena_shawarma_line, Invalid list length);
+    }
+    else
+    {
+        // RANDOMIZE COORDINATES
+        coord_arr = calloc(listLen, sizeof(hsLineLen));
+
+        if (!coord_arr)
+        {
+            HARKLE_ERROR(Harklearena, create_arena_shawarma_line, calloc failed);
+        }
+        else if (false == rando_line_coordinates(x0, y0, x1, y1, listLen, coord_arr))
+        {
+            HARKLE_ERROR(Harklearena, create_arena_shawarma_line, rando_line_coordinates failed);
+        }
+        // ALLOCATE NODES
+        else
+        {
+            retVal = arena_list_from_coords(arena_ptr, coord_arr, listLen, shChar, shStatus);
+
+            if (!retVal)
+            {
+                HARKLE_ERROR(Harklearena, create_arena_shawarma_line, arena_list_from_coords failed);
+            }
+        }
+    }
+
+    // CLEAN UP
+    if (coord_arr)
+    {
+        free(coord_arr);
+        coord_arr = NULL;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool free_shawarma_arena(hsArena_ptr *oldArena_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;             // Set this to true if the arena is freed
+    hsArena_ptr arena_ptr = NULL;     // Local copy of *oldArena_ptr
+    hsArenaSlab_ptr tmpSlab = NULL;   // Slab being freed
+
+    // INPUT VALIDATION
+    if (!oldArena_ptr || !(*oldArena_ptr))
+    {
+        HARKLE_ERROR(Harklearena, free_shawarma_arena, Invalid oldArena_ptr);
+    }
+    else
+    {
+        // FREE
+        arena_ptr = *oldArena_ptr;
+
+        while (arena_ptr->headSlab)
+        {
+            tmpSlab = arena_ptr->headSlab;
+            arena_ptr->headSlab = tmpSlab->nextSlab;
+            memset(tmpSlab, 0x0, sizeof(hsArenaSlab) + (tmpSlab->numNodes * sizeof(shawarma)));
+            free(tmpSlab);
+        }
+
+        memset(arena_ptr, 0x0, sizeof(hsArena));
+        free(arena_ptr);
+        *oldArena_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
@@ -0,0 +1,126 @@
+#ifndef __HARKLEARENA__
+#define __HARKLEARENA__
+
+#include "Harklecurse.h"        // struct hcCartesianCoordinate
+#include "Harkleswarm.h"        // shawarma, shawarma_ptr
+#include <stdbool.h>            // bool, true, false
+
+// Number of nodes per slab if the caller doesn't have a better guess
+#define HS_ARENA_DEFAULT_SLAB_NODES 1024
+
+// Defines the struct that holds one contiguous slab of shawarma nodes
+typedef struct hsArenaSlab
+{
+    struct hsArenaSlab *nextSlab;  // Previously allocated slab
+    int numNodes;                  // Number of nodes in this slab
+    int numUsed;                   // Number of nodes in this slab handed out at least once
+    shawarma nodes[];              // The nodes themselves
+} hsArenaSlab, *hsArenaSlab_ptr;
+
+// Defines the struct that hands out shawarma nodes from contiguous slabs
+//  Nodes are carved out of the newest slab in order.  Recycled nodes go on a free list (linked through
+//  nextPnt) and are handed out again before any new slab is allocated.  Every slab is released at once
+//  by free_shawarma_arena() so nodes are never freed individually.
+typedef struct hsShawarmaArena
+{
+    int slabNodes;                 // Number of nodes in each new slab
+    hsArenaSlab_ptr headSlab;      // Newest slab
+    shawarma_ptr freeList;         // Recycled nodes
+    long numLive;                  // Number of nodes handed out and not yet recycled
+} hsArena, *hsArena_ptr;
+
+
+/*
+    PURPOSE - Allocate an empty shawarma arena
+    INPUT
+        slabNodes - Number of nodes per slab (If 0, HS_ARENA_DEFAULT_SLAB_NODES is used)
+    OUTPUT
+        On success, pointer to a heap-allocated hsArena struct
+        On failure, NULL
+    NOTES
+        Slabs are only allocated as nodes are needed.  Size slabNodes to the swarm to get a single slab.
+        It is the caller's responsibility to free the memory with free_shawarma_arena()
+ */
+hsArena_ptr build_shawarma_arena(int slabNodes);
+
+
+/*
+    PURPOSE - Hand out one shawarma node from an arena
+    INPUT
+        arena_ptr - Pointer to a shawarma arena
+        xVal - Absolute, from the ncurse window's top left, x coordinate of this point
+        yVal - Absolute, from the ncurse window's top left, y coordinate of this point
+        shNum - Identifying number of this point
+        shChar - The character to print at coordinate (xVal, yVal)
+        shStatus - Initial value of the implementation-defined flags available for this point
+    OUTPUT
+        On success, pointer to a zeroized and initialized shawarma node
+        On failure, NULL
+    NOTES
+        This is the arena equivalent of build_new_shawarma_struct()
+        Never pass an arena node to free_shawarma_struct() or free_shawarma_linked_list()
+ */
+shawarma_ptr alloc_arena_shawarma(hsArena_ptr arena_ptr, int xVal, int yVal, int shNum, char shChar,
+                                  unsigned long shStatus);
+
+
+/*
+    PURPOSE - Return a linked list of shawarma nodes to the arena for reuse
+    INPUT
+        arena_ptr - Pointer to the shawarma arena the nodes came from
+        oldHeadNode_ptr - Pointer to the head node pointer of a linked list of arena nodes
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Pass a single node's pointer to recycle just that node, as long as its nextPnt is NULL
+        The memory is not freed.  *oldHeadNode_ptr is set to NULL.
+ */
+bool recycle_arena_shawarma(hsArena_ptr arena_ptr, shawarma_ptr *oldHeadNode_ptr);
+
+
+/*
+    PURPOSE - Allocate a linked list of randomly placed, uniquely located, shawarma nodes from an arena
+    INPUT
+        arena_ptr - Pointer to a shawarma arena
+        See: create_shawarma_list()
+    OUTPUT
+        On success, pointer to the head node of a linked list containing 'listLen' number of shawarma nodes
+        On failure, NULL
+    NOTES
+        This is the arena equivalent of create_shawarma_list()
+ */
+shawarma_ptr create_arena_shawarma_list(hsArena_ptr arena_ptr, int xMin, int xMax, int yMin, int yMax,
+                                        int listLen, char shChar, unsigned long shStatus);
+
+
+/*
+    PURPOSE - Allocate a linked list of shawarma nodes, randomly placed on a line segment, from an arena
+    INPUT
+        arena_ptr - Pointer to a shawarma arena
+        See: create_shawarma_line()
+    OUTPUT
+        On success, pointer to the head node of a linked list containing 'listLen' number of shawarma nodes
+        On failure, NULL
+    NOTES
+        This is the arena equivalent of create_shawarma_line()
+ */
+shawarma_ptr create_arena_shawarma_line(hsArena_ptr arena_ptr, int x0, int y0, int x1, int y1,
+                                        int listLen, char shChar, unsigned long shStatus);
+
+
+/*
+    PURPOSE - Free every slab of a shawarma arena, and the arena itself, at once
+    INPUT
+        oldArena_ptr - A pointer to a heap-allocated hsArena struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Every node handed out by the arena, recycled or not, is invalid afterwards
+        Call this function as free_shawarma_arena(&myArena_ptr);
+ */
+bool free_shawarma_arena(hsArena_ptr *oldArena_ptr);
+
+
+#endif  // __HARKLEARENA__
@@ -0,0 +1,913 @@
+#include "Harklecurse.h"        // winDetails
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harklemove.h"         // move_shawarma_bulk()
+#include "Harklescan.h"         // select_scan_kernel(), find_closest_store_points()
+#include "Harklestore.h"        // hsSwarm_ptr
+#include "Harkleswarm.h"
+#include "Harkletree.h"       // hsKDTree_ptr
+#include <getopt.h>             // getopt_long()
+#include <math.h>               // ceil(), sqrt()
+#include <stdio.h>              // printf()
+#include <stdbool.h>            // bool, true, false
+#include <stdlib.h>             // calloc(), free(), srand(), strtol(), strtod()
+#include <string.h>             // memset(), strstr()
+#include <time.h>               // clock_gettime()
+
+#define BENCH_DEFAULT_SEED 1            // Default srand() seed
+#define BENCH_DEFAULT_MIN_TIME 0.2      // Default number of seconds to time each benchmark for
+#define BENCH_DEFAULT_SPREAD 2          // Default number of field coordinates per point
+#define BENCH_DEFAULT_MAX_POINTS 1000000  // Default largest swarm size
+#define BENCH_MIN_POINTS 10             // Smallest swarm size
+#define BENCH_MAX_ITERATIONS 1000000000L  // Stop doubling the iteration count here
+
+// Defines the struct that holds everything a benchmark needs between iterations
+typedef struct hsBenchContext
+{
+    int numPnts;                    // Number of points in the swarm
+    int fieldLen;                   // Number of coordinates along one side of the field
+    winDetails fieldWin;            // Field window (no ncurses window, just the dimensions)
+    shawarma_ptr headNode_ptr;      // The swarm
+    shawarma_ptr cursor_ptr;        // Next point to operate on (cycles through the swarm)
+    int cursorIdx;                  // Linked list index of cursor_ptr (its k-d tree ID)
+    int *coord_arr;                 // Interleaved swarm coordinates, in linked list order
+    hsKDTree_ptr tree_ptr;          // k-d tree of the swarm
+    hsSwarm_ptr swarm_ptr;          // Swarm store of the swarm, in linked list order
+    int *dstX;                      // dstX[i] is the x coordinate point i is headed for (point i + 1's)
+    int *dstY;                      // dstY[i] is the y coordinate point i is headed for (point i + 1's)
+    int *newX;                      // Out parameter for move_shawarma_bulk()
+    int *newY;                      // Out parameter for move_shawarma_bulk()
+    int runX;                       // X component of the swarm's line direction
+    int riseY;                      // Y component of the swarm's line direction
+} hsBenchContext, *hsBenchContext_ptr;
+
+// Defines the struct that describes one benchmark
+typedef struct hsBenchmark
+{
+    const char *name;                           // Benchmark name, reported as name/numPnts
+    int maxPnts;                                // Largest swarm this benchmark runs at (many are O(n) per op)
+    bool diagonal;                              // If true, the swarm is a diagonal line.  Otherwise, it fills a square.
+    bool (*run_op)(hsBenchContext_ptr ctx_ptr); // One operation
+} hsBenchmark, *hsBenchmark_ptr;
+
+// Allocation counters, incremented by the --wrap'd allocators below (see: Makefile bench recipe)
+static long numAllocs = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+
+/*
+    PURPOSE - Count, then forward, every malloc() in the benchmark binary
+    NOTES
+        The Makefile links Harklebench.exe with -Wl,--wrap=malloc so every call to malloc(), including
+            the ones in Harkle_Library, lands here
+ */
+void *__wrap_malloc(size_t size);
+
+
+/*
+    PURPOSE - Count, then forward, every calloc() in the benchmark binary
+ */
+void *__wrap_calloc(size_t nmemb, size_t size);
+
+
+/*
+    PURPOSE - Count, then forward, every realloc() in the benchmark binary
+ */
+void *__wrap_realloc(void *ptr, size_t size);
+
+
+/*
+    PURPOSE - Build the swarm and field a benchmark operates on
+    INPUT
+        ctx_ptr - Pointer to a context to populate
+        numPnts - Number of points in the swarm
+        spread - Number of field coordinates per point
+        diagonal - If true, seed the swarm on a diagonal line.  Otherwise, seed it in a square field.
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+bool setup_bench_context(hsBenchContext_ptr ctx_ptr, int numPnts, int spread, bool diagonal);
+
+
+/*
+    PURPOSE - Free the swarm in a benchmark context
+    INPUT
+        ctx_ptr - Pointer to a context populated by setup_bench_context()
+ */
+void teardown_bench_context(hsBenchContext_ptr ctx_ptr);
+
+
+/*
+    PURPOSE - Run one benchmark at one swarm size and print the results
+    INPUT
+        bench_ptr - Benchmark to run
+        numPnts - Number of points in the swarm
+        spread - Number of field coordinates per point
+        seed - srand() seed used before the swarm is built
+        minTime - Minimum number of seconds to time the benchmark for
+        csv - If true, print a comma separated line instead of a table row
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Like Google Benchmark, the iteration count doubles until the timed loop takes at least minTime
+ */
+bool run_benchmark(hsBenchmark_ptr bench_ptr, int numPnts, int spread, unsigned int seed, double minTime, bool csv);
+
+
+/*
+    PURPOSE - Advance a context's cursor to the next point, wrapping to the head node
+ */
+void next_bench_point(hsBenchContext_ptr ctx_ptr);
+
+
+/*
+    PURPOSE - Find the closest points to a context's cursor with one scan kernel, then advance the cursor
+    INPUT
+        ctx_ptr - Pointer to a context populated by setup_bench_context()
+        kernel - HS_SCAN_KERNEL_* value
+        coord_arr - NULL-terminated array of hsLineLen struct pointers (see: find_closest_store_points())
+    OUTPUT
+        On success, true
+        On failure (e.g., the processor doesn't support the kernel), false
+ */
+bool bench_scan_points(hsBenchContext_ptr ctx_ptr, int kernel, hsLineLen_ptr *coord_arr);
+
+
+// BENCHMARK OPERATIONS
+bool bench_create_shawarma_list(hsBenchContext_ptr ctx_ptr);
+bool bench_find_closest_points(hsBenchContext_ptr ctx_ptr);
+bool bench_find_closest_points_2d(hsBenchContext_ptr ctx_ptr);
+bool bench_build_kd_tree(hsBenchContext_ptr ctx_ptr);
+bool bench_find_closest_tree_points(hsBenchContext_ptr ctx_ptr);
+bool bench_find_closest_tree_points_2d(hsBenchContext_ptr ctx_ptr);
+bool bench_move_kd_point(hsBenchContext_ptr ctx_ptr);
+bool bench_scan_scalar(hsBenchContext_ptr ctx_ptr);
+bool bench_scan_avx2(hsBenchContext_ptr ctx_ptr);
+bool bench_scan_scalar_2d(hsBenchContext_ptr ctx_ptr);
+bool bench_scan_avx2_2d(hsBenchContext_ptr ctx_ptr);
+bool bench_shwarm_it_point(hsBenchContext_ptr ctx_ptr);
+bool bench_shwarm_it_sweep(hsBenchContext_ptr ctx_ptr);
+bool bench_calculate_line_intercepts(hsBenchContext_ptr ctx_ptr);
+bool bench_move_shawarma(hsBenchContext_ptr ctx_ptr);
+bool bench_move_shawarma_swarm(hsBenchContext_ptr ctx_ptr);
+bool bench_move_shawarma_bulk_scalar(hsBenchContext_ptr ctx_ptr);
+bool bench_move_shawarma_bulk_avx2(hsBenchContext_ptr ctx_ptr);
+bool bench_verify_line(hsBenchContext_ptr ctx_ptr);
+
+
+/*
+    PURPOSE - Print usage
+    INPUT
+        progName - argv[0]
+ */
+void print_usage(char *progName);
+
+
+int main(int argc, char *argv[])
+{
+    // LOCAL VARIABLES
+    int retVal = 0;                                  // Program's return value
+    unsigned int seed = BENCH_DEFAULT_SEED;          // srand() seed
+    double minTime = BENCH_DEFAULT_MIN_TIME;         // Minimum seconds per benchmark
+    int spread = BENCH_DEFAULT_SPREAD;               // Field coordinates per point
+    int maxPnts = BENCH_DEFAULT_MAX_POINTS;          // Largest swarm size
+    char *filter = NULL;                             // Only run benchmarks whose name contains this
+    bool csv = false;                                // Print comma separated values
+    bool showHelp = false;                           // Print the usage and stop
+    int numPnts = 0;                                 // Current swarm size
+    int i = 0;                                       // Iterating variable
+    int opt = 0;                                     // Return value from getopt_long()
+    char *end_ptr = NULL;                            // strtol() and strtod() end pointer
+    struct option longOpts[] = {
+        { "filter", required_argument, NULL, 'f' },
+        { "seed", required_argument, NULL, 's' },
+        { "min-time", required_argument, NULL, 't' },
+        { "max-points", required_argument, NULL, 'p' },
+        { "spread", required_argument, NULL, 'S' },
+        { "csv", no_argument, NULL, 'c' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+    hsBenchmark bench_arr[] = {
+        { "create_shawarma_list", 1000000, false, bench_create_shawarma_list },
+        { "find_closest_points", 1000000, true, bench_find_closest_points },
+        { "find_closest_points/2d", 1000000, false, bench_find_closest_points_2d },
+        { "kd_tree/build", 1000000, false, bench_build_kd_tree },
+        { "kd_tree/find_closest_points", 1000000, true, bench_find_closest_tree_points },
+        { "kd_tree/find_closest_points/2d", 1000000, false, bench_find_closest_tree_points_2d },
+        { "kd_tree/move_kd_point", 1000000, false, bench_move_kd_point },
+        { "scan/scalar/find_closest_points", 1000000, true, bench_scan_scalar },
+        { "scan/avx2/find_closest_points", 1000000, true, bench_scan_avx2 },
+        { "scan/scalar/find_closest_points/2d", 1000000, false, bench_scan_scalar_2d },
+        { "scan/avx2/find_closest_points/2d", 1000000, false, bench_scan_avx2_2d },
+        { "shwarm_it/point", 100000, true, bench_shwarm_it_point },
+        { "shwarm_it/sweep", 10000, true, bench_shwarm_it_sweep },
+        { "calculate_line_intercepts", 1000000, true, bench_calculate_line_intercepts },
+        { "move_shawarma", 1000000, true, bench_move_shawarma },
+        { "move_shawarma/swarm", 1000000, false, bench_move_shawarma_swarm },
+        { "move_shawarma/bulk/scalar", 1000000, false, bench_move_shawarma_bulk_scalar },
+        { "move_shawarma/bulk/avx2", 1000000, false, bench_move_shawarma_bulk_avx2 },
+        { "verify_line", 1000000, true, bench_verify_line },
+        { NULL, 0, false, NULL }
+    };
+
+    // PARSE ARGUMENTS
+    while (0 == retVal && -1 != (opt = getopt_long(argc, argv, "f:s:t:p:S:ch", longOpts, NULL)))
+    {
+        switch (opt)
+        {
+            case 'f':
+                filter = optarg;
+                break;
+            case 's':
+                seed = (unsigned int)strtol(optarg, &end_ptr, 10);
+                retVal = ('\0' == *end_ptr) ? 0 : -1;
+                break;
+            case 't':
+                minTime = strtod(optarg, &end_ptr);
+                retVal = ('\0' == *end_ptr && minTime > 0) ? 0 : -1;
+                break;
+            case 'p':
+                maxPnts = (int)strtol(optarg, &end_ptr, 10);
+                retVal = ('\0' == *end_ptr && maxPnts >= BENCH_MIN_POINTS) ? 0 : -1;
+                break;
+            case 'S':
+                spread = (int)strtol(optarg, &end_ptr, 10);
+                retVal = ('\0' == *end_ptr && spread >= 1) ? 0 : -1;
+                break;
+            case 'c':
+                csv = true;
+                break;
+            case 'h':
+                showHelp = true;
+                break;
+            default:
+                retVal = -1;
+                break;
+        }
+    }
+    if (0 == retVal && optind != argc)
+    {
+        retVal = -1;
+    }
+
+    // RUN BENCHMARKS
+    if (0 != retVal || true == showHelp)
+    {
+        print_usage(argv[0]);
+    }
+    else
+    {
+        if (true == csv)
+        {
+            printf("benchmark,points,ns_per_op,iterations,allocs_per_op\n");
+        }
+        else
+        {
+            printf("%-40s %15s %12s %12s\n", "Benchmark", "Time", "Iterations", "Allocs/op");
+            printf("%.*s\n", 82, "------------------------------------------------------------------------------------");
+        }
+
+        for (i = 0; NULL != bench_arr[i].name && 0 == retVal; i++)
+        {
+            if (!filter || strstr(bench_arr[i].name, filter))
+            {
+                for (numPnts = BENCH_MIN_POINTS; numPnts <= maxPnts && numPnts <= bench_arr[i].maxPnts;
+                     numPnts *= 10)
+                {
+                    if (false == run_benchmark(&(bench_arr[i]), numPnts, spread, seed, minTime, csv))
+                    {
+                        HARKLE_ERROR(Harklebench, main, run_benchmark failed);
+                        retVal = -1;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+void *__wrap_malloc(size_t size)
+{
+    numAllocs++;
+    return __real_malloc(size);
+}
+
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+    numAllocs++;
+    return __real_calloc(nmemb, size);
+}
+
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    numAllocs++;
+    return __real_realloc(ptr, size);
+}
+
+
+bool setup_bench_context(hsBenchContext_ptr ctx_ptr, int numPnts, int spread, bool diagonal)
+{
+    // LOCAL VARIABLES
+    bool success = true;          // Set this to false if anything fails
+    shawarma_ptr tmp_ptr = NULL;  // Iterating variable
+    int i = 0;                    // Iterating variable
+
+    // SETUP
+    memset(ctx_ptr, 0x0, sizeof(hsBenchContext));
+    ctx_ptr->numPnts = numPnts;
+
+    if (true == diagonal)
+    {
+        ctx_ptr->fieldLen = numPnts * spread;
+    }
+    else
+    {
+        ctx_ptr->fieldLen = (int)ceil(sqrt((double)numPnts * spread));
+    }
+
+    // The field window's border lies just outside the swarm.  The window is two columns wider than it
+    //  is tall, and the diagonal is shifted right by one, so the line never passes through a corner.
+    ctx_ptr->fieldWin.win_ptr = NULL;
+    ctx_ptr->fieldWin.upperR = 0;
+    ctx_ptr->fieldWin.leftC = 0;
+    ctx_ptr->fieldWin.nRows = ctx_ptr->fieldLen + 2;
+    ctx_ptr->fieldWin.nCols = ctx_ptr->fieldLen + 4;
+
+    // BUILD THE SWARM
+    if (true == diagonal)
+    {
+        ctx_ptr->headNode_ptr = create_shawarma_line(2, 1, ctx_ptr->fieldLen + 1, ctx_ptr->fieldLen, numPnts, 'o', 0);
+        ctx_ptr->runX = 1;
+        ctx_ptr->riseY = 1;
+    }
+    else
+    {
+        ctx_ptr->headNode_ptr = create_shawarma_list(1, ctx_ptr->fieldLen, 1, ctx_ptr->fieldLen, numPnts, 'o', 0);
+    }
+
+    if (!(ctx_ptr->headNode_ptr))
+    {
+        HARKLE_ERROR(Harklebench, setup_bench_context, Failed to create the swarm);
+        success = false;
+    }
+    else
+    {
+        ctx_ptr->cursor_ptr = ctx_ptr->headNode_ptr;
+        ctx_ptr->cursorIdx = 0;
+    }
+
+    // INDEX THE SWARM
+    if (true == success)
+    {
+        ctx_ptr->coord_arr = calloc((size_t)numPnts * 2, sizeof(int));
+
+        if (!(ctx_ptr->coord_arr))
+        {
+            HARKLE_ERROR(Harklebench, setup_bench_context, calloc failed);
+            success = false;
+        }
+        else
+        {
+            for (tmp_ptr = ctx_ptr->headNode_ptr; tmp_ptr && i < numPnts; tmp_ptr = tmp_ptr->nextPnt)
+            {
+                ctx_ptr->coord_arr[i * 2] = tmp_ptr->absX;
+                ctx_ptr->coord_arr[(i * 2) + 1] = tmp_ptr->absY;
+                i++;
+            }
+
+            ctx_ptr->tree_ptr = build_kd_tree(2, i, ctx_ptr->coord_arr);
+
+            if (!(ctx_ptr->tree_ptr))
+            {
+                HARKLE_ERROR(Harklebench, setup_bench_context, build_kd_tree failed);
+                success = false;
+            }
+        }
+    }
+
+    // STORE THE SWARM
+    if (true == success)
+    {
+        ctx_ptr->swarm_ptr = swarm_from_shawarma_list(ctx_ptr->headNode_ptr);
+
+        if (!(ctx_ptr->swarm_ptr))
+        {
+            HARKLE_ERROR(Harklebench, setup_bench_context, swarm_from_shawarma_list failed);
+            success = false;
+        }
+    }
+
+    // AIM THE SWARM
+    if (true == success)
+    {
+        ctx_ptr->dstX = calloc(numPnts, sizeof(int));
+        ctx_ptr->dstY = calloc(numPnts, sizeof(int));
+        ctx_ptr->newX = calloc(numPnts, sizeof(int));
+        ctx_ptr->newY = calloc(numPnts, sizeof(int));
+
+        if (!(ctx_ptr->dstX) || !(ctx_ptr->dstY) || !(ctx_ptr->newX) || !(ctx_ptr->newY))
+        {
+            HARKLE_ERROR(Harklebench, setup_bench_context, calloc failed);
+            success = false;
+        }
+        else
+        {
+            for (i = 0; i < ctx_ptr->swarm_ptr->numPnts; i++)
+            {
+                ctx_ptr->dstX[i] = ctx_ptr->swarm_ptr->absX[(i + 1) % ctx_ptr->swarm_ptr->numPnts];
+                ctx_ptr->dstY[i] = ctx_ptr->swarm_ptr->absY[(i + 1) % ctx_ptr->swarm_ptr->numPnts];
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+void teardown_bench_context(hsBenchContext_ptr ctx_ptr)
+{
+    if (ctx_ptr->headNode_ptr)
+    {
+        free_shawarma_linked_list(&(ctx_ptr->headNode_ptr));
+    }
+    if (ctx_ptr->coord_arr)
+    {
+        free(ctx_ptr->coord_arr);
+    }
+    if (ctx_ptr->tree_ptr)
+    {
+        free_kd_tree(&(ctx_ptr->tree_ptr));
+    }
+    if (ctx_ptr->swarm_ptr)
+    {
+        free_swarm_store(&(ctx_ptr->swarm_ptr));
+    }
+    if (ctx_ptr->dstX)
+    {
+        free(ctx_ptr->dstX);
+    }
+    if (ctx_ptr->dstY)
+    {
+        free(ctx_ptr->dstY);
+    }
+    if (ctx_ptr->newX)
+    {
+        free(ctx_ptr->newX);
+    }
+    if (ctx_ptr->newY)
+    {
+        free(ctx_ptr->newY);
+    }
+    memset(ctx_ptr, 0x0, sizeof(hsBenchContext));
+
+    // DONE
+    return;
+}
+
+
+bool run_benchmark(hsBenchmark_ptr bench_ptr, int numPnts, int spread, unsigned int seed, double minTime, bool csv)
+{
+    // LOCAL VARIABLES
+    bool success = true;         // Set this to false if anything fails
+    hsBenchContext context;      // State shared between iterations
+    long numIters = 1;           // Number of iterations in the current timed loop
+    long i = 0;                  // Iterating variable
+    long startAllocs = 0;        // numAllocs before the timed loop
+    double elapsed = 0.0;        // Seconds spent in the timed loop
+    struct timespec startTime;   // Wall time before the timed loop
+    struct timespec stopTime;    // Wall time after the timed loop
+    char fullName[128] = { 0 };  // name/numPnts
+
+    // SETUP
+    srand(seed);
+    success = setup_bench_context(&context, numPnts, spread, bench_ptr->diagonal);
+
+    // TIME IT
+    while (true == success)
+    {
+        startAllocs = numAllocs;
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+        for (i = 0; i < numIters && true == success; i++)
+        {
+            success = bench_ptr->run_op(&context);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &stopTime);
+        elapsed = (stopTime.tv_sec - startTime.tv_sec) + ((stopTime.tv_nsec - startTime.tv_nsec) / 1e9);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklebench, run_benchmark, Benchmark operation failed);
+        }
+        else if (elapsed >= minTime || numIters >= BENCH_MAX_ITERATIONS)
+        {
+            break;  // Done
+        }
+        else
+        {
+            numIters *= 2;
+        }
+    }
+
+    // REPORT
+    if (true == success)
+    {
+        snprintf(fullName, sizeof(fullName), "%s/%d", bench_ptr->name, numPnts);
+
+        if (true == csv)
+        {
+            printf("%s,%d,%.1f,%ld,%.2f\n", bench_ptr->name, numPnts, elapsed * 1e9 / numIters, numIters,
+                   (double)(numAllocs - startAllocs) / numIters);
+        }
+        else
+        {
+            printf("%-40s %12.1f ns %12ld %12.2f\n", fullName, elapsed * 1e9 / numIters, numIters,
+                   (double)(numAllocs - startAllocs) / numIters);
+        }
+        fflush(stdout);
+    }
+
+    // CLEAN UP
+    teardown_bench_context(&context);
+
+    // DONE
+    return success;
+}
+
+
+void next_bench_point(hsBenchContext_ptr ctx_ptr)
+{
+    ctx_ptr->cursor_ptr = ctx_ptr->cursor_ptr->nextPnt;
+    ctx_ptr->cursorIdx++;
+
+    if (!(ctx_ptr->cursor_ptr))
+    {
+        ctx_ptr->cursor_ptr = ctx_ptr->headNode_ptr;
+        ctx_ptr->cursorIdx = 0;
+    }
+
+    // DONE
+    return;
+}
+
+
+bool bench_create_shawarma_list(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;              // Set this to true if the list is created and freed
+    shawarma_ptr headNode_ptr = NULL;  // New list
+
+    headNode_ptr = create_shawarma_list(1, ctx_ptr->fieldLen, 1, ctx_ptr->fieldLen, ctx_ptr->numPnts, 'o', 0);
+
+    if (headNode_ptr)
+    {
+        success = free_shawarma_linked_list(&headNode_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool bench_find_closest_points(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsLineLen point1 = { 0, 0, 0.0 };                      // Closest 'lower' point
+    hsLineLen point2 = { 0, 0, 0.0 };                      // Closest 'higher' point
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, NULL };  // One dimension
+    int numPoints = 0;                                     // Return value from find_closest_points()
+
+    numPoints = find_closest_points(&(ctx_ptr->fieldWin), ctx_ptr->headNode_ptr, ctx_ptr->cursor_ptr, coord_arr);
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return (0 > numPoints) ? false : true;
+}
+
+
+bool bench_find_closest_points_2d(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsLineLen point1 = { 0, 0, 0.0 };                                // Closest point
+    hsLineLen point2 = { 0, 0, 0.0 };                                // Second closest point
+    hsLineLen point3 = { 0, 0, 0.0 };                                // Third closest point
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, &point3, NULL };  // Two dimensions
+    int numPoints = 0;                                               // Return value from find_closest_points()
+
+    numPoints = find_closest_points(&(ctx_ptr->fieldWin), ctx_ptr->headNode_ptr, ctx_ptr->cursor_ptr, coord_arr);
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return (0 > numPoints) ? false : true;
+}
+
+
+bool bench_build_kd_tree(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;          // Set this to true if the tree is built and freed
+    hsKDTree_ptr tree_ptr = NULL;  // New tree
+
+    tree_ptr = build_kd_tree(2, ctx_ptr->numPnts, ctx_ptr->coord_arr);
+
+    if (tree_ptr)
+    {
+        success = free_kd_tree(&tree_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool bench_find_closest_tree_points(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsLineLen point1 = { 0, 0, 0.0 };                      // Closest 'lower' point
+    hsLineLen point2 = { 0, 0, 0.0 };                      // Closest 'higher' point
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, NULL };  // One dimension
+    int numPoints = 0;                                     // Return value from find_closest_tree_points()
+
+    numPoints = find_closest_tree_points(ctx_ptr->tree_ptr, ctx_ptr->cursorIdx, coord_arr);
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return (0 > numPoints) ? false : true;
+}
+
+
+bool bench_find_closest_tree_points_2d(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsLineLen point1 = { 0, 0, 0.0 };                                // Closest point
+    hsLineLen point2 = { 0, 0, 0.0 };                                // Second closest point
+    hsLineLen point3 = { 0, 0, 0.0 };                                // Third closest point
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, &point3, NULL };  // Two dimensions
+    int numPoints = 0;                                               // Return value from find_closest_tree_points()
+
+    numPoints = find_closest_tree_points(ctx_ptr->tree_ptr, ctx_ptr->cursorIdx, coord_arr);
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return (0 > numPoints) ? false : true;
+}
+
+
+bool bench_move_kd_point(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;                                            // Return value from move_kd_point()
+    int *coord_ptr = ctx_ptr->coord_arr + (ctx_ptr->cursorIdx * 2);  // The cursor's coordinates
+    int newCoord_arr[2] = { coord_ptr[0] + 1, coord_ptr[1] };        // One step to the right
+
+    // One step there and one step back so the tree never drifts
+    success = move_kd_point(ctx_ptr->tree_ptr, ctx_ptr->cursorIdx, newCoord_arr);
+
+    if (true == success)
+    {
+        success = move_kd_point(ctx_ptr->tree_ptr, ctx_ptr->cursorIdx, coord_ptr);
+    }
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return success;
+}
+
+
+bool bench_scan_points(hsBenchContext_ptr ctx_ptr, int kernel, hsLineLen_ptr *coord_arr)
+{
+    // LOCAL VARIABLES
+    int numPoints = -1;  // Return value from find_closest_store_points()
+
+    if (kernel == select_scan_kernel(kernel))
+    {
+        numPoints = find_closest_store_points(ctx_ptr->swarm_ptr, ctx_ptr->cursorIdx, coord_arr);
+    }
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return (0 > numPoints) ? false : true;
+}
+
+
+bool bench_scan_scalar(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsLineLen point1 = { 0, 0, 0.0 };                      // Closest 'lower' point
+    hsLineLen point2 = { 0, 0, 0.0 };                      // Closest 'higher' point
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, NULL };  // One dimension
+
+    // DONE
+    return bench_scan_points(ctx_ptr, HS_SCAN_KERNEL_SCALAR, coord_arr);
+}
+
+
+bool bench_scan_avx2(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsLineLen point1 = { 0, 0, 0.0 };                      // Closest 'lower' point
+    hsLineLen point2 = { 0, 0, 0.0 };                      // Closest 'higher' point
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, NULL };  // One dimension
+
+    // DONE
+    return bench_scan_points(ctx_ptr, HS_SCAN_KERNEL_AVX2, coord_arr);
+}
+
+
+bool bench_scan_scalar_2d(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsLineLen point1 = { 0, 0, 0.0 };                                // Closest point
+    hsLineLen point2 = { 0, 0, 0.0 };                                // Second closest point
+    hsLineLen point3 = { 0, 0, 0.0 };                                // Third closest point
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, &point3, NULL };  // Two dimensions
+
+    // DONE
+    return bench_scan_points(ctx_ptr, HS_SCAN_KERNEL_SCALAR, coord_arr);
+}
+
+
+bool bench_scan_avx2_2d(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsLineLen point1 = { 0, 0, 0.0 };                                // Closest point
+    hsLineLen point2 = { 0, 0, 0.0 };                                // Second closest point
+    hsLineLen point3 = { 0, 0, 0.0 };                                // Third closest point
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, &point3, NULL };  // Two dimensions
+
+    // DONE
+    return bench_scan_points(ctx_ptr, HS_SCAN_KERNEL_AVX2, coord_arr);
+}
+
+
+bool bench_shwarm_it_point(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    int numMoves = 0;  // Return value from shwarm_it()
+
+    numMoves = shwarm_it(&(ctx_ptr->fieldWin), ctx_ptr->headNode_ptr, HS_MAX_SWARM_MOVES,
+                         ctx_ptr->cursor_ptr->posNum, 1, true);
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return (0 > numMoves) ? false : true;
+}
+
+
+bool bench_shwarm_it_sweep(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if shwarm_it() fails
+    int i = 0;            // Iterating variable
+
+    for (i = 1; i <= ctx_ptr->numPnts && true == success; i++)
+    {
+        if (0 > shwarm_it(&(ctx_ptr->fieldWin), ctx_ptr->headNode_ptr, HS_MAX_SWARM_MOVES, i, 1, true))
+        {
+            success = false;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool bench_calculate_line_intercepts(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;     // Return value from calculate_line_intercepts()
+    shawarma intNode_arr[2];  // Two-node intercept 'linked list'
+
+    memset(intNode_arr, 0x0, sizeof(intNode_arr));
+    intNode_arr[0].nextPnt = &(intNode_arr[1]);
+    success = calculate_line_intercepts(&(ctx_ptr->fieldWin), ctx_ptr->cursor_ptr, intNode_arr, ctx_ptr->runX,
+                                        ctx_ptr->riseY);
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return success;
+}
+
+
+bool bench_move_shawarma(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    shawarma tmpNode = *(ctx_ptr->cursor_ptr);  // Move a copy so the swarm never changes
+    hsLineLen dstCoord = { 0, 0, 0.0 };         // Somewhere further along the line
+    int numMoves = 0;                           // Return value from move_shawarma()
+
+    dstCoord.xCoord = tmpNode.absX + HS_MAX_SWARM_MOVES;
+    dstCoord.yCoord = tmpNode.absY + HS_MAX_SWARM_MOVES;
+    numMoves = move_shawarma(&tmpNode, &dstCoord, HS_MAX_SWARM_MOVES);
+    next_bench_point(ctx_ptr);
+
+    // DONE
+    return (0 > numMoves) ? false : true;
+}
+
+
+bool bench_move_shawarma_swarm(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;                          // Set this to false if move_shawarma() fails
+    hsSwarm_ptr swarm_ptr = ctx_ptr->swarm_ptr;   // The swarm
+    shawarma tmpNode;                             // Move a copy so the swarm never changes
+    hsLineLen dstCoord = { 0, 0, 0.0 };           // Where tmpNode is headed
+    int i = 0;                                    // Iterating variable
+
+    memset(&tmpNode, 0x0, sizeof(tmpNode));
+
+    // Every point, one move_shawarma() at a time, for comparison with move_shawarma_bulk()
+    for (i = 0; i < swarm_ptr->numPnts && true == success; i++)
+    {
+        tmpNode.absX = swarm_ptr->absX[i];
+        tmpNode.absY = swarm_ptr->absY[i];
+        dstCoord.xCoord = ctx_ptr->dstX[i];
+        dstCoord.yCoord = ctx_ptr->dstY[i];
+
+        if (0 > move_shawarma(&tmpNode, &dstCoord, HS_MAX_SWARM_MOVES))
+        {
+            success = false;
+        }
+        else
+        {
+            ctx_ptr->newX[i] = tmpNode.absX;
+            ctx_ptr->newY[i] = tmpNode.absY;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool bench_move_shawarma_bulk_scalar(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsSwarm_ptr swarm_ptr = ctx_ptr->swarm_ptr;  // The swarm
+    long totMoves = -1;                          // Return value from move_shawarma_bulk()
+
+    if (HS_SCAN_KERNEL_SCALAR == select_scan_kernel(HS_SCAN_KERNEL_SCALAR))
+    {
+        totMoves = move_shawarma_bulk(swarm_ptr->absX, swarm_ptr->absY, ctx_ptr->dstX, ctx_ptr->dstY,
+                                      swarm_ptr->numPnts, HS_MAX_SWARM_MOVES, ctx_ptr->newX, ctx_ptr->newY, NULL);
+    }
+
+    // DONE
+    return (0 > totMoves) ? false : true;
+}
+
+
+bool bench_move_shawarma_bulk_avx2(hsBenchContext_ptr ctx_ptr)
+{
+    // LOCAL VARIABLES
+    hsSwarm_ptr swarm_ptr = ctx_ptr->swarm_ptr;  // The swarm
+    long totMoves = -1;                          // Return value from move_shawarma_bulk()
+
+    if (HS_SCAN_KERNEL_AVX2 == select_scan_kernel(HS_SCAN_KERNEL_AVX2))
+    {
+        totMoves = move_shawarma_bulk(swarm_ptr->absX, swarm_ptr->absY, ctx_ptr->dstX, ctx_ptr->dstY,
+                                      swarm_ptr->numPnts, HS_MAX_SWARM_MOVES, ctx_ptr->newX, ctx_ptr->newY, NULL);
+    }
+
+    // DONE
+    return (0 > totMoves) ? false : true;
+}
+
+
+bool bench_verify_line(hsBenchContext_ptr ctx_ptr)
+{
+    return verify_line(ctx_ptr->headNode_ptr);
+}
+
+
+void print_usage(char *progName)
+{
+    fprintf(stderr, "Usage: %s [OPTIONS]\n", progName);
+    fprintf(stderr, "\t-f, --filter NAME: only run benchmarks whose name contains NAME\n");
+    fprintf(stderr, "\t-s, --seed SEED: srand() seed used to build every swarm (default: %d)\n", BENCH_DEFAULT_SEED);
+    fprintf(stderr, "\t-t, --min-time SEC: minimum seconds to time each benchmark for (default: %.1f)\n",
+            BENCH_DEFAULT_MIN_TIME);
+    fprintf(stderr, "\t-p, --max-points N: largest swarm size, from %d in powers of 10 (default: %d)\n",
+            BENCH_MIN_POINTS, BENCH_DEFAULT_MAX_POINTS);
+    fprintf(stderr, "\t-S, --spread N: field coordinates per point (default: %d)\n", BENCH_DEFAULT_SPREAD);
+    fprintf(stderr, "\t-c, --csv: print comma separated values\n");
+    fprintf(stderr, "\t-h, --help: print this usage and exit\n");
+
+    // DONE
+    return;
+}
@@ -0,0 +1,1498 @@
+#include "Harklecurse.h"        // winDetails
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harkleline.h"         // hsLine_ptr, shwarm_line_sweep(), shwarm_solve_one_dim()
+#include "Harkleplane.h"        // hsPlane_ptr, shwarm_plane_sweep()
+#include "Harklepool.h"         // hsPool_ptr, build_worker_pool()
+#include "Harklequeue.h"        // hsDeltaQueue_ptr, push_delta_queue(), pop_delta_queue()
+#include "Harklescan.h"         // scan_closest_one_dim(), scan_closest_two_dim(), select_scan_kernel()
+#include "Harklesnap.h"         // map_swarm_snapshot(), verify_snapshot_swarm(), write_swarm_snapshot()
+#include "Harkletraj.h"         // open_trajectory_log(), open_trajectory_reader(), replay_trajectory_sweep()
+#include "Harklestore.h"        // hsSwarm_ptr, swarm_from_arrays(), swarm_from_shawarma_list()
+#include "Harkleswarm.h"        // create_shawarma_line(), create_shawarma_list(), shwarm_it(), verify_line()
+#include <getopt.h>             // getopt_long()
+#include <stdio.h>              // printf()
+#include <stdbool.h>            // bool, true, false
+#include <stddef.h>             // offsetof()
+#include <stdlib.h>             // calloc(), free(), srand()
+#include <string.h>             // memcmp(), memset(), strstr()
+#include <unistd.h>             // truncate()
+
+#define CHECK_MAX_SWEEPS 10000          // Give up on an engine reaching equilibrium after this many sweeps
+#define CHECK_LINE_Y 3                  // Row the horizontal test lines lie on
+#define CHECK_SLOPE_PNTS 12             // Number of points on the sloped test line
+#define CHECK_JACOBI_THREADS 4          // Number of threads the jacobi check sweeps with
+#define CHECK_QUEUE_CAPACITY 4          // Ring size of the delta queue check (tiny, so it fills)
+#define CHECK_QUEUE_PNTS 8              // Number of points the delta queue check moves
+#define CHECK_QUEUE_MOVES 2000          // Number of moves the delta queue check pushes
+#define CHECK_SNAP_FILE "Harklecheck.snap"  // Snapshot the snapshot check writes (and removes)
+#define CHECK_SNAP_ROWS 20              // Rows in the snapshot check's field
+#define CHECK_SNAP_COLS 40              // Columns in the snapshot check's field
+#define CHECK_SNAP_PNTS 100             // Number of points in the snapshot check's swarm
+#define CHECK_TRAJ_FILE "Harklecheck.traj"  // Trajectory log the trajectory check writes (and removes)
+#define CHECK_TRAJ_SWEEPS 40            // Most sweeps the trajectory check logs per case
+#define CHECK_SCAN_ORIGINS 200          // Number of origins the scan check searches from per case
+
+// Defines the struct that describes one regression check
+typedef struct hsCheck
+{
+    const char *name;                   // Check name
+    bool (*run_check)(void);            // The check (returns true if it passed)
+} hsCheck, *hsCheck_ptr;
+
+
+/*
+    PURPOSE - Build a swarm store of points on a horizontal line
+    INPUT
+        numPnts - Number of points
+        xCoords - numPnts x coordinates (every point is on row CHECK_LINE_Y)
+    OUTPUT
+        On success, pointer to a heap-allocated swarm store (posNums 1 through numPnts, in xCoords order)
+        On failure, NULL
+ */
+hsSwarm_ptr build_check_line(int numPnts, int *xCoords);
+
+/*
+    PURPOSE - Compare a swarm store's x coordinates against the expected ones
+    INPUT
+        checkName - Name of the check, to report a mismatch
+        swarm_ptr - Swarm store to compare
+        expectX - swarm_ptr->numPnts expected x coordinates, in swarm store order
+    OUTPUT
+        True if every coordinate matched, false otherwise (and the mismatch is printed)
+ */
+bool match_check_line(const char *checkName, hsSwarm_ptr swarm_ptr, int *expectX);
+
+/*
+    PURPOSE - Check shwarm_solve_one_dim() against the iterative line engine on small fields
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        The two only agree when the evenly spaced ideal is also an integer fixed point of the rounded
+            midpoint iteration.  Otherwise, they differ the way shwarm_solve_one_dim() documents and this
+            check pins both answers.
+ */
+bool check_solve_vs_line(void);
+
+/*
+    PURPOSE - Check that the list engine keeps points on a line that isn't horizontal, vertical or diagonal
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        Every point is checked after every sweep (see: verify_line()) and the list engine's equilibrium must
+            match the line engine's
+ */
+bool check_list_on_line(void);
+
+/*
+    PURPOSE - Check that the plane engine and the list engine make the same moves in two dimensions
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        Both engines are swarmed from the same start, for a few seeds and densities, and every point must be
+            in the same place after every sweep.  This only holds because both neighbour searches break ties
+            the same way (see: keep_closest_coordinate()).
+ */
+bool check_plane_vs_list2d(void);
+
+/*
+    PURPOSE - Check that the jacobi engine reaches an equilibrium wherever the line engine does
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        Both engines are swarmed from the same seeded diagonal, laid out like the headless one.  The jacobi
+            engine must settle within CHECK_MAX_SWEEPS sweeps (it used to livelock, with neighbours undoing
+            each other's moves) and a line sweep over its result must not move anything.
+ */
+bool check_jacobi_vs_line(void);
+
+/*
+    PURPOSE - Check that a coalescing delta queue delivers every point's moves, in order, through a full ring
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        The consumer pops far slower than the producer pushes so most deltas pass through the backlog.  Every
+            popped delta must start where the point's previous delta ended and, once the backlog is flushed,
+            the consumer must have every point where the producer left it without a single delta dropped.
+ */
+bool check_queue_coalesce(void);
+
+/*
+    PURPOSE - Write a swarm store to CHECK_SNAP_FILE as a CHECK_SNAP_ROWS x CHECK_SNAP_COLS field snapshot
+    INPUT
+        swarm_ptr - Swarm store to write
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+bool write_check_snapshot(hsSwarm_ptr swarm_ptr);
+
+/*
+    PURPOSE - Check that a snapshot maps back to exactly the swarm that was written and that corrupt ones are
+        rejected
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        A damaged header (magic, version, point count) or a truncated file must fail map_swarm_snapshot().  A
+            well-formed file holding a bad swarm (a point on the border, a repeated posNum or a repeated
+            coordinate) must map but fail verify_snapshot_swarm().  Both print why they rejected it.
+ */
+bool check_snapshot_round_trip(void);
+
+/*
+    PURPOSE - Build a plane engine over a seeded, scattered swarm
+    INPUT
+        seed - srand() seed to scatter the swarm with
+        nRows - Number of rows in the field
+        nCols - Number of columns in the field
+        numPnts - Number of points
+        swarm_ptr - [Out] The swarm store the engine sweeps
+    OUTPUT
+        On success, pointer to a heap-allocated plane engine (free it, then *swarm_ptr)
+        On failure, NULL (and *swarm_ptr is NULL)
+    NOTES
+        The same arguments always build the same swarm, in the same order
+ */
+hsPlane_ptr build_check_plane(unsigned int seed, int nRows, int nCols, int numPnts, hsSwarm_ptr *swarm_ptr);
+
+/*
+    PURPOSE - Check that replaying a trajectory log reproduces every sweep of the run that wrote it
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        Each case swarms a plane engine and logs every sweep.  The same swarm is then rebuilt and swept again
+            in lockstep with a reader: the keyframe and every replayed sweep must match the engine exactly and
+            the log must end right after the last sweep.  The larger case logs more than one writer buffer.
+ */
+bool check_trajectory_replay(void);
+
+/*
+    PURPOSE - Check that the dispatched scan kernel finds exactly what the scalar kernel finds
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        Random swarms, crowded enough for plenty of tied distances and sized so the last block is partial, are
+            scanned from random origins in one and two dimensions.  On a processor without AVX2 both kernels
+            are the scalar kernel and this check passes trivially.
+ */
+bool check_scan_kernels(void);
+
+/*
+    PURPOSE - Check that the bulk (Jacobi) plane sweep reaches an equilibrium and leaves a valid swarm
+    OUTPUT
+        True if it passed, false otherwise
+    NOTES
+        Points jump straight to their proposals so, for a few seeds and densities, the swarm must settle within
+            CHECK_MAX_SWEEPS sweeps, stay settled for another sweep and still hold every posNum exactly once,
+            inside the field, with no two points on one coordinate
+ */
+bool check_bulk_equilibrium(void);
+
+/*
+    PURPOSE - Print usage
+    INPUT
+        progName - argv[0]
+ */
+void print_usage(char *progName);
+
+
+int main(int argc, char *argv[])
+{
+    // LOCAL VARIABLES
+    int retVal = 0;                                  // Program's return value
+    char *filter = NULL;                             // Only run checks whose name contains this
+    bool showHelp = false;                           // Print the usage and stop
+    int numFailed = 0;                               // Number of checks that failed
+    int i = 0;                                       // Iterating variable
+    int opt = 0;                                     // Return value from getopt_long()
+    struct option longOpts[] = {
+        { "filter", required_argument, NULL, 'f' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+    hsCheck check_arr[] = {
+        { "solve_vs_line", check_solve_vs_line },
+        { "list_on_line", check_list_on_line },
+        { "plane_vs_list2d", check_plane_vs_list2d },
+        { "jacobi_vs_line", check_jacobi_vs_line },
+        { "queue_coalesce", check_queue_coalesce },
+        { "snapshot_round_trip", check_snapshot_round_trip },
+        { "trajectory_replay", check_trajectory_replay },
+        { "scan_kernels", check_scan_kernels },
+        { "bulk_equilibrium", check_bulk_equilibrium },
+        { NULL, NULL }
+    };
+
+    // PARSE ARGUMENTS
+    while (0 == retVal && -1 != (opt = getopt_long(argc, argv, "f:h", longOpts, NULL)))
+    {
+        switch (opt)
+        {
+            case 'f':
+                filter = optarg;
+                break;
+            case 'h':
+                showHelp = true;
+                break;
+            default:
+                retVal = -1;
+                break;
+        }
+    }
+    if (0 == retVal && optind != argc)
+    {
+        retVal = -1;
+    }
+
+    // RUN CHECKS
+    if (0 != retVal || true == showHelp)
+    {
+        print_usage(argv[0]);
+    }
+    else
+    {
+        for (i = 0; NULL != check_arr[i].name; i++)
+        {
+            if (!filter || strstr(check_arr[i].name, filter))
+            {
+                if (true == check_arr[i].run_check())
+                {
+                    printf("PASS  %s\n", check_arr[i].name);
+                }
+                else
+                {
+                    printf("FAIL  %s\n", check_arr[i].name);
+                    numFailed++;
+                }
+            }
+        }
+
+        if (0 < numFailed)
+        {
+            fprintf(stderr, "%d check(s) failed\n", numFailed);
+            retVal = -1;
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+hsSwarm_ptr build_check_line(int numPnts, int *xCoords)
+{
+    // LOCAL VARIABLES
+    hsSwarm_ptr retVal = NULL;  // Swarm store
+    int *yCoords = calloc(numPnts, sizeof(int));      // Every point's y coordinate
+    int *posNums = calloc(numPnts, sizeof(int));      // Every point's posNum
+    char *graphics = calloc(numPnts, sizeof(char));   // Every point's graphic
+    int i = 0;                                        // Iterating variable
+
+    if (!yCoords || !posNums || !graphics)
+    {
+        HARKLE_ERROR(Harklecheck, build_check_line, calloc failed);
+    }
+    else
+    {
+        for (i = 0; i < numPnts; i++)
+        {
+            yCoords[i] = CHECK_LINE_Y;
+            posNums[i] = i + 1;
+            graphics[i] = '*';
+        }
+
+        retVal = swarm_from_arrays(numPnts, xCoords, yCoords, posNums, graphics);
+    }
+
+    // CLEAN UP
+    if (yCoords)
+    {
+        free(yCoords);
+    }
+    if (posNums)
+    {
+        free(posNums);
+    }
+    if (graphics)
+    {
+        free(graphics);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool match_check_line(const char *checkName, hsSwarm_ptr swarm_ptr, int *expectX)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false on any mismatch
+    int i = 0;            // Iterating variable
+
+    for (i = 0; i < swarm_ptr->numPnts; i++)
+    {
+        if (expectX[i] != swarm_ptr->absX[i] || CHECK_LINE_Y != swarm_ptr->absY[i])
+        {
+            fprintf(stderr, "%s: point %d is at (%d, %d), expected (%d, %d)\n", checkName, swarm_ptr->posNum[i],
+                    swarm_ptr->absX[i], swarm_ptr->absY[i], expectX[i], CHECK_LINE_Y);
+            success = false;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool check_solve_vs_line(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;                        // Set this to false if anything fails
+    winDetails fieldWin = { NULL, 0, 0, 8, 23 };  // Intercepts at x = 0 and x = 22
+    // Ends 0 and 22: the ideal is 7.33 and 14.67 but 7 is not a rounded midpoint fixed point (7.5 rounds to 8)
+    int startA[] = { 3, 19 };
+    int solveA[] = { 7, 15 };
+    int lineA[] = { 8, 15 };
+    // Fixed ends 0 and 12, three interior points: the ideal is on the lattice so the two agree
+    int startB[] = { 0, 1, 2, 3, 12 };
+    int solveB[] = { 0, 3, 6, 9, 12 };
+    // Test cases
+    struct { int numPnts; int *start; int *solveX; int *lineX; long solveMoves; bool intercepts; } case_arr[] = {
+        { 2, startA, solveA, lineA, 8, true },
+        { 5, startB, solveB, solveB, 12, false },
+    };
+    hsSwarm_ptr swarm_ptr = NULL;               // Swarm store under test
+    hsLine_ptr line_ptr = NULL;                 // Line engine under test
+    long numMoves = 0;                          // Moves made by one call
+    int numSweeps = 0;                          // Sweeps the line engine made
+    int i = 0;                                  // Iterating variable
+    int engine = 0;                             // 0 for solve, 1 for line
+
+    for (i = 0; true == success && i < (int)(sizeof(case_arr) / sizeof(case_arr[0])); i++)
+    {
+        for (engine = 0; true == success && engine < 2; engine++)
+        {
+            swarm_ptr = build_check_line(case_arr[i].numPnts, case_arr[i].start);
+            line_ptr = swarm_ptr ? build_line_engine(swarm_ptr) : NULL;
+
+            if (!line_ptr)
+            {
+                HARKLE_ERROR(Harklecheck, check_solve_vs_line, Failed to build the line engine);
+                success = false;
+            }
+            else if (0 == engine)
+            {
+                numMoves = shwarm_solve_one_dim(&fieldWin, line_ptr, case_arr[i].intercepts, false);
+
+                if (case_arr[i].solveMoves != numMoves)
+                {
+                    fprintf(stderr, "solve_vs_line: case %d solved in %ld moves, expected %ld\n", i, numMoves,
+                            case_arr[i].solveMoves);
+                    success = false;
+                }
+                if (false == match_check_line("solve_vs_line/solve", swarm_ptr, case_arr[i].solveX))
+                {
+                    success = false;
+                }
+            }
+            else
+            {
+                numSweeps = 0;
+                do
+                {
+                    numMoves = shwarm_line_sweep(&fieldWin, line_ptr, HS_MAX_SWARM_MOVES, case_arr[i].intercepts);
+                    numSweeps++;
+                } while (0 < numMoves && numSweeps < CHECK_MAX_SWEEPS);
+
+                if (0 != numMoves)
+                {
+                    fprintf(stderr, "solve_vs_line: case %d never reached equilibrium\n", i);
+                    success = false;
+                }
+                else if (false == match_check_line("solve_vs_line/line", swarm_ptr, case_arr[i].lineX))
+                {
+                    success = false;
+                }
+            }
+
+            // CLEAN UP
+            if (line_ptr)
+            {
+                free_line_engine(&line_ptr);
+            }
+            if (swarm_ptr)
+            {
+                free_swarm_store(&swarm_ptr);
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool check_list_on_line(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;                            // Set this to false if anything fails
+    winDetails fieldWin = { NULL, 0, 0, 40, 80 };   // Slope 1/2 line, clear of the corners
+    shawarma_ptr headNode_ptr = NULL;               // List engine under test
+    shawarma_ptr tmpNode_ptr = NULL;                // Iterating node pointer
+    hsSwarm_ptr swarm_ptr = NULL;                   // Line engine's swarm store, from the same start
+    hsLine_ptr line_ptr = NULL;                     // Line engine to compare against
+    long numMoves = 0;                              // Moves made in one sweep
+    int tmpNumMoves = 0;                            // Moves made by one point
+    int numSweeps = 0;                              // Sweeps made
+    int index = 0;                                  // Swarm store index
+    int i = 0;                                      // Iterating variable
+
+    // SETUP
+    headNode_ptr = create_shawarma_line(1, 3, 71, 38, CHECK_SLOPE_PNTS, '*', 0);
+    swarm_ptr = headNode_ptr ? swarm_from_shawarma_list(headNode_ptr) : NULL;
+    line_ptr = swarm_ptr ? build_line_engine(swarm_ptr) : NULL;
+
+    if (!line_ptr)
+    {
+        HARKLE_ERROR(Harklecheck, check_list_on_line, Failed to build the engines);
+        success = false;
+    }
+
+    // SWARM THE LIST
+    do
+    {
+        numMoves = 0;
+
+        for (i = 1; true == success && i <= CHECK_SLOPE_PNTS; i++)
+        {
+            tmpNumMoves = shwarm_it(&fieldWin, headNode_ptr, HS_MAX_SWARM_MOVES, i, 1, true);
+
+            if (0 > tmpNumMoves)
+            {
+                HARKLE_ERROR(Harklecheck, check_list_on_line, shwarm_it failed);
+                success = false;
+            }
+            else if (false == verify_line(headNode_ptr))
+            {
+                fprintf(stderr, "list_on_line: point %d left the line on sweep %d\n", i, numSweeps + 1);
+                success = false;
+            }
+            else
+            {
+                numMoves += tmpNumMoves;
+            }
+        }
+        numSweeps++;
+    } while (true == success && 0 < numMoves && numSweeps < CHECK_MAX_SWEEPS);
+
+    if (true == success && 0 != numMoves)
+    {
+        fprintf(stderr, "list_on_line: the list engine never reached equilibrium\n");
+        success = false;
+    }
+
+    // SWARM THE LINE
+    if (true == success)
+    {
+        numSweeps = 0;
+        do
+        {
+            numMoves = shwarm_line_sweep(&fieldWin, line_ptr, HS_MAX_SWARM_MOVES, true);
+            numSweeps++;
+        } while (0 < numMoves && numSweeps < CHECK_MAX_SWEEPS);
+
+        if (0 != numMoves)
+        {
+            fprintf(stderr, "list_on_line: the line engine never reached equilibrium\n");
+            success = false;
+        }
+    }
+
+    // COMPARE
+    for (tmpNode_ptr = headNode_ptr; true == success && tmpNode_ptr; tmpNode_ptr = tmpNode_ptr->nextPnt)
+    {
+        index = get_swarm_index(swarm_ptr, tmpNode_ptr->posNum);
+
+        if (0 > index || tmpNode_ptr->absX != swarm_ptr->absX[index] || tmpNode_ptr->absY != swarm_ptr->absY[index])
+        {
+            fprintf(stderr, "list_on_line: point %d settled at (%d, %d) in the list engine but not the line engine\n",
+                    tmpNode_ptr->posNum, tmpNode_ptr->absX, tmpNode_ptr->absY);
+            success = false;
+        }
+    }
+
+    // CLEAN UP
+    if (line_ptr)
+    {
+        free_line_engine(&line_ptr);
+    }
+    if (swarm_ptr)
+    {
+        free_swarm_store(&swarm_ptr);
+    }
+    if (headNode_ptr)
+    {
+        free_shawarma_linked_list(&headNode_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool check_plane_vs_list2d(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;                // Set this to false if anything fails
+    winDetails fieldWin = { NULL, 0, 0, 0, 0 };  // Field, sized per case
+    // Test cases: seed, rows, columns and points (the last one is crowded enough for plenty of ties)
+    struct { unsigned int seed; int nRows; int nCols; int numPnts; } case_arr[] = {
+        { 1, 36, 76, 20 },
+        { 4, 36, 76, 50 },
+        { 2, 56, 192, 300 },
+        { 3, 12, 14, 60 },
+    };
+    shawarma_ptr headNode_ptr = NULL;   // List engine under test
+    shawarma_ptr tmpNode_ptr = NULL;    // Iterating node pointer
+    hsSwarm_ptr swarm_ptr = NULL;       // Plane engine's swarm store, from the same start
+    hsPlane_ptr plane_ptr = NULL;       // Plane engine under test
+    long listMoves = 0;                 // Moves the list engine made in one sweep
+    long planeMoves = 0;                // Moves the plane engine made in one sweep
+    int tmpNumMoves = 0;                // Moves made by one point
+    int numSweeps = 0;                  // Sweeps made
+    int index = 0;                      // Swarm store index
+    int i = 0;                          // Iterating variable
+    int j = 0;                          // Iterating variable
+
+    for (i = 0; true == success && i < (int)(sizeof(case_arr) / sizeof(case_arr[0])); i++)
+    {
+        // SETUP
+        fieldWin.nRows = case_arr[i].nRows;
+        fieldWin.nCols = case_arr[i].nCols;
+        srand(case_arr[i].seed);
+        headNode_ptr = create_shawarma_list(1, fieldWin.nCols - 2, 1, fieldWin.nRows - 2, case_arr[i].numPnts, 0, 0);
+        swarm_ptr = headNode_ptr ? swarm_from_shawarma_list(headNode_ptr) : NULL;
+        plane_ptr = swarm_ptr ? build_plane_engine(swarm_ptr, 0) : NULL;
+
+        if (!plane_ptr)
+        {
+            HARKLE_ERROR(Harklecheck, check_plane_vs_list2d, Failed to build the engines);
+            success = false;
+        }
+
+        // SWARM BOTH
+        numSweeps = 0;
+        do
+        {
+            listMoves = 0;
+
+            for (j = 1; true == success && j <= case_arr[i].numPnts; j++)
+            {
+                tmpNumMoves = shwarm_it(&fieldWin, headNode_ptr, HS_MAX_SWARM_MOVES, j, 2, true);
+
+                if (0 > tmpNumMoves)
+                {
+                    HARKLE_ERROR(Harklecheck, check_plane_vs_list2d, shwarm_it failed);
+                    success = false;
+                }
+                else
+                {
+                    listMoves += tmpNumMoves;
+                }
+            }
+            if (true == success)
+            {
+                planeMoves = shwarm_plane_sweep(&fieldWin, plane_ptr, HS_MAX_SWARM_MOVES, true);
+
+                if (0 > planeMoves)
+                {
+                    HARKLE_ERROR(Harklecheck, check_plane_vs_list2d, shwarm_plane_sweep failed);
+                    success = false;
+                }
+                else if (planeMoves != listMoves)
+                {
+                    fprintf(stderr, "plane_vs_list2d: seed %u sweep %d made %ld plane moves and %ld list moves\n",
+                            case_arr[i].seed, numSweeps + 1, planeMoves, listMoves);
+                    success = false;
+                }
+            }
+
+            // COMPARE
+            for (tmpNode_ptr = headNode_ptr; true == success && tmpNode_ptr; tmpNode_ptr = tmpNode_ptr->nextPnt)
+            {
+                index = get_swarm_index(swarm_ptr, tmpNode_ptr->posNum);
+
+                if (0 > index || tmpNode_ptr->absX != swarm_ptr->absX[index]
+                    || tmpNode_ptr->absY != swarm_ptr->absY[index])
+                {
+                    fprintf(stderr, "plane_vs_list2d: seed %u sweep %d left point %d at (%d, %d) in the list engine "
+                            "but not the plane engine\n", case_arr[i].seed, numSweeps + 1, tmpNode_ptr->posNum,
+                            tmpNode_ptr->absX, tmpNode_ptr->absY);
+                    success = false;
+                }
+            }
+            numSweeps++;
+        } while (true == success && 0 < listMoves && numSweeps < CHECK_MAX_SWEEPS);
+
+        // CLEAN UP
+        if (plane_ptr)
+        {
+            free_plane_engine(&plane_ptr);
+        }
+        if (swarm_ptr)
+        {
+            free_swarm_store(&swarm_ptr);
+        }
+        if (headNode_ptr)
+        {
+            free_shawarma_linked_list(&headNode_ptr);
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool check_jacobi_vs_line(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;                        // Set this to false if anything fails
+    winDetails fieldWin = { NULL, 2, 4, 0, 0 };  // Field, sized per case (offset like the headless field)
+    // Test cases: seed, rows, columns and points (the first two used to livelock)
+    struct { unsigned int seed; int nRows; int nCols; int numPnts; } case_arr[] = {
+        { 1, 76, 72, 10 },
+        { 1, 996, 992, 500 },
+        { 7, 36, 72, 30 },
+    };
+    shawarma_ptr headNode_ptr = NULL;           // Seeded diagonal
+    hsSwarm_ptr swarm_arr[2] = { NULL, NULL };  // Swarm stores for jacobi (0) and line (1)
+    hsLine_ptr line_arr[2] = { NULL, NULL };    // Line engines for jacobi (0) and line (1)
+    hsPool_ptr pool_ptr = NULL;                 // Worker threads for the jacobi engine
+    long numMoves = 0;                          // Moves made in one sweep
+    int numSweeps = 0;                          // Sweeps made
+    int lineLen = 0;                            // Number of diagonal coordinates in the field
+    int engine = 0;                             // 0 for jacobi, 1 for line
+    int i = 0;                                  // Iterating variable
+
+    pool_ptr = build_worker_pool(CHECK_JACOBI_THREADS);
+
+    if (!pool_ptr)
+    {
+        HARKLE_ERROR(Harklecheck, check_jacobi_vs_line, build_worker_pool failed);
+        success = false;
+    }
+
+    for (i = 0; true == success && i < (int)(sizeof(case_arr) / sizeof(case_arr[0])); i++)
+    {
+        // SETUP
+        fieldWin.nRows = case_arr[i].nRows;
+        fieldWin.nCols = case_arr[i].nCols;
+        lineLen = (fieldWin.nRows < fieldWin.nCols) ? fieldWin.nRows - 2 : fieldWin.nCols - 2;
+        srand(case_arr[i].seed);
+        headNode_ptr = create_shawarma_line(1, 1, lineLen, lineLen, case_arr[i].numPnts, 0, 0);
+
+        for (engine = 0; engine < 2; engine++)
+        {
+            swarm_arr[engine] = headNode_ptr ? swarm_from_shawarma_list(headNode_ptr) : NULL;
+            line_arr[engine] = swarm_arr[engine] ? build_line_engine(swarm_arr[engine]) : NULL;
+
+            if (!(line_arr[engine]))
+            {
+                HARKLE_ERROR(Harklecheck, check_jacobi_vs_line, Failed to build the engines);
+                success = false;
+            }
+        }
+
+        // SWARM BOTH
+        for (engine = 0; true == success && engine < 2; engine++)
+        {
+            numSweeps = 0;
+            do
+            {
+                numMoves = (0 == engine)
+                           ? shwarm_line_jacobi_sweep(&fieldWin, line_arr[0], pool_ptr, HS_MAX_SWARM_MOVES, true)
+                           : shwarm_line_sweep(&fieldWin, line_arr[1], HS_MAX_SWARM_MOVES, true);
+                numSweeps++;
+            } while (0 < numMoves && numSweeps < CHECK_MAX_SWEEPS);
+
+            if (0 != numMoves)
+            {
+                fprintf(stderr, "jacobi_vs_line: seed %u with %d points never settled in the %s engine\n",
+                        case_arr[i].seed, case_arr[i].numPnts, (0 == engine) ? "jacobi" : "line");
+                success = false;
+            }
+        }
+
+        // VERIFY THE EQUILIBRIUM
+        if (true == success)
+        {
+            // Reuse the line engine's slot for a line sweep over the jacobi engine's swarm
+            free_line_engine(&(line_arr[1]));
+            line_arr[1] = build_line_engine(swarm_arr[0]);
+
+            if (!(line_arr[1]))
+            {
+                HARKLE_ERROR(Harklecheck, check_jacobi_vs_line, build_line_engine failed);
+                success = false;
+            }
+            else if (0 != (numMoves = shwarm_line_sweep(&fieldWin, line_arr[1], HS_MAX_SWARM_MOVES, true)))
+            {
+                fprintf(stderr, "jacobi_vs_line: seed %u with %d points settled off equilibrium (%ld line moves)\n",
+                        case_arr[i].seed, case_arr[i].numPnts, numMoves);
+                success = false;
+            }
+        }
+
+        // CLEAN UP
+        for (engine = 0; engine < 2; engine++)
+        {
+            if (line_arr[engine])
+            {
+                free_line_engine(&(line_arr[engine]));
+            }
+            if (swarm_arr[engine])
+            {
+                free_swarm_store(&(swarm_arr[engine]));
+            }
+        }
+        if (headNode_ptr)
+        {
+            free_shawarma_linked_list(&headNode_ptr);
+        }
+    }
+
+    if (pool_ptr)
+    {
+        free_worker_pool(&pool_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool check_queue_coalesce(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;                        // Set this to false if anything fails
+    hsDeltaQueue_ptr queue_ptr = NULL;          // Delta queue with a tiny ring
+    hsDelta delta_arr[CHECK_QUEUE_PNTS];        // Popped deltas
+    int prodX[CHECK_QUEUE_PNTS] = { 0 };        // Producer's x coordinate of each point
+    int prodY[CHECK_QUEUE_PNTS] = { 0 };        // Producer's y coordinate of each point
+    int consX[CHECK_QUEUE_PNTS] = { 0 };        // Consumer's x coordinate of each point
+    int consY[CHECK_QUEUE_PNTS] = { 0 };        // Consumer's y coordinate of each point
+    int numPending = 0;                         // Number of points still in the backlog
+    int numPopped = 0;                          // Number of deltas popped in one call
+    int posNum = 0;                             // Point to move
+    int oldX = 0;                               // X coordinate the point left
+    int oldY = 0;                               // Y coordinate the point left
+    int i = 0;                                  // Iterating variable
+    int j = 0;                                  // Iterating variable
+
+    // SETUP
+    queue_ptr = build_delta_queue(CHECK_QUEUE_CAPACITY, CHECK_QUEUE_PNTS - 1, HS_QUEUE_COALESCE);
+
+    if (!queue_ptr)
+    {
+        HARKLE_ERROR(Harklecheck, check_queue_coalesce, build_delta_queue failed);
+        success = false;
+    }
+
+    for (i = 0; i < CHECK_QUEUE_PNTS; i++)
+    {
+        prodX[i] = consX[i] = i;
+    }
+
+    // PUSH AND POP
+    srand(1);
+
+    for (i = 0; true == success && (i <= CHECK_QUEUE_MOVES || 0 < numPending || 0 < numPopped); i++)
+    {
+        // Push a random one-cell move
+        if (i < CHECK_QUEUE_MOVES)
+        {
+            posNum = rand() % CHECK_QUEUE_PNTS;
+            oldX = prodX[posNum];
+            oldY = prodY[posNum];
+            prodX[posNum] += (rand() % 3) - 1;
+            prodY[posNum] += (rand() % 3) - 1;
+
+            if (false == push_delta_queue(queue_ptr, posNum, oldX, oldY, prodX[posNum], prodY[posNum]))
+            {
+                HARKLE_ERROR(Harklecheck, check_queue_coalesce, push_delta_queue failed);
+                success = false;
+            }
+        }
+        else if (0 > (numPending = flush_delta_queue(queue_ptr)))
+        {
+            HARKLE_ERROR(Harklecheck, check_queue_coalesce, flush_delta_queue failed);
+            success = false;
+        }
+
+        // Pop a couple of deltas every few pushes (and everything, once the pushing is done)
+        numPopped = 0;
+
+        if (true == success && (i >= CHECK_QUEUE_MOVES || 4 == i % 5))
+        {
+            numPopped = pop_delta_queue(queue_ptr, delta_arr, (i < CHECK_QUEUE_MOVES) ? 2 : CHECK_QUEUE_PNTS);
+
+            if (0 > numPopped)
+            {
+                HARKLE_ERROR(Harklecheck, check_queue_coalesce, pop_delta_queue failed);
+                success = false;
+            }
+        }
+
+        for (j = 0; true == success && j < numPopped; j++)
+        {
+            posNum = delta_arr[j].posNum;
+
+            if (0 > posNum || CHECK_QUEUE_PNTS <= posNum
+                || consX[posNum] != delta_arr[j].oldX || consY[posNum] != delta_arr[j].oldY)
+            {
+                fprintf(stderr, "queue_coalesce: delta %d of point %d does not start where the last one ended\n",
+                        i, posNum);
+                success = false;
+            }
+            else
+            {
+                consX[posNum] = delta_arr[j].newX;
+                consY[posNum] = delta_arr[j].newY;
+            }
+        }
+    }
+
+    // VERIFY
+    for (i = 0; true == success && i < CHECK_QUEUE_PNTS; i++)
+    {
+        if (consX[i] != prodX[i] || consY[i] != prodY[i])
+        {
+            fprintf(stderr, "queue_coalesce: point %d ended at (%d, %d) instead of (%d, %d)\n",
+                    i, consX[i], consY[i], prodX[i], prodY[i]);
+            success = false;
+        }
+    }
+
+    if (true == success && (0 != queue_ptr->numDropped || 0 == queue_ptr->numMerged))
+    {
+        fprintf(stderr, "queue_coalesce: %ld deltas dropped and %ld merged (expected none and some)\n",
+                (long)queue_ptr->numDropped, (long)queue_ptr->numMerged);
+        success = false;
+    }
+
+    // CLEAN UP
+    if (queue_ptr)
+    {
+        free_delta_queue(&queue_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool write_check_snapshot(hsSwarm_ptr swarm_ptr)
+{
+    // LOCAL VARIABLES
+    hsSnapHeader header;  // Describes the (made up) run
+
+    memset(&header, 0x0, sizeof(header));
+    header.numDims = 2;
+    header.numRows = CHECK_SNAP_ROWS;
+    header.numCols = CHECK_SNAP_COLS;
+    header.numPnts = swarm_ptr->numPnts;
+    header.numSweeps = 12;
+    header.totMoves = 345;
+    header.rngSeed = 3;
+
+    // DONE
+    return write_swarm_snapshot(CHECK_SNAP_FILE, &header, swarm_ptr->posNum, swarm_ptr->absX, swarm_ptr->absY,
+                                NULL, swarm_ptr->graphic);
+}
+
+
+bool check_snapshot_round_trip(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;               // Set this to false if anything fails
+    shawarma_ptr headNode_ptr = NULL;  // Scattered swarm
+    hsSwarm_ptr swarm_ptr = NULL;      // Swarm store to snapshot
+    hsSnapshot_ptr snap_ptr = NULL;    // Mapped snapshot
+    FILE *snapFile = NULL;             // Snapshot opened to damage its header
+    size_t numBytes = 0;               // Size of each int array
+    size_t snapSize = 0;               // Size of a good snapshot file
+    int maxX = CHECK_SNAP_COLS - 2;    // Largest x coordinate inside the field
+    int maxY = CHECK_SNAP_ROWS - 2;    // Largest y coordinate inside the field
+    int tmpX = 0;                      // Original x coordinate of a damaged point
+    int tmpY = 0;                      // Original y coordinate of a damaged point
+    int tmpPosNum = 0;                 // Original posNum of a damaged point
+    int i = 0;                         // Iterating variable
+    // Header damage: offset of the byte to overwrite (or -1 to truncate the file) and its new value
+    struct { const char *what; long offset; int byteVal; } header_arr[] = {
+        { "magic", offsetof(hsSnapHeader, magic), 'X' },
+        { "version", offsetof(hsSnapHeader, version), 99 },
+        { "point count", offsetof(hsSnapHeader, numPnts), 0x7F },
+        { "truncated file", -1, 0 },
+    };
+    const char *swarmDamage_arr[] = { "point on the border", "repeated posNum", "repeated coordinate" };
+
+    // SETUP
+    srand(3);
+    headNode_ptr = create_shawarma_list(1, maxX, 1, maxY, CHECK_SNAP_PNTS, 0, 0);
+    swarm_ptr = headNode_ptr ? swarm_from_shawarma_list(headNode_ptr) : NULL;
+
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harklecheck, check_snapshot_round_trip, Failed to build the swarm);
+        success = false;
+    }
+
+    // ROUND TRIP
+    if (true == success)
+    {
+        numBytes = swarm_ptr->numPnts * sizeof(int);
+        snap_ptr = (true == write_check_snapshot(swarm_ptr)) ? map_swarm_snapshot(CHECK_SNAP_FILE) : NULL;
+
+        if (!snap_ptr)
+        {
+            fprintf(stderr, "snapshot_round_trip: a good snapshot did not map\n");
+            success = false;
+        }
+        else if (swarm_ptr->numPnts != snap_ptr->header_ptr->numPnts || 12 != snap_ptr->header_ptr->numSweeps
+                 || 345 != snap_ptr->header_ptr->totMoves || 3 != snap_ptr->header_ptr->rngSeed
+                 || CHECK_SNAP_ROWS != snap_ptr->header_ptr->numRows
+                 || CHECK_SNAP_COLS != snap_ptr->header_ptr->numCols)
+        {
+            fprintf(stderr, "snapshot_round_trip: the header did not survive the round trip\n");
+            success = false;
+        }
+        else if (memcmp(snap_ptr->posNum, swarm_ptr->posNum, numBytes)
+                 || memcmp(snap_ptr->absX, swarm_ptr->absX, numBytes)
+                 || memcmp(snap_ptr->absY, swarm_ptr->absY, numBytes)
+                 || memcmp(snap_ptr->graphic, swarm_ptr->graphic, swarm_ptr->numPnts))
+        {
+            fprintf(stderr, "snapshot_round_trip: the swarm did not survive the round trip\n");
+            success = false;
+        }
+        else if (false == verify_snapshot_swarm(snap_ptr, maxX, maxY))
+        {
+            fprintf(stderr, "snapshot_round_trip: a good swarm failed verification\n");
+            success = false;
+        }
+
+        if (snap_ptr)
+        {
+            snapSize = snap_ptr->mapLen;
+            unmap_swarm_snapshot(&snap_ptr);
+        }
+    }
+
+    // DAMAGED HEADERS
+    for (i = 0; true == success && i < (int)(sizeof(header_arr) / sizeof(header_arr[0])); i++)
+    {
+        success = write_check_snapshot(swarm_ptr);
+
+        if (true == success && 0 > header_arr[i].offset)
+        {
+            success = (0 == truncate(CHECK_SNAP_FILE, (off_t)snapSize - 1)) ? true : false;
+        }
+        else if (true == success)
+        {
+            snapFile = fopen(CHECK_SNAP_FILE, "r+b");
+            success = (snapFile && 0 == fseek(snapFile, header_arr[i].offset, SEEK_SET)
+                       && EOF != fputc(header_arr[i].byteVal, snapFile)) ? true : false;
+
+            if (snapFile && 0 != fclose(snapFile))
+            {
+                success = false;
+            }
+        }
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklecheck, check_snapshot_round_trip, Failed to damage the snapshot);
+        }
+        else if (NULL != (snap_ptr = map_swarm_snapshot(CHECK_SNAP_FILE)))
+        {
+            fprintf(stderr, "snapshot_round_trip: a snapshot with a bad %s was mapped\n", header_arr[i].what);
+            unmap_swarm_snapshot(&snap_ptr);
+            success = false;
+        }
+    }
+
+    // DAMAGED SWARMS
+    for (i = 0; true == success && i < (int)(sizeof(swarmDamage_arr) / sizeof(swarmDamage_arr[0])); i++)
+    {
+        tmpX = swarm_ptr->absX[1];
+        tmpY = swarm_ptr->absY[1];
+        tmpPosNum = swarm_ptr->posNum[1];
+
+        switch (i)
+        {
+            case 0:
+                swarm_ptr->absX[1] = maxX + 1;
+                break;
+            case 1:
+                swarm_ptr->posNum[1] = swarm_ptr->posNum[0];
+                break;
+            default:
+                swarm_ptr->absX[1] = swarm_ptr->absX[0];
+                swarm_ptr->absY[1] = swarm_ptr->absY[0];
+                break;
+        }
+
+        snap_ptr = (true == write_check_snapshot(swarm_ptr)) ? map_swarm_snapshot(CHECK_SNAP_FILE) : NULL;
+        swarm_ptr->absX[1] = tmpX;
+        swarm_ptr->absY[1] = tmpY;
+        swarm_ptr->posNum[1] = tmpPosNum;
+
+        if (!snap_ptr)
+        {
+            fprintf(stderr, "snapshot_round_trip: a snapshot with a %s did not map\n", swarmDamage_arr[i]);
+            success = false;
+        }
+        else
+        {
+            if (true == verify_snapshot_swarm(snap_ptr, maxX, maxY))
+            {
+                fprintf(stderr, "snapshot_round_trip: a swarm with a %s passed verification\n",
+                        swarmDamage_arr[i]);
+                success = false;
+            }
+
+            unmap_swarm_snapshot(&snap_ptr);
+        }
+    }
+
+    // CLEAN UP
+    remove(CHECK_SNAP_FILE);
+
+    if (swarm_ptr)
+    {
+        free_swarm_store(&swarm_ptr);
+    }
+    if (headNode_ptr)
+    {
+        free_shawarma_linked_list(&headNode_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+hsPlane_ptr build_check_plane(unsigned int seed, int nRows, int nCols, int numPnts, hsSwarm_ptr *swarm_ptr)
+{
+    // LOCAL VARIABLES
+    hsPlane_ptr retVal = NULL;         // Plane engine
+    shawarma_ptr headNode_ptr = NULL;  // Scattered swarm
+
+    srand(seed);
+    headNode_ptr = create_shawarma_list(1, nCols - 2, 1, nRows - 2, numPnts, 0, 0);
+    *swarm_ptr = headNode_ptr ? swarm_from_shawarma_list(headNode_ptr) : NULL;
+    retVal = *swarm_ptr ? build_plane_engine(*swarm_ptr, 0) : NULL;
+
+    // CLEAN UP
+    if (!retVal && *swarm_ptr)
+    {
+        free_swarm_store(swarm_ptr);
+    }
+    if (headNode_ptr)
+    {
+        free_shawarma_linked_list(&headNode_ptr);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool check_trajectory_replay(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;                        // Set this to false if anything fails
+    winDetails fieldWin = { NULL, 0, 0, 0, 0 };  // Field, sized per case
+    // Test cases: seed, rows, columns and points
+    struct { unsigned int seed; int nRows; int nCols; int numPnts; } case_arr[] = {
+        { 2, 56, 192, 300 },
+        { 5, 600, 1000, 200000 },
+    };
+    hsSwarm_ptr swarm_ptr = NULL;               // Plane engine's swarm store
+    hsPlane_ptr plane_ptr = NULL;               // Plane engine
+    hsTrajLog_ptr log_ptr = NULL;               // Trajectory log being written
+    hsTrajReader_ptr reader_ptr = NULL;         // Trajectory log being replayed
+    hsTrajHeader header;                        // Describes the run to the trajectory log
+    long numMoves = 0;                          // Moves made in one sweep
+    int numMoved = 0;                           // Points the engine moved in one sweep
+    int numSweeps = 0;                          // Sweeps made
+    int pass = 0;                               // 0 to write the log, 1 to replay it
+    int i = 0;                                  // Iterating variable
+    int j = 0;                                  // Iterating variable
+
+    for (i = 0; true == success && i < (int)(sizeof(case_arr) / sizeof(case_arr[0])); i++)
+    {
+        fieldWin.nRows = case_arr[i].nRows;
+        fieldWin.nCols = case_arr[i].nCols;
+
+        for (pass = 0; true == success && pass < 2; pass++)
+        {
+            // SETUP
+            plane_ptr = build_check_plane(case_arr[i].seed, case_arr[i].nRows, case_arr[i].nCols,
+                                          case_arr[i].numPnts, &swarm_ptr);
+
+            if (!plane_ptr)
+            {
+                HARKLE_ERROR(Harklecheck, check_trajectory_replay, build_check_plane failed);
+                success = false;
+            }
+            else if (0 == pass)
+            {
+                memset(&header, 0x0, sizeof(header));
+                header.numRows = case_arr[i].nRows;
+                header.numCols = case_arr[i].nCols;
+                header.numPnts = swarm_ptr->numPnts;
+                log_ptr = open_trajectory_log(CHECK_TRAJ_FILE, &header, swarm_ptr->posNum, swarm_ptr->absX,
+                                              swarm_ptr->absY);
+
+                if (!log_ptr)
+                {
+                    HARKLE_ERROR(Harklecheck, check_trajectory_replay, open_trajectory_log failed);
+                    success = false;
+                }
+            }
+            else
+            {
+                reader_ptr = open_trajectory_reader(CHECK_TRAJ_FILE);
+
+                if (!reader_ptr)
+                {
+                    HARKLE_ERROR(Harklecheck, check_trajectory_replay, open_trajectory_reader failed);
+                    success = false;
+                }
+                else if (swarm_ptr->numPnts != reader_ptr->header.numPnts
+                         || memcmp(reader_ptr->posNum, swarm_ptr->posNum, swarm_ptr->numPnts * sizeof(int))
+                         || memcmp(reader_ptr->absX, swarm_ptr->absX, swarm_ptr->numPnts * sizeof(int))
+                         || memcmp(reader_ptr->absY, swarm_ptr->absY, swarm_ptr->numPnts * sizeof(int)))
+                {
+                    fprintf(stderr, "trajectory_replay: seed %u keyframe does not match the swarm\n",
+                            case_arr[i].seed);
+                    success = false;
+                }
+            }
+
+            // SWEEP (and log, or replay, each sweep)
+            if (true == success)
+            {
+                numSweeps = 0;
+                do
+                {
+                    numMoves = shwarm_plane_sweep(&fieldWin, plane_ptr, HS_MAX_SWARM_MOVES, true);
+                    numSweeps++;
+
+                    if (0 > numMoves)
+                    {
+                        HARKLE_ERROR(Harklecheck, check_trajectory_replay, shwarm_plane_sweep failed);
+                        success = false;
+                    }
+                    else if (0 == pass)
+                    {
+                        success = log_trajectory_sweep(log_ptr, swarm_ptr->absX, swarm_ptr->absY);
+                    }
+                    else
+                    {
+                        // The reader still holds the last sweep's coordinates
+                        for (numMoved = 0, j = 0; j < swarm_ptr->numPnts; j++)
+                        {
+                            if (reader_ptr->absX[j] != swarm_ptr->absX[j] || reader_ptr->absY[j] != swarm_ptr->absY[j])
+                            {
+                                numMoved++;
+                            }
+                        }
+
+                        if (numMoved != replay_trajectory_sweep(reader_ptr)
+                            || memcmp(reader_ptr->absX, swarm_ptr->absX, swarm_ptr->numPnts * sizeof(int))
+                            || memcmp(reader_ptr->absY, swarm_ptr->absY, swarm_ptr->numPnts * sizeof(int)))
+                        {
+                            fprintf(stderr, "trajectory_replay: seed %u sweep %d did not replay to the swarm\n",
+                                    case_arr[i].seed, numSweeps);
+                            success = false;
+                        }
+                    }
+                } while (true == success && 0 < numMoves && numSweeps < CHECK_TRAJ_SWEEPS);
+            }
+
+            // FINISH
+            if (log_ptr && false == close_trajectory_log(&log_ptr))
+            {
+                HARKLE_ERROR(Harklecheck, check_trajectory_replay, close_trajectory_log failed);
+                success = false;
+            }
+            if (true == success && reader_ptr
+                && (-1 != replay_trajectory_sweep(reader_ptr) || false == reader_ptr->atEnd))
+            {
+                fprintf(stderr, "trajectory_replay: seed %u log does not end after sweep %d\n", case_arr[i].seed,
+                        numSweeps);
+                success = false;
+            }
+
+            // CLEAN UP
+            if (reader_ptr)
+            {
+                close_trajectory_reader(&reader_ptr);
+            }
+            if (plane_ptr)
+            {
+                free_plane_engine(&plane_ptr);
+            }
+            if (swarm_ptr)
+            {
+                free_swarm_store(&swarm_ptr);
+            }
+        }
+    }
+
+    remove(CHECK_TRAJ_FILE);
+
+    // DONE
+    return success;
+}
+
+
+bool check_scan_kernels(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;                                  // Set this to false if anything fails
+    // Test cases: seed, rows, columns and points (none a multiple of HS_SCAN_LANES)
+    struct { unsigned int seed; int nRows; int nCols; int numPnts; } case_arr[] = {
+        { 1, 6, 9, 5 },
+        { 2, 20, 30, 13 },
+        { 3, 20, 30, 1003 },
+        { 4, 200, 300, 4099 },
+    };
+    int neighbour_arr[] = { 1, 2, 5, HS_SCAN_MAX_NEIGHBOURS };  // Number of neighbours to scan for
+    int numTwoDim = (int)(sizeof(neighbour_arr) / sizeof(neighbour_arr[0]));  // Two dimensional scans per origin
+    int *absX = NULL;                                     // Swarm x coordinates
+    int *absY = NULL;                                     // Swarm y coordinates
+    int id_arr[2][HS_SCAN_MAX_NEIGHBOURS];                // Indices found by the scalar (0) and dispatched (1) kernels
+    long long sqDist_arr[2][HS_SCAN_MAX_NEIGHBOURS];      // Squared distances found by each kernel
+    int numFound[2] = { 0, 0 };                           // Number of points found by each kernel
+    int kernel = 0;                                       // 0 for the scalar kernel, 1 for the dispatched one
+    int origin = 0;                                       // Index of the point scanned from
+    int numNeighbours = 0;                                // Number of neighbours scanned for
+    int i = 0;                                            // Iterating variable
+    int j = 0;                                            // Iterating variable
+    int k = 0;                                            // Iterating variable
+
+    for (i = 0; true == success && i < (int)(sizeof(case_arr) / sizeof(case_arr[0])); i++)
+    {
+        // SETUP
+        absX = calloc(case_arr[i].numPnts, sizeof(int));
+        absY = calloc(case_arr[i].numPnts, sizeof(int));
+
+        if (!absX || !absY)
+        {
+            HARKLE_ERROR(Harklecheck, check_scan_kernels, calloc failed);
+            success = false;
+        }
+        else
+        {
+            srand(case_arr[i].seed);
+
+            for (j = 0; j < case_arr[i].numPnts; j++)
+            {
+                absX[j] = 1 + (rand() % (case_arr[i].nCols - 2));
+                absY[j] = 1 + (rand() % (case_arr[i].nRows - 2));
+            }
+        }
+
+        // SCAN
+        for (j = 0; true == success && j < CHECK_SCAN_ORIGINS; j++)
+        {
+            origin = rand() % case_arr[i].numPnts;
+
+            // The last two passes scan along a horizontal and a vertical line
+            for (k = 0; true == success && k < numTwoDim + 2; k++)
+            {
+                numNeighbours = (k < numTwoDim) ? neighbour_arr[k] : 2;
+                memset(id_arr, 0x0, sizeof(id_arr));
+                memset(sqDist_arr, 0x0, sizeof(sqDist_arr));
+
+                for (kernel = 0; true == success && kernel < 2; kernel++)
+                {
+                    if (0 > select_scan_kernel((0 == kernel) ? HS_SCAN_KERNEL_SCALAR : HS_SCAN_KERNEL_AUTO))
+                    {
+                        HARKLE_ERROR(Harklecheck, check_scan_kernels, select_scan_kernel failed);
+                        success = false;
+                    }
+                    else if (k < numTwoDim)
+                    {
+                        numFound[kernel] = scan_closest_two_dim(absX, absY, case_arr[i].numPnts, absX[origin],
+                                                                absY[origin], origin, numNeighbours, id_arr[kernel],
+                                                                sqDist_arr[kernel]);
+                    }
+                    else
+                    {
+                        numFound[kernel] = scan_closest_one_dim(absX, absY, case_arr[i].numPnts, absX[origin],
+                                                                absY[origin], origin, (k > numTwoDim) ? true : false,
+                                                                id_arr[kernel], sqDist_arr[kernel]);
+                    }
+                }
+
+                if (true == success && (0 > numFound[0] || numFound[0] != numFound[1]
+                                        || memcmp(id_arr[0], id_arr[1], sizeof(id_arr[0]))
+                                        || memcmp(sqDist_arr[0], sqDist_arr[1], sizeof(sqDist_arr[0]))))
+                {
+                    fprintf(stderr, "scan_kernels: seed %u origin %d pass %d kernels disagree (scalar found %d points, "
+                            "dispatched found %d)\n", case_arr[i].seed, origin, k, numFound[0], numFound[1]);
+                    success = false;
+                }
+            }
+        }
+
+        // CLEAN UP
+        if (absX)
+        {
+            free(absX);
+            absX = NULL;
+        }
+        if (absY)
+        {
+            free(absY);
+            absY = NULL;
+        }
+    }
+
+    select_scan_kernel(HS_SCAN_KERNEL_AUTO);
+
+    // DONE
+    return success;
+}
+
+
+bool check_bulk_equilibrium(void)
+{
+    // LOCAL VARIABLES
+    bool success = true;                        // Set this to false if anything fails
+    winDetails fieldWin = { NULL, 0, 0, 0, 0 };  // Field, sized per case
+    // Test cases: seed, rows, columns and points (the third is crowded enough to block plenty of proposals)
+    struct { unsigned int seed; int nRows; int nCols; int numPnts; } case_arr[] = {
+        { 1, 36, 76, 20 },
+        { 2, 56, 192, 300 },
+        { 3, 12, 14, 60 },
+        { 4, 200, 300, 5000 },
+    };
+    hsSwarm_ptr swarm_ptr = NULL;               // Plane engine's swarm store
+    hsPlane_ptr plane_ptr = NULL;               // Plane engine under test
+    char *seen_arr = NULL;                      // seen_arr[posNum] is set once posNum is found
+    char *cell_arr = NULL;                      // cell_arr[y * nCols + x] is set once (x, y) is claimed
+    long numMoves = 0;                          // Moves made in one sweep
+    int numSweeps = 0;                          // Sweeps made
+    int posNum = 0;                             // A point's posNum
+    int x = 0;                                  // A point's x coordinate
+    int y = 0;                                  // A point's y coordinate
+    int i = 0;                                  // Iterating variable
+    int j = 0;                                  // Iterating variable
+
+    for (i = 0; true == success && i < (int)(sizeof(case_arr) / sizeof(case_arr[0])); i++)
+    {
+        // SETUP
+        fieldWin.nRows = case_arr[i].nRows;
+        fieldWin.nCols = case_arr[i].nCols;
+        plane_ptr = build_check_plane(case_arr[i].seed, case_arr[i].nRows, case_arr[i].nCols, case_arr[i].numPnts,
+                                      &swarm_ptr);
+        seen_arr = calloc(case_arr[i].numPnts + 1, sizeof(char));
+        cell_arr = calloc(case_arr[i].nRows * case_arr[i].nCols, sizeof(char));
+
+        if (!plane_ptr || !seen_arr || !cell_arr)
+        {
+            HARKLE_ERROR(Harklecheck, check_bulk_equilibrium, Failed to build the engine);
+            success = false;
+        }
+
+        // SWARM
+        if (true == success)
+        {
+            numSweeps = 0;
+            do
+            {
+                numMoves = shwarm_plane_bulk_sweep(&fieldWin, plane_ptr, HS_MAX_SWARM_MOVES, true);
+                numSweeps++;
+            } while (true == success && 0 < numMoves && numSweeps < CHECK_MAX_SWEEPS);
+        }
+
+        if (true == success && 0 != numMoves)
+        {
+            fprintf(stderr, "bulk_equilibrium: seed %u with %d points never settled (%ld moves in sweep %d)\n",
+                    case_arr[i].seed, case_arr[i].numPnts, numMoves, numSweeps);
+            success = false;
+        }
+        else if (true == success && 0 != (numMoves = shwarm_plane_bulk_sweep(&fieldWin, plane_ptr,
+                                                                              HS_MAX_SWARM_MOVES, true)))
+        {
+            fprintf(stderr, "bulk_equilibrium: seed %u with %d points moved %ld after settling\n",
+                    case_arr[i].seed, case_arr[i].numPnts, numMoves);
+            success = false;
+        }
+
+        // VERIFY THE SWARM
+        for (j = 0; true == success && j < swarm_ptr->numPnts; j++)
+        {
+            posNum = swarm_ptr->posNum[j];
+            x = swarm_ptr->absX[j];
+            y = swarm_ptr->absY[j];
+
+            if (case_arr[i].numPnts != swarm_ptr->numPnts || 1 > posNum || case_arr[i].numPnts < posNum
+                || seen_arr[posNum])
+            {
+                fprintf(stderr, "bulk_equilibrium: seed %u lost or repeated point %d\n", case_arr[i].seed, posNum);
+                success = false;
+            }
+            else if (1 > x || fieldWin.nCols - 2 < x || 1 > y || fieldWin.nRows - 2 < y
+                     || cell_arr[(y * fieldWin.nCols) + x])
+            {
+                fprintf(stderr, "bulk_equilibrium: seed %u left point %d at (%d, %d), outside the field or on "
+                        "another point\n", case_arr[i].seed, posNum, x, y);
+                success = false;
+            }
+            else
+            {
+                seen_arr[posNum] = 1;
+                cell_arr[(y * fieldWin.nCols) + x] = 1;
+            }
+        }
+
+        // CLEAN UP
+        if (plane_ptr)
+        {
+            free_plane_engine(&plane_ptr);
+        }
+        if (swarm_ptr)
+        {
+            free_swarm_store(&swarm_ptr);
+        }
+        if (seen_arr)
+        {
+            free(seen_arr);
+            seen_arr = NULL;
+        }
+        if (cell_arr)
+        {
+            free(cell_arr);
+            cell_arr = NULL;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+void print_usage(char *progName)
+{
+    fprintf(stderr, "Usage: %s [-f|--filter NAME] [-h|--help]\n", progName);
+    fprintf(stderr, "\t-f, --filter: only run checks whose name contains NAME\n");
+    fprintf(stderr, "\t-h, --help: print this usage and exit\n");
+
+    // DONE
+    return;
+}
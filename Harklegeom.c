@@ -0,0 +1,203 @@
+#include "Harklegeom.h"
+#include "Harklemath.h"         // HM_RND, HM_UP, HM_DOWN
+#include "Harklerror.h"         // HARKLE_ERROR
+#include <limits.h>             // INT_MAX, INT_MIN
+#include <stdlib.h>             // abs()
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Divide two integers, rounding toward negative infinity
+    INPUT
+        numerator - Numerator
+        denominator - Denominator (must be greater than 0)
+    OUTPUT
+        floor(numerator / denominator)
+    NOTES
+        C rounds integer division toward zero, which is the wrong way for negative quotients
+        This function does not perform input validation
+ */
+long long floor_int_ratio(long long numerator, long long denominator)
+{
+    // LOCAL VARIABLES
+    long long retVal = numerator / denominator;  // Quotient, rounded toward zero
+
+    if (numerator % denominator && numerator < 0)
+    {
+        retVal--;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Store a long long in an int, if it fits
+    INPUT
+        value - Value to store
+        outVal_ptr - [Out] Where to store it
+    OUTPUT
+        If value fits in an int, true
+        Otherwise, false
+    NOTES
+        This function does not perform input validation
+ */
+bool store_int_result(long long value, int *outVal_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if value fits
+
+    if (value >= INT_MIN && value <= INT_MAX)
+    {
+        *outVal_ptr = (int)value;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+long long calc_int_cross_product(int x1, int y1, int x2, int y2, int x3, int y3)
+{
+    return ((long long)x2 - x1) * ((long long)y3 - y1) - ((long long)y2 - y1) * ((long long)x3 - x1);
+}
+
+
+bool are_int_points_collinear(int x1, int y1, int x2, int y2, int x3, int y3)
+{
+    return (0 == calc_int_cross_product(x1, y1, x2, y2, x3, y3)) ? true : false;
+}
+
+
+long long calc_int_point_sq_dist(int x1, int y1, int x2, int y2)
+{
+    return ((long long)x2 - x1) * ((long long)x2 - x1) + ((long long)y2 - y1) * ((long long)y2 - y1);
+}
+
+
+long long divide_int_ratio(long long numerator, long long denominator, int rndDir)
+{
+    // LOCAL VARIABLES
+    long long retVal = 0;  // Rounded quotient
+
+    // Keep the denominator positive so floor_int_ratio() rounds the right way
+    if (denominator < 0)
+    {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    switch (rndDir)
+    {
+        case HM_UP:
+            retVal = -floor_int_ratio(-numerator, denominator);
+            break;
+        case HM_DOWN:
+            retVal = floor_int_ratio(numerator, denominator);
+            break;
+        default:
+            // floor(n / d + 1/2) == floor((2n + d) / 2d)
+            retVal = floor_int_ratio((2 * numerator) + denominator, 2 * denominator);
+            break;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int calc_int_gcd(int num1, int num2)
+{
+    // LOCAL VARIABLES
+    int tmpNum = 0;  // Temporary remainder
+
+    num1 = abs(num1);
+    num2 = abs(num2);
+
+    while (num2)
+    {
+        tmpNum = num1 % num2;
+        num1 = num2;
+        num2 = tmpNum;
+    }
+
+    // DONE
+    return num1;
+}
+
+
+int project_int_lattice(int anchorX, int anchorY, int stepX, int stepY, int xVal, int yVal)
+{
+    // LOCAL VARIABLES
+    long long dotProd = ((long long)(xVal - anchorX) * stepX) + ((long long)(yVal - anchorY) * stepY);
+    long long stepSqLen = ((long long)stepX * stepX) + ((long long)stepY * stepY);
+
+    // DONE
+    return (int)((dotProd >= 0) ? divide_int_ratio(dotProd, stepSqLen, HM_RND)
+                                : -divide_int_ratio(-dotProd, stepSqLen, HM_RND));
+}
+
+
+bool solve_int_line_y(int x1, int y1, int runX, int riseY, int xVal, int rndDir, int *yVal_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the line crosses xVal exactly once
+
+    // INPUT VALIDATION
+    if (!yVal_ptr)
+    {
+        HARKLE_ERROR(Harklegeom, solve_int_line_y, Invalid yVal_ptr);
+    }
+    else if (0 == runX)
+    {
+        HARKLE_ERROR(Harklegeom, solve_int_line_y, A vertical line has no single y coordinate);
+    }
+    else
+    {
+        // SOLVE
+        // y = y1 + riseY * (xVal - x1) / runX
+        success = store_int_result(y1 + divide_int_ratio((long long)riseY * ((long long)xVal - x1), runX, rndDir),
+                                   yVal_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool solve_int_line_x(int x1, int y1, int runX, int riseY, int yVal, int rndDir, int *xVal_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the line crosses yVal exactly once
+
+    // INPUT VALIDATION
+    if (!xVal_ptr)
+    {
+        HARKLE_ERROR(Harklegeom, solve_int_line_x, Invalid xVal_ptr);
+    }
+    else if (0 == riseY)
+    {
+        HARKLE_ERROR(Harklegeom, solve_int_line_x, A horizontal line has no single x coordinate);
+    }
+    else
+    {
+        // SOLVE
+        // x = x1 + runX * (yVal - y1) / riseY
+        success = store_int_result(x1 + divide_int_ratio((long long)runX * ((long long)yVal - y1), riseY, rndDir),
+                                   xVal_ptr);
+    }
+
+    // DONE
+    return success;
+}
@@ -0,0 +1,152 @@
+#ifndef __HARKLEGEOM__
+#define __HARKLEGEOM__
+
+#include "Harklemath.h"         // HM_RND, HM_UP, HM_DOWN
+#include <stdbool.h>            // bool, true, false
+
+// Integer geometry kernels
+//  Every coordinate in the swarm is an integer so every question the swarm asks about lines and distances
+//  can be answered exactly: collinearity by cross product, closeness by squared distance and line intercepts
+//  as rational numbers rounded once, at the very end.  Intermediate values are long long so the products of
+//  any two int coordinates (differences) fit.  Nothing here touches floating point.
+
+
+/*
+    PURPOSE - Calculate the cross product of (x2 - x1, y2 - y1) and (x3 - x1, y3 - y1)
+    INPUT
+        x1 - X coordinate of the shared origin
+        y1 - Y coordinate of the shared origin
+        x2 - X coordinate of the end of the first vector
+        y2 - Y coordinate of the end of the first vector
+        x3 - X coordinate of the end of the second vector
+        y3 - Y coordinate of the end of the second vector
+    OUTPUT
+        Twice the signed area of the triangle: positive if the three points turn counter-clockwise (in
+            Cartesian terms), negative if they turn clockwise and 0 if they are collinear
+ */
+long long calc_int_cross_product(int x1, int y1, int x2, int y2, int x3, int y3);
+
+
+/*
+    PURPOSE - Determine if three points lie on one line
+    INPUT
+        x1 - X coordinate of the first point
+        y1 - Y coordinate of the first point
+        x2 - X coordinate of the second point
+        y2 - Y coordinate of the second point
+        x3 - X coordinate of the third point
+        y3 - Y coordinate of the third point
+    OUTPUT
+        If so, true
+        Otherwise, false
+    NOTES
+        This replaces comparing calc_int_point_slope() results with dble_equal_to().  Vertical lines need no
+            special case and there is no precision to get wrong.
+ */
+bool are_int_points_collinear(int x1, int y1, int x2, int y2, int x3, int y3);
+
+
+/*
+    PURPOSE - Calculate the squared distance between two points
+    INPUT
+        x1 - X coordinate of the first point
+        y1 - Y coordinate of the first point
+        x2 - X coordinate of the second point
+        y2 - Y coordinate of the second point
+    OUTPUT
+        The square of the Euclidean distance
+    NOTES
+        Squaring preserves order so compare these instead of calc_int_point_dist() results.  Only take the
+            square root of the few distances that are kept.
+ */
+long long calc_int_point_sq_dist(int x1, int y1, int x2, int y2);
+
+
+/*
+    PURPOSE - Divide two integers, rounding the exact quotient once
+    INPUT
+        numerator - Numerator
+        denominator - Denominator (must not be 0)
+        rndDir - HM_RND to round to the nearest integer (halves round up, like floor(x + 0.5)), HM_UP to round
+            up or HM_DOWN to round down
+    OUTPUT
+        numerator / denominator, rounded
+    NOTES
+        This function does not perform input validation
+ */
+long long divide_int_ratio(long long numerator, long long denominator, int rndDir);
+
+
+/*
+    PURPOSE - Calculate the greatest common divisor of two integers
+    INPUT
+        num1 - Integer (must be greater than INT_MIN)
+        num2 - Integer (must be greater than INT_MIN)
+    OUTPUT
+        The greatest common divisor of abs(num1) and abs(num2) (0 if both are 0)
+    NOTES
+        Divide a direction by this to get the smallest integer step along it
+        This function does not perform input validation
+ */
+int calc_int_gcd(int num1, int num2);
+
+
+/*
+    PURPOSE - Project a point onto the integer lattice of a line
+    INPUT
+        anchorX - X coordinate of a lattice point on the line
+        anchorY - Y coordinate of a lattice point on the line
+        stepX - X component of the line's smallest integer step (see: calc_int_gcd())
+        stepY - Y component of the line's smallest integer step (see: calc_int_gcd())
+        xVal - X coordinate to project (need not lie on the line)
+        yVal - Y coordinate to project (need not lie on the line)
+    OUTPUT
+        The integer t of the lattice point, anchor + t * step, closest to (xVal, yVal)
+    NOTES
+        Halves round away from t == 0 so a point halfway between two lattice points settles the same way
+            whichever engine asks
+        This function does not perform input validation (the step must not be (0, 0))
+ */
+int project_int_lattice(int anchorX, int anchorY, int stepX, int stepY, int xVal, int yVal);
+
+
+/*
+    PURPOSE - Solve for the y coordinate of a line at a given x coordinate
+    INPUT
+        x1 - X coordinate of a point on the line
+        y1 - Y coordinate of a point on the line
+        runX - X component of the line's direction
+        riseY - Y component of the line's direction
+        xVal - X coordinate to solve for
+        rndDir - See: divide_int_ratio()
+        yVal_ptr - [Out] The y coordinate, rounded
+    OUTPUT
+        On success, true
+        On failure (e.g., a vertical line), false
+    NOTES
+        The line is (x1, y1) + t * (runX, riseY).  This is the exact rational equivalent of
+            solve_point_slope_y(): the intercept is only rounded once.
+ */
+bool solve_int_line_y(int x1, int y1, int runX, int riseY, int xVal, int rndDir, int *yVal_ptr);
+
+
+/*
+    PURPOSE - Solve for the x coordinate of a line at a given y coordinate
+    INPUT
+        x1 - X coordinate of a point on the line
+        y1 - Y coordinate of a point on the line
+        runX - X component of the line's direction
+        riseY - Y component of the line's direction
+        yVal - Y coordinate to solve for
+        rndDir - See: divide_int_ratio()
+        xVal_ptr - [Out] The x coordinate, rounded
+    OUTPUT
+        On success, true
+        On failure (e.g., a horizontal line), false
+    NOTES
+        This is the exact rational equivalent of solve_point_slope_x()
+ */
+bool solve_int_line_x(int x1, int y1, int runX, int riseY, int yVal, int rndDir, int *xVal_ptr);
+
+
+#endif  // __HARKLEGEOM__
@@ -0,0 +1,2295 @@
+#include "Harklecurse.h"
+#include "Harklegeom.h"         // calc_int_gcd(), project_int_lattice()
+#include "Harklemath.h"         // determine_mid_point()
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harkleline.h"
+#include "Harklestore.h"
+#include "Harkleswarm.h"
+#include <stdlib.h>             // abs(), calloc(), free(), qsort(), realloc()
+#include <string.h>             // memmove(), memset()
+
+
+// Defines a sortable (key, index) pair used to order the swarm along the line
+typedef struct hsLineKey
+{
+    int key;                  // absX (or absY for vertical lines)
+    int index;                // Swarm store index
+} hsLineKey, *hsLineKey_ptr;
+
+// Defines the struct shared by every chunk of a Jacobi sweep (see: shwarm_line_jacobi_sweep())
+typedef struct hsJacobiJob
+{
+    hsLine_ptr line_ptr;      // Line engine being swept
+    int maxMoves;             // Number of one-dimensional moves each point may move
+    bool useInts;             // If true, lowInt and highInt are treated as points
+    hsLineLen lowInt;         // Intercept with the lower sort key
+    hsLineLen highInt;        // Intercept with the higher sort key
+    bool commitMoves;         // If true, accepted moves are committed to the swarm store by the workers
+    int parity;               // Only ranks of this parity (0 for even, 1 for odd) move in the current phase
+    long *workerMoves;        // workerMoves[workerNum] is the number of moves accepted by that worker
+} hsJacobiJob, *hsJacobiJob_ptr;
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - qsort() comparison function for hsLineKey structs
+    NOTES
+        Ties are broken by swarm store index so the sort is deterministic
+ */
+int compare_line_keys(const void *key1_ptr, const void *key2_ptr)
+{
+    // LOCAL VARIABLES
+    const hsLineKey *lineKey1_ptr = (const hsLineKey *)key1_ptr;
+    const hsLineKey *lineKey2_ptr = (const hsLineKey *)key2_ptr;
+    int retVal = 0;
+
+    if (lineKey1_ptr->key != lineKey2_ptr->key)
+    {
+        retVal = (lineKey1_ptr->key < lineKey2_ptr->key) ? -1 : 1;
+    }
+    else if (lineKey1_ptr->index != lineKey2_ptr->index)
+    {
+        retVal = (lineKey1_ptr->index < lineKey2_ptr->index) ? -1 : 1;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Get the sort key of a swarm store index along the line
+    INPUT
+        line_ptr - Pointer to a line engine
+        index - Swarm store index
+    OUTPUT
+        absY for vertical lines, absX otherwise
+    NOTES
+        This function does not perform input validation
+ */
+int get_line_key(hsLine_ptr line_ptr, int index)
+{
+    return (true == line_ptr->vertLine) ? line_ptr->swarm_ptr->absY[index] : line_ptr->swarm_ptr->absX[index];
+}
+
+
+/*
+    PURPOSE - Divide two integers, rounding to the nearest integer (halves round away from zero)
+    INPUT
+        numerator - Numerator
+        denominator - Denominator (must be greater than 0)
+    OUTPUT
+        numerator / denominator, rounded
+    NOTES
+        This function does not perform input validation
+ */
+int round_ratio(long long numerator, long long denominator)
+{
+    // LOCAL VARIABLES
+    long long retVal = 0;  // Rounded quotient
+
+    if (numerator >= 0)
+    {
+        retVal = ((2 * numerator) + denominator) / (2 * denominator);
+    }
+    else
+    {
+        retVal = -(((-2 * numerator) + denominator) / (2 * denominator));
+    }
+
+    // DONE
+    return (int)retVal;
+}
+
+
+/*
+    PURPOSE - Determine if a coordinate lies exactly on the engine's line
+    INPUT
+        line_ptr - Pointer to a line engine with a valid anchor and step
+        xVal - X coordinate
+        yVal - Y coordinate
+    OUTPUT
+        If (xVal, yVal) == anchor + t * step for some integer t, true
+        Otherwise, false
+    NOTES
+        This is an exact integer cross product, like verify_line(), so no slope precision is involved
+        This function does not perform input validation
+ */
+bool is_on_line(hsLine_ptr line_ptr, int xVal, int yVal)
+{
+    return ((long long)(xVal - line_ptr->anchorX) * line_ptr->stepY
+            == (long long)(yVal - line_ptr->anchorY) * line_ptr->stepX) ? true : false;
+}
+
+
+/*
+    PURPOSE - Project a coordinate onto the line's integer lattice
+    INPUT
+        line_ptr - Pointer to a line engine with a valid anchor and step
+        xVal - X coordinate
+        yVal - Y coordinate
+    OUTPUT
+        The integer t of the closest point, anchor + t * step, on the line
+    NOTES
+        This function does not perform input validation
+ */
+int project_onto_line(hsLine_ptr line_ptr, int xVal, int yVal)
+{
+    return project_int_lattice(line_ptr->anchorX, line_ptr->anchorY, line_ptr->stepX, line_ptr->stepY, xVal, yVal);
+}
+
+
+/*
+    PURPOSE - Calculate where a point lands if it moves along the line toward a destination
+    INPUT
+        line_ptr - Pointer to a line engine
+        curX - X coordinate of the point (must lie on the line)
+        curY - Y coordinate of the point (must lie on the line)
+        dstX - X coordinate of the destination (need not lie on the line)
+        dstY - Y coordinate of the destination (need not lie on the line)
+        maxMoves - Number of one-dimensional moves the point may move
+        newX_ptr - Out parameter for the new x coordinate
+        newY_ptr - Out parameter for the new y coordinate
+    OUTPUT
+        The number of moves made, not to exceed maxMoves.  0 if the point is already as close as it can get.
+    NOTES
+        This replaces move_shawarma() for line engines.  move_shawarma() steps x and y independently, which
+            can leave the line on anything but horizontal, vertical and diagonal lines.  This function only
+            ever steps between integer points on the line so the line never has to be verified again.
+        A step costs abs(stepX) + abs(stepY) moves but at least one step is always allowed
+        This function only reads line_ptr's step so it is safe to call from any number of threads
+        This function does not perform input validation
+ */
+int calc_line_step(hsLine_ptr line_ptr, int curX, int curY, int dstX, int dstY, int maxMoves,
+                   int *newX_ptr, int *newY_ptr)
+{
+    // LOCAL VARIABLES
+    int numMoves = 0;                                                  // Number of moves made
+    int stepCost = abs(line_ptr->stepX) + abs(line_ptr->stepY);        // Moves per step along the line
+    int curT = project_onto_line(line_ptr, curX, curY);                // Current lattice step
+    int dstT = project_onto_line(line_ptr, dstX, dstY);                // Closest lattice step to the destination
+    int numSteps = abs(dstT - curT);                                   // Lattice steps to take
+    int maxSteps = (maxMoves / stepCost > 0) ? maxMoves / stepCost : 1;  // Lattice steps allowed
+
+    // CALCULATE
+    if (numSteps > maxSteps)
+    {
+        numSteps = maxSteps;
+    }
+    if (dstT < curT)
+    {
+        numSteps = -numSteps;
+    }
+
+    *newX_ptr = curX + (numSteps * line_ptr->stepX);
+    *newY_ptr = curY + (numSteps * line_ptr->stepY);
+    numMoves = abs(numSteps) * stepCost;
+
+    if (numMoves > maxMoves)
+    {
+        numMoves = maxMoves;
+    }
+
+    // DONE
+    return numMoves;
+}
+
+
+/*
+    PURPOSE - Calculate where a swarm store point lands if it moves along the line toward a destination
+    INPUT
+        line_ptr - Pointer to a line engine
+        index - Swarm store index of the point to move
+        See: calc_line_step()
+    OUTPUT
+        See: calc_line_step()
+    NOTES
+        The swarm store is not modified
+        This function does not perform input validation
+ */
+int calc_line_move(hsLine_ptr line_ptr, int index, int dstX, int dstY, int maxMoves, int *newX_ptr, int *newY_ptr)
+{
+    return calc_line_step(line_ptr, line_ptr->swarm_ptr->absX[index], line_ptr->swarm_ptr->absY[index],
+                          dstX, dstY, maxMoves, newX_ptr, newY_ptr);
+}
+
+
+/*
+    PURPOSE - Grow one of a line engine's per-point arrays
+    INPUT
+        array_ptr - Pointer to the int array pointer to grow
+        newMax - Number of elements to allocate
+    OUTPUT
+        On success, true (and *array_ptr points to the grown array)
+        On failure, false (and *array_ptr is unchanged)
+    NOTES
+        NULL arrays (e.g., targets that were never solved) are left NULL
+        This function does not perform input validation
+ */
+bool grow_line_array(int **array_ptr, int newMax)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if realloc() fails
+    int *tmp_ptr = NULL;  // Return value from realloc()
+
+    // GROW
+    if (*array_ptr)
+    {
+        tmp_ptr = realloc(*array_ptr, newMax * sizeof(int));
+
+        if (!tmp_ptr)
+        {
+            HARKLE_ERROR(Harkleline, grow_line_array, realloc failed);
+            success = false;
+        }
+        else
+        {
+            *array_ptr = tmp_ptr;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Find the position in 'order' a sort key belongs at
+    INPUT
+        line_ptr - Pointer to a line engine
+        key - Sort key to search for
+    OUTPUT
+        The rank of the first point whose sort key is not less than key (numOrdered if there is none)
+    NOTES
+        This is a binary search so it is O(log n)
+        This function does not perform input validation
+ */
+int find_line_rank(hsLine_ptr line_ptr, int key)
+{
+    // LOCAL VARIABLES
+    int lowRank = 0;                       // Lowest rank still under consideration
+    int highRank = line_ptr->numOrdered;   // One past the highest rank still under consideration
+    int midRank = 0;                       // Rank being checked
+
+    // SEARCH
+    while (lowRank < highRank)
+    {
+        midRank = lowRank + ((highRank - lowRank) / 2);
+
+        if (get_line_key(line_ptr, line_ptr->order[midRank]) < key)
+        {
+            lowRank = midRank + 1;
+        }
+        else
+        {
+            highRank = midRank;
+        }
+    }
+
+    // DONE
+    return lowRank;
+}
+
+
+/*
+    PURPOSE - Calculate the line's intercepts with curWindow
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine window border points)
+        line_ptr - Pointer to a line engine
+        lowInt_ptr - Out parameter for the intercept with the lower sort key
+        highInt_ptr - Out parameter for the intercept with the higher sort key
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This is calculate_intercepts_one_dim() without the heap: the two intercept nodes live on the stack
+        The intercepts are cached in line_ptr->intCache and only recalculated if the window's dimensions
+            changed or invalidate_line_intercepts() was called
+        This function does not perform input validation
+ */
+bool calc_line_engine_intercepts(winDetails_ptr curWindow, hsLine_ptr line_ptr, hsLineLen_ptr lowInt_ptr,
+                                 hsLineLen_ptr highInt_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;                            // Indicates function success
+    hsIntCache_ptr cache_ptr = &(line_ptr->intCache);  // Cached intercepts
+    shawarma srcNode;                               // Any point on the line
+    shawarma intNode_arr[2];                        // Two-node intercept 'linked list'
+
+    // CHECK THE CACHE
+    if (true == cache_ptr->valid && cache_ptr->upperR == curWindow->upperR && cache_ptr->leftC == curWindow->leftC
+        && cache_ptr->nRows == curWindow->nRows && cache_ptr->nCols == curWindow->nCols)
+    {
+        *lowInt_ptr = cache_ptr->lowInt;
+        *highInt_ptr = cache_ptr->highInt;
+    }
+    else
+    {
+        // SETUP
+        cache_ptr->valid = false;
+        memset(&srcNode, 0x0, sizeof(srcNode));
+        memset(intNode_arr, 0x0, sizeof(intNode_arr));
+        srcNode.absX = line_ptr->anchorX;
+        srcNode.absY = line_ptr->anchorY;
+        intNode_arr[0].nextPnt = &(intNode_arr[1]);
+
+        // CALCULATE INTERCEPTS
+        if (true == line_ptr->vertLine)
+        {
+            // Top intercept
+            intNode_arr[0].absX = srcNode.absX;
+            intNode_arr[0].absY = curWindow->upperR;
+            // Bottom intercept
+            intNode_arr[1].absX = srcNode.absX;
+            intNode_arr[1].absY = curWindow->upperR + curWindow->nRows - 1;
+        }
+        else
+        {
+            success = calculate_line_intercepts(curWindow, &srcNode, intNode_arr, line_ptr->stepX, line_ptr->stepY);
+
+            if (false == success)
+            {
+                HARKLE_ERROR(Harkleline, calc_line_engine_intercepts, calculate_line_intercepts failed);
+            }
+        }
+
+        // SORT THEM
+        if (true == success)
+        {
+            if ((true == line_ptr->vertLine && intNode_arr[0].absY > intNode_arr[1].absY)
+                || (false == line_ptr->vertLine && intNode_arr[0].absX > intNode_arr[1].absX))
+            {
+                cache_ptr->lowInt.xCoord = intNode_arr[1].absX;
+                cache_ptr->lowInt.yCoord = intNode_arr[1].absY;
+                cache_ptr->highInt.xCoord = intNode_arr[0].absX;
+                cache_ptr->highInt.yCoord = intNode_arr[0].absY;
+            }
+            else
+            {
+                cache_ptr->lowInt.xCoord = intNode_arr[0].absX;
+                cache_ptr->lowInt.yCoord = intNode_arr[0].absY;
+                cache_ptr->highInt.xCoord = intNode_arr[1].absX;
+                cache_ptr->highInt.yCoord = intNode_arr[1].absY;
+            }
+
+            // Update the cache
+            cache_ptr->upperR = curWindow->upperR;
+            cache_ptr->leftC = curWindow->leftC;
+            cache_ptr->nRows = curWindow->nRows;
+            cache_ptr->nCols = curWindow->nCols;
+            cache_ptr->valid = true;
+            *lowInt_ptr = cache_ptr->lowInt;
+            *highInt_ptr = cache_ptr->highInt;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Consider an intercept as a neighbour candidate for one side of a point
+    INPUT
+        line_ptr - Pointer to a line engine
+        srcKey - Sort key of the point being moved
+        int_ptr - The intercept to consider
+        lowNeigh_ptr - The current 'lower' neighbour, updated if the intercept is a closer lower neighbour
+        lowFound_ptr - Indicates lowNeigh_ptr holds a neighbour
+        highNeigh_ptr - The current 'higher' neighbour, updated if the intercept is a closer higher neighbour
+        highFound_ptr - Indicates highNeigh_ptr holds a neighbour
+    NOTES
+        Intercepts are treated exactly like points, the way shwarm_one_dim() appends them to the list
+        This function does not perform input validation
+ */
+void consider_line_intercept(hsLine_ptr line_ptr, int srcKey, hsLineLen_ptr int_ptr,
+                             hsLineLen_ptr lowNeigh_ptr, bool *lowFound_ptr,
+                             hsLineLen_ptr highNeigh_ptr, bool *highFound_ptr)
+{
+    // LOCAL VARIABLES
+    int intKey = (true == line_ptr->vertLine) ? int_ptr->yCoord : int_ptr->xCoord;
+    int neighKey = 0;
+
+    if (intKey < srcKey)
+    {
+        neighKey = (true == line_ptr->vertLine) ? lowNeigh_ptr->yCoord : lowNeigh_ptr->xCoord;
+
+        if (false == *lowFound_ptr || intKey > neighKey)
+        {
+            lowNeigh_ptr->xCoord = int_ptr->xCoord;
+            lowNeigh_ptr->yCoord = int_ptr->yCoord;
+            *lowFound_ptr = true;
+        }
+    }
+    else if (intKey > srcKey)
+    {
+        neighKey = (true == line_ptr->vertLine) ? highNeigh_ptr->yCoord : highNeigh_ptr->xCoord;
+
+        if (false == *highFound_ptr || intKey < neighKey)
+        {
+            highNeigh_ptr->xCoord = int_ptr->xCoord;
+            highNeigh_ptr->yCoord = int_ptr->yCoord;
+            *highFound_ptr = true;
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Restore the sorted order after the point at swarm store index 'index' moved
+    INPUT
+        line_ptr - Pointer to a line engine
+        index - Swarm store index of the point that moved
+    OUTPUT
+        On success, true
+        On failure (the point now shares a sort key with a neighbour), false
+    NOTES
+        A point moving toward the midpoint of its neighbours never passes them so this is O(1) in
+            practice.  It degrades gracefully (insertion sort) if it ever does.
+        This function does not perform input validation
+ */
+bool restore_line_order(hsLine_ptr line_ptr, int index)
+{
+    // LOCAL VARIABLES
+    bool success = true;                 // Set this to false on a sort key collision
+    int curRank = line_ptr->rank[index]; // Current position in order
+    int key = get_line_key(line_ptr, index);
+    int otherIndex = 0;                  // Neighbouring swarm store index
+
+    // BUBBLE DOWN
+    while (curRank > 0 && get_line_key(line_ptr, line_ptr->order[curRank - 1]) > key)
+    {
+        otherIndex = line_ptr->order[curRank - 1];
+        line_ptr->order[curRank] = otherIndex;
+        line_ptr->rank[otherIndex] = curRank;
+        curRank--;
+    }
+
+    // BUBBLE UP
+    while (curRank < line_ptr->numOrdered - 1 && get_line_key(line_ptr, line_ptr->order[curRank + 1]) < key)
+    {
+        otherIndex = line_ptr->order[curRank + 1];
+        line_ptr->order[curRank] = otherIndex;
+        line_ptr->rank[otherIndex] = curRank;
+        curRank++;
+    }
+
+    line_ptr->order[curRank] = index;
+    line_ptr->rank[index] = curRank;
+
+    // VERIFY
+    if ((curRank > 0 && get_line_key(line_ptr, line_ptr->order[curRank - 1]) == key)
+        || (curRank < line_ptr->numOrdered - 1 && get_line_key(line_ptr, line_ptr->order[curRank + 1]) == key))
+    {
+        HARKLE_ERROR(Harkleline, restore_line_order, Found duplicate coordinates along the line);
+        success = false;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Find the point at swarm store index 'index's neighbours and the midpoint between them
+    INPUT
+        line_ptr - Pointer to a line engine
+        index - Swarm store index of the point
+        useInts - If true, lowInt_ptr and highInt_ptr are treated as points
+        lowInt_ptr - Intercept with the lower sort key
+        highInt_ptr - Intercept with the higher sort key
+        midPnt_ptr - Out parameter for the midpoint
+    OUTPUT
+        1 if the point has a neighbour on both sides (and midPnt_ptr holds the midpoint)
+        0 if the point is at the end of the line (and never moves)
+        -1 on error
+    NOTES
+        This is find_closest_points() + determine_mid_point() for line engines
+        This function does not perform input validation
+ */
+int find_line_target(hsLine_ptr line_ptr, int index, bool useInts, hsLineLen_ptr lowInt_ptr,
+                     hsLineLen_ptr highInt_ptr, hsLineLen_ptr midPnt_ptr)
+{
+    // LOCAL VARIABLES
+    int retVal = 0;                              // Number of neighbours found
+    hsSwarm_ptr swarm_ptr = line_ptr->swarm_ptr; // Swarm store
+    int curRank = line_ptr->rank[index];         // Position of index along the line
+    int srcKey = get_line_key(line_ptr, index);  // Sort key of index
+    bool lowFound = false;                       // Found a 'lower' neighbour
+    bool highFound = false;                      // Found a 'higher' neighbour
+    hsLineLen lowNeigh = { 0, 0, 0.0 };          // 'Lower' neighbour
+    hsLineLen highNeigh = { 0, 0, 0.0 };         // 'Higher' neighbour
+
+    // 1. Find closest points
+    if (curRank > 0)
+    {
+        lowNeigh.xCoord = swarm_ptr->absX[line_ptr->order[curRank - 1]];
+        lowNeigh.yCoord = swarm_ptr->absY[line_ptr->order[curRank - 1]];
+        lowFound = true;
+    }
+    if (curRank < line_ptr->numOrdered - 1)
+    {
+        highNeigh.xCoord = swarm_ptr->absX[line_ptr->order[curRank + 1]];
+        highNeigh.yCoord = swarm_ptr->absY[line_ptr->order[curRank + 1]];
+        highFound = true;
+    }
+    if (true == useInts)
+    {
+        consider_line_intercept(line_ptr, srcKey, lowInt_ptr, &lowNeigh, &lowFound, &highNeigh, &highFound);
+        consider_line_intercept(line_ptr, srcKey, highInt_ptr, &lowNeigh, &lowFound, &highNeigh, &highFound);
+    }
+
+    // 2. Calculate center
+    if (true == lowFound && true == highFound)
+    {
+        if (false == determine_mid_point(&lowNeigh, &highNeigh, midPnt_ptr, 0))
+        {
+            HARKLE_ERROR(Harkleline, find_line_target, determine_mid_point failed);
+            retVal = -1;
+        }
+        else
+        {
+            retVal = 1;
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Move the point at swarm store index 'index' toward equilibrium
+    INPUT
+        curWindow - Pointer to a winDetails struct
+        line_ptr - Pointer to a line engine
+        index - Swarm store index of the point to move
+        maxMoves - Number of one-dimensional moves the point may move
+        useInts - If true, lowInt_ptr and highInt_ptr are treated as points
+        lowInt_ptr - Intercept with the lower sort key
+        highInt_ptr - Intercept with the higher sort key
+    OUTPUT
+        On success, number of moves made
+        On failure, -1
+    NOTES
+        This is the swarm store equivalent of shwarm_one_dim()
+        This function does not perform input validation
+ */
+int shwarm_line_index(winDetails_ptr curWindow, hsLine_ptr line_ptr, int index, int maxMoves, bool useInts,
+                      hsLineLen_ptr lowInt_ptr, hsLineLen_ptr highInt_ptr)
+{
+    // LOCAL VARIABLES
+    int numMoves = -1;                           // Number of moves made
+    bool success = true;                         // Prove this wrong
+    hsSwarm_ptr swarm_ptr = line_ptr->swarm_ptr; // Swarm store
+    int found = 0;                               // Return value from find_line_target()
+    hsLineLen midPnt = { 0, 0, 0.0 };            // Midpoint between the neighbours
+    shawarma srcNode;                            // Stack copy of the point, to clear it from the window
+
+    // 1. Find closest points and calculate center
+    found = find_line_target(line_ptr, index, useInts, lowInt_ptr, highInt_ptr, &midPnt);
+
+    // 2. End of the line doesn't move
+    if (0 == found)
+    {
+        numMoves = 0;
+    }
+    else
+    {
+        success = (0 < found) ? true : false;
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_index, find_line_target failed);
+        }
+        else
+        {
+            memset(&srcNode, 0x0, sizeof(srcNode));
+            srcNode.absX = swarm_ptr->absX[index];
+            srcNode.absY = swarm_ptr->absY[index];
+            srcNode.posNum = swarm_ptr->posNum[index];
+            srcNode.graphic = swarm_ptr->graphic[index];
+            srcNode.hcFlags = swarm_ptr->hcFlags[index];
+        }
+
+        // 3. Clear the old point
+        if (true == success && curWindow->win_ptr)
+        {
+            success = clear_this_coord(curWindow, &srcNode);
+
+            if (false == success)
+            {
+                HARKLE_ERROR(Harkleline, shwarm_line_index, clear_this_coord failed);
+            }
+        }
+
+        // 4. Move the point closer, along the line
+        if (true == success)
+        {
+            numMoves = calc_line_move(line_ptr, index, midPnt.xCoord, midPnt.yCoord, maxMoves,
+                                      &(srcNode.absX), &(srcNode.absY));
+
+            if (numMoves > 0)
+            {
+                if (false == move_swarm_point(swarm_ptr, index, srcNode.absX, srcNode.absY))
+                {
+                    HARKLE_ERROR(Harkleline, shwarm_line_index, move_swarm_point failed);
+                    numMoves = -1;
+                }
+                // 5. Keep the line sorted
+                else if (false == restore_line_order(line_ptr, index))
+                {
+                    HARKLE_ERROR(Harkleline, shwarm_line_index, restore_line_order failed);
+                    numMoves = -1;
+                }
+            }
+        }
+    }
+
+    // DONE
+    return numMoves;
+}
+
+
+/*
+    PURPOSE - Move the point at swarm store index 'index' toward its target without passing its neighbours
+    INPUT
+        curWindow - Pointer to a winDetails struct
+        line_ptr - Pointer to a line engine with targets
+        index - Swarm store index of the point to move
+        maxMoves - Number of one-dimensional moves the point may move
+    OUTPUT
+        On success, number of moves made (0 if the point is blocked or already on target)
+        On failure, -1
+    NOTES
+        This function does not perform input validation
+ */
+int animate_line_index(winDetails_ptr curWindow, hsLine_ptr line_ptr, int index, int maxMoves)
+{
+    // LOCAL VARIABLES
+    int numMoves = 0;                            // Number of moves made
+    hsSwarm_ptr swarm_ptr = line_ptr->swarm_ptr; // Swarm store
+    int curRank = line_ptr->rank[index];         // Position of index along the line
+    int newKey = 0;                              // Sort key after the move
+    hsLineLen dstCoord = { 0, 0, 0.0 };          // Target coordinates
+    shawarma oldNode;                            // Stack copy of the point before the move
+    shawarma newNode;                            // Stack copy of the point after the move
+
+    // SETUP
+    dstCoord.xCoord = line_ptr->targetX[index];
+    dstCoord.yCoord = line_ptr->targetY[index];
+    memset(&oldNode, 0x0, sizeof(oldNode));
+    oldNode.absX = swarm_ptr->absX[index];
+    oldNode.absY = swarm_ptr->absY[index];
+    newNode = oldNode;
+
+    // MOVE
+    numMoves = calc_line_move(line_ptr, index, dstCoord.xCoord, dstCoord.yCoord, maxMoves,
+                              &(newNode.absX), &(newNode.absY));
+
+    if (numMoves > 0)
+    {
+        // Don't pass (or land on) a neighbour
+        newKey = (true == line_ptr->vertLine) ? newNode.absY : newNode.absX;
+
+        if ((curRank > 0 && newKey <= get_line_key(line_ptr, line_ptr->order[curRank - 1]))
+            || (curRank < line_ptr->numOrdered - 1
+                && newKey >= get_line_key(line_ptr, line_ptr->order[curRank + 1])))
+        {
+            numMoves = 0;  // Blocked, for now
+        }
+        else if (curWindow->win_ptr && false == clear_this_coord(curWindow, &oldNode))
+        {
+            HARKLE_ERROR(Harkleline, animate_line_index, clear_this_coord failed);
+            numMoves = -1;
+        }
+        else if (false == move_swarm_point(swarm_ptr, index, newNode.absX, newNode.absY))
+        {
+            HARKLE_ERROR(Harkleline, animate_line_index, move_swarm_point failed);
+            numMoves = -1;
+        }
+    }
+
+    // DONE
+    return numMoves;
+}
+
+
+/*
+    PURPOSE - Make sure a line engine's active set can track every point
+    INPUT
+        line_ptr - Pointer to a line engine
+    OUTPUT
+        On success, true
+        On failure, false (and the active set is invalid)
+    NOTES
+        Growing the arrays discards the active set so the next sweep starts with every point active
+        This function does not perform input validation
+ */
+bool prepare_active_set(hsLine_ptr line_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    if (line_ptr->maxActive < line_ptr->numOrdered)
+    {
+        line_ptr->activeValid = false;
+        line_ptr->maxActive = 0;
+
+        if (line_ptr->activeMark)
+        {
+            free(line_ptr->activeMark);
+        }
+        if (line_ptr->activeHeap)
+        {
+            free(line_ptr->activeHeap);
+        }
+        if (line_ptr->activeNext)
+        {
+            free(line_ptr->activeNext);
+        }
+
+        line_ptr->activeMark = calloc(line_ptr->maxOrdered, sizeof(char));
+        line_ptr->activeHeap = calloc(line_ptr->maxOrdered, sizeof(int));
+        line_ptr->activeNext = calloc(line_ptr->maxOrdered, sizeof(int));
+
+        if (!(line_ptr->activeMark) || !(line_ptr->activeHeap) || !(line_ptr->activeNext))
+        {
+            HARKLE_ERROR(Harkleline, prepare_active_set, calloc failed);
+            success = false;
+        }
+        else
+        {
+            line_ptr->maxActive = line_ptr->maxOrdered;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Add a swarm store index to the current sweep's min-heap
+    INPUT
+        line_ptr - Pointer to a line engine
+        index - Swarm store index to add
+    NOTES
+        This function does not perform input validation
+ */
+void push_active_heap(hsLine_ptr line_ptr, int index)
+{
+    // LOCAL VARIABLES
+    int *heap_arr = line_ptr->activeHeap;  // Min-heap
+    int child = line_ptr->numHeap;         // Position of the new entry
+    int parent = 0;                        // Position of child's parent
+
+    // SIFT UP
+    while (child > 0)
+    {
+        parent = (child - 1) / 2;
+
+        if (heap_arr[parent] <= index)
+        {
+            break;
+        }
+
+        heap_arr[child] = heap_arr[parent];
+        child = parent;
+    }
+
+    heap_arr[child] = index;
+    line_ptr->numHeap++;
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Remove the smallest swarm store index from the current sweep's min-heap
+    INPUT
+        line_ptr - Pointer to a line engine with a non-empty heap
+    OUTPUT
+        The smallest swarm store index in the heap
+    NOTES
+        This function does not perform input validation
+ */
+int pop_active_heap(hsLine_ptr line_ptr)
+{
+    // LOCAL VARIABLES
+    int *heap_arr = line_ptr->activeHeap;  // Min-heap
+    int retVal = heap_arr[0];              // Smallest index
+    int last = 0;                          // Entry that replaces the root
+    int parent = 0;                        // Position last is sifting down from
+    int child = 0;                         // Smaller child of parent
+
+    // SIFT DOWN
+    line_ptr->numHeap--;
+    last = heap_arr[line_ptr->numHeap];
+
+    while ((2 * parent) + 1 < line_ptr->numHeap)
+    {
+        child = (2 * parent) + 1;
+
+        if (child + 1 < line_ptr->numHeap && heap_arr[child + 1] < heap_arr[child])
+        {
+            child++;
+        }
+        if (last <= heap_arr[child])
+        {
+            break;
+        }
+
+        heap_arr[parent] = heap_arr[child];
+        parent = child;
+    }
+
+    heap_arr[parent] = last;
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Mark a point as needing evaluation because it, or one of its neighbours, just moved
+    INPUT
+        line_ptr - Pointer to a line engine
+        index - Swarm store index to activate (-1 is ignored, for missing neighbours)
+        curIndex - Swarm store index currently being evaluated
+    NOTES
+        Indices after curIndex are still evaluated in the current sweep, just like a full sweep would.
+            Everything else waits for the next sweep.
+        This function does not perform input validation
+ */
+void activate_line_index(hsLine_ptr line_ptr, int index, int curIndex)
+{
+    if (0 <= index && HS_LINE_IDLE == line_ptr->activeMark[index])
+    {
+        if (index > curIndex)
+        {
+            line_ptr->activeMark[index] = HS_LINE_ACTIVE_NOW;
+            push_active_heap(line_ptr, index);
+        }
+        else
+        {
+            line_ptr->activeMark[index] = HS_LINE_ACTIVE_NEXT;
+            line_ptr->activeNext[line_ptr->numNext] = index;
+            line_ptr->numNext++;
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Load the current sweep's heap with every point that might move
+    INPUT
+        line_ptr - Pointer to a line engine
+        useInts - If true, lowInt_ptr and highInt_ptr are treated as points
+        lowInt_ptr - Intercept with the lower sort key
+        highInt_ptr - Intercept with the higher sort key
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        If the active set is invalid, or the intercepts changed since it was tracked, every point is active
+        This function does not perform input validation
+ */
+bool start_active_sweep(hsLine_ptr line_ptr, bool useInts, hsLineLen_ptr lowInt_ptr, hsLineLen_ptr highInt_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    int i = 0;            // Iterating variable
+
+    if (false == prepare_active_set(line_ptr))
+    {
+        HARKLE_ERROR(Harkleline, start_active_sweep, prepare_active_set failed);
+        success = false;
+    }
+    else if (false == line_ptr->activeValid || useInts != line_ptr->activeInts
+             || (true == useInts && (lowInt_ptr->xCoord != line_ptr->activeLowInt.xCoord
+                                     || lowInt_ptr->yCoord != line_ptr->activeLowInt.yCoord
+                                     || highInt_ptr->xCoord != line_ptr->activeHighInt.xCoord
+                                     || highInt_ptr->yCoord != line_ptr->activeHighInt.yCoord)))
+    {
+        // Everything is active (ascending order is already a valid min-heap)
+        for (i = 0; i < line_ptr->numOrdered; i++)
+        {
+            line_ptr->activeMark[i] = HS_LINE_ACTIVE_NOW;
+            line_ptr->activeHeap[i] = i;
+        }
+
+        line_ptr->numHeap = line_ptr->numOrdered;
+        line_ptr->numNext = 0;
+        line_ptr->activeInts = useInts;
+        line_ptr->activeLowInt = *lowInt_ptr;
+        line_ptr->activeHighInt = *highInt_ptr;
+        line_ptr->activeValid = true;
+        line_ptr->residualsValid = false;
+    }
+    else
+    {
+        // Whatever was activated for this sweep during the last one
+        line_ptr->numHeap = 0;
+
+        for (i = 0; i < line_ptr->numNext; i++)
+        {
+            line_ptr->activeMark[line_ptr->activeNext[i]] = HS_LINE_ACTIVE_NOW;
+            push_active_heap(line_ptr, line_ptr->activeNext[i]);
+        }
+
+        line_ptr->numNext = 0;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Record a new residual for a point and keep the engine's totals in sync
+    INPUT
+        line_ptr - Pointer to a line engine with residuals
+        index - Swarm store index of the point
+        newResidual - The point's new residual
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        resCount is a histogram of residuals so the maximum only has to walk down past empty buckets
+            when the last point with the maximum residual improves
+        This function does not perform input validation
+ */
+bool set_line_residual(hsLine_ptr line_ptr, int index, int newResidual)
+{
+    // LOCAL VARIABLES
+    bool success = true;                           // Set this to false if anything fails
+    hsLineStats_ptr stats_ptr = &(line_ptr->sweepStats);  // Totals
+    int oldResidual = line_ptr->residual[index];   // The point's current residual
+    long *tmp_ptr = NULL;                          // Return value from realloc()
+    int newMax = 0;                                // New capacity of resCount
+
+    // GROW THE HISTOGRAM
+    if (newResidual >= line_ptr->maxResCount)
+    {
+        newMax = (2 * line_ptr->maxResCount > newResidual + 1) ? 2 * line_ptr->maxResCount : newResidual + 1;
+        tmp_ptr = realloc(line_ptr->resCount, newMax * sizeof(long));
+
+        if (!tmp_ptr)
+        {
+            HARKLE_ERROR(Harkleline, set_line_residual, realloc failed);
+            success = false;
+        }
+        else
+        {
+            memset(tmp_ptr + line_ptr->maxResCount, 0x0, (newMax - line_ptr->maxResCount) * sizeof(long));
+            line_ptr->resCount = tmp_ptr;
+            line_ptr->maxResCount = newMax;
+        }
+    }
+
+    // UPDATE
+    if (true == success && oldResidual != newResidual)
+    {
+        line_ptr->resCount[oldResidual]--;
+        line_ptr->resCount[newResidual]++;
+        line_ptr->residual[index] = newResidual;
+        stats_ptr->totResidual += newResidual - oldResidual;
+
+        if (0 == oldResidual)
+        {
+            stats_ptr->numUnsettled++;
+        }
+        else if (0 == newResidual)
+        {
+            stats_ptr->numUnsettled--;
+        }
+
+        if (newResidual > stats_ptr->maxResidual)
+        {
+            stats_ptr->maxResidual = newResidual;
+        }
+
+        while (stats_ptr->maxResidual > 0 && 0 == line_ptr->resCount[stats_ptr->maxResidual])
+        {
+            stats_ptr->maxResidual--;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Recalculate one point's residual
+    INPUT
+        line_ptr - Pointer to a line engine with residuals
+        index - Swarm store index of the point (-1 is ignored, for missing neighbours)
+        useInts - If true, lowInt_ptr and highInt_ptr are treated as points
+        lowInt_ptr - Intercept with the lower sort key
+        highInt_ptr - Intercept with the higher sort key
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This function does not perform input validation
+ */
+bool update_line_residual(hsLine_ptr line_ptr, int index, bool useInts, hsLineLen_ptr lowInt_ptr,
+                          hsLineLen_ptr highInt_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;               // Set this to false if anything fails
+    int found = 0;                     // Return value from find_line_target()
+    int newResidual = 0;               // The point's residual
+    hsLineLen midPnt = { 0, 0, 0.0 };  // Midpoint between the point's neighbours
+
+    if (0 <= index)
+    {
+        found = find_line_target(line_ptr, index, useInts, lowInt_ptr, highInt_ptr, &midPnt);
+
+        if (0 > found)
+        {
+            HARKLE_ERROR(Harkleline, update_line_residual, find_line_target failed);
+            success = false;
+        }
+        else
+        {
+            if (0 < found)
+            {
+                newResidual = abs(project_onto_line(line_ptr, midPnt.xCoord, midPnt.yCoord)
+                                  - project_onto_line(line_ptr, line_ptr->swarm_ptr->absX[index],
+                                                      line_ptr->swarm_ptr->absY[index]));
+            }
+
+            success = set_line_residual(line_ptr, index, newResidual);
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Calculate every point's residual from scratch
+    INPUT
+        line_ptr - Pointer to a line engine
+        See: update_line_residual()
+    OUTPUT
+        On success, true (and residualsValid is true)
+        On failure, false
+    NOTES
+        This function does not perform input validation
+ */
+bool rebuild_line_residuals(hsLine_ptr line_ptr, bool useInts, hsLineLen_ptr lowInt_ptr, hsLineLen_ptr highInt_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    int i = 0;            // Iterating variable
+
+    // ALLOCATE
+    line_ptr->residualsValid = false;
+
+    if (line_ptr->maxTracked < line_ptr->numOrdered)
+    {
+        if (line_ptr->residual)
+        {
+            free(line_ptr->residual);
+        }
+
+        line_ptr->maxTracked = 0;
+        line_ptr->residual = calloc(line_ptr->maxOrdered, sizeof(int));
+
+        if (!(line_ptr->residual))
+        {
+            HARKLE_ERROR(Harkleline, rebuild_line_residuals, calloc failed);
+            success = false;
+        }
+        else
+        {
+            line_ptr->maxTracked = line_ptr->maxOrdered;
+        }
+    }
+    if (true == success && 0 == line_ptr->maxResCount)
+    {
+        line_ptr->resCount = calloc(1, sizeof(long));
+
+        if (!(line_ptr->resCount))
+        {
+            HARKLE_ERROR(Harkleline, rebuild_line_residuals, calloc failed);
+            success = false;
+        }
+        else
+        {
+            line_ptr->maxResCount = 1;
+        }
+    }
+
+    // RESET (every point starts with a residual of 0)
+    if (true == success)
+    {
+        memset(line_ptr->residual, 0x0, line_ptr->numOrdered * sizeof(int));
+        memset(line_ptr->resCount, 0x0, line_ptr->maxResCount * sizeof(long));
+        line_ptr->resCount[0] = line_ptr->numOrdered;
+        line_ptr->sweepStats.totResidual = 0;
+        line_ptr->sweepStats.maxResidual = 0;
+        line_ptr->sweepStats.numUnsettled = 0;
+    }
+
+    // CALCULATE
+    for (i = 0; i < line_ptr->numOrdered && true == success; i++)
+    {
+        success = update_line_residual(line_ptr, i, useInts, lowInt_ptr, highInt_ptr);
+    }
+
+    line_ptr->residualsValid = success;
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Make sure a line engine's Jacobi sweep buffers can hold every point
+    INPUT
+        line_ptr - Pointer to a line engine
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The buffers are only ever grown, and their contents never need to survive a sweep, so they are
+            simply reallocated
+        This function does not perform input validation
+ */
+bool prepare_jacobi_buffers(hsLine_ptr line_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    int **buf_arr[] = { &(line_ptr->snapX), &(line_ptr->snapY), &(line_ptr->nextX), &(line_ptr->nextY),
+                        &(line_ptr->nextMoves), NULL };
+    int i = 0;            // Iterating variable
+
+    if (line_ptr->maxJacobi < line_ptr->numOrdered)
+    {
+        for (i = 0; NULL != buf_arr[i] && true == success; i++)
+        {
+            if (*(buf_arr[i]))
+            {
+                free(*(buf_arr[i]));
+            }
+
+            *(buf_arr[i]) = calloc(line_ptr->maxOrdered, sizeof(int));
+
+            if (!(*(buf_arr[i])))
+            {
+                HARKLE_ERROR(Harkleline, prepare_jacobi_buffers, calloc failed);
+                success = false;
+            }
+        }
+
+        line_ptr->maxJacobi = (true == success) ? line_ptr->maxOrdered : 0;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Jacobi sweep phase 1: freeze ranks [first, last) of the swarm into the snapshot buffer
+    INPUT
+        See: hsPoolJob
+    OUTPUT
+        true
+    NOTES
+        The snapshot is stored in rank order so phase 2 reads each point's neighbours sequentially
+ */
+bool snapshot_jacobi_chunk(void *jobArg, int first, int last, int workerNum)
+{
+    // LOCAL VARIABLES
+    hsLine_ptr line_ptr = ((hsJacobiJob_ptr)jobArg)->line_ptr;  // Line engine
+    int rank = 0;                                               // Iterating variable
+
+    (void)workerNum;  // Every worker snapshots its own ranks
+
+    for (rank = first; rank < last; rank++)
+    {
+        line_ptr->snapX[rank] = line_ptr->swarm_ptr->absX[line_ptr->order[rank]];
+        line_ptr->snapY[rank] = line_ptr->swarm_ptr->absY[line_ptr->order[rank]];
+    }
+
+    // DONE
+    return true;
+}
+
+
+/*
+    PURPOSE - Jacobi sweep phase 2: propose a move for ranks [first, last) from the snapshot
+    INPUT
+        See: hsPoolJob
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This is shwarm_line_index() reading the snapshot and writing the proposal buffer instead of the
+            swarm store.  Only ranks of the job's parity propose a move so neither neighbour of a moving
+            point moves in the same phase.  A proposal that doesn't land strictly between the snapshot
+            positions of its neighbours is discarded.
+ */
+bool propose_jacobi_chunk(void *jobArg, int first, int last, int workerNum)
+{
+    // LOCAL VARIABLES
+    bool success = true;                            // Set this to false if anything fails
+    hsJacobiJob_ptr job_ptr = (hsJacobiJob_ptr)jobArg;  // Job
+    hsLine_ptr line_ptr = job_ptr->line_ptr;        // Line engine
+    int *snapKey_arr = (true == line_ptr->vertLine) ? line_ptr->snapY : line_ptr->snapX;  // Sort keys
+    int newKey = 0;                                 // Sort key of the proposal
+    int rank = 0;                                   // Iterating variable
+    bool lowFound = false;                          // Found a 'lower' neighbour
+    bool highFound = false;                         // Found a 'higher' neighbour
+    hsLineLen lowNeigh = { 0, 0, 0.0 };             // 'Lower' neighbour
+    hsLineLen highNeigh = { 0, 0, 0.0 };            // 'Higher' neighbour
+    hsLineLen midPnt = { 0, 0, 0.0 };               // Out parameter for determine_mid_point()
+
+    (void)workerNum;  // Proposals only write their own ranks so no per-worker state is needed
+
+    for (rank = first; rank < last && true == success; rank++)
+    {
+        // 1. Stay put unless a move is proposed
+        line_ptr->nextX[rank] = line_ptr->snapX[rank];
+        line_ptr->nextY[rank] = line_ptr->snapY[rank];
+        line_ptr->nextMoves[rank] = 0;
+
+        if ((rank & 1) != job_ptr->parity)
+        {
+            continue;  // Its neighbours are moving this phase
+        }
+
+        // 2. Find closest points
+        lowFound = false;
+        highFound = false;
+
+        if (rank > 0)
+        {
+            lowNeigh.xCoord = line_ptr->snapX[rank - 1];
+            lowNeigh.yCoord = line_ptr->snapY[rank - 1];
+            lowFound = true;
+        }
+        if (rank < line_ptr->numOrdered - 1)
+        {
+            highNeigh.xCoord = line_ptr->snapX[rank + 1];
+            highNeigh.yCoord = line_ptr->snapY[rank + 1];
+            highFound = true;
+        }
+        if (true == job_ptr->useInts)
+        {
+            consider_line_intercept(line_ptr, snapKey_arr[rank], &(job_ptr->lowInt), &lowNeigh, &lowFound,
+                                    &highNeigh, &highFound);
+            consider_line_intercept(line_ptr, snapKey_arr[rank], &(job_ptr->highInt), &lowNeigh, &lowFound,
+                                    &highNeigh, &highFound);
+        }
+
+        // 3. End of the line doesn't move
+        if (true == lowFound && true == highFound)
+        {
+            // 4. Calculate center
+            if (false == determine_mid_point(&lowNeigh, &highNeigh, &midPnt, 0))
+            {
+                HARKLE_ERROR(Harkleline, propose_jacobi_chunk, determine_mid_point failed);
+                success = false;
+            }
+            else
+            {
+                // 5. Propose a move closer, along the line
+                line_ptr->nextMoves[rank] = calc_line_step(line_ptr, line_ptr->snapX[rank], line_ptr->snapY[rank],
+                                                           midPnt.xCoord, midPnt.yCoord, job_ptr->maxMoves,
+                                                           &(line_ptr->nextX[rank]), &(line_ptr->nextY[rank]));
+                newKey = (true == line_ptr->vertLine) ? line_ptr->nextY[rank] : line_ptr->nextX[rank];
+
+                // 6. Never reach a neighbour's snapshot position
+                if ((rank > 0 && newKey <= snapKey_arr[rank - 1])
+                    || (rank < line_ptr->numOrdered - 1 && newKey >= snapKey_arr[rank + 1]))
+                {
+                    line_ptr->nextX[rank] = line_ptr->snapX[rank];
+                    line_ptr->nextY[rank] = line_ptr->snapY[rank];
+                    line_ptr->nextMoves[rank] = 0;
+                }
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Jacobi sweep phase 3: commit the proposals for ranks [first, last)
+    INPUT
+        See: hsPoolJob
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Neighbours never move in the same phase so every proposal is committed and the order along the line
+            never changes.  The snapshot is updated too so the next phase sees the move.
+        Proposals are committed to the swarm store if the job says so.  Otherwise, the calling thread
+            commits them afterwards.
+ */
+bool commit_jacobi_chunk(void *jobArg, int first, int last, int workerNum)
+{
+    // LOCAL VARIABLES
+    bool success = true;                            // Set this to false if anything fails
+    hsJacobiJob_ptr job_ptr = (hsJacobiJob_ptr)jobArg;  // Job
+    hsLine_ptr line_ptr = job_ptr->line_ptr;        // Line engine
+    long numMoves = 0;                              // Moves accepted in this chunk
+    int rank = 0;                                   // Iterating variable
+
+    for (rank = first; rank < last && true == success; rank++)
+    {
+        if (0 < line_ptr->nextMoves[rank])
+        {
+            numMoves += line_ptr->nextMoves[rank];
+            line_ptr->snapX[rank] = line_ptr->nextX[rank];
+            line_ptr->snapY[rank] = line_ptr->nextY[rank];
+
+            if (true == job_ptr->commitMoves
+                && false == move_swarm_point(line_ptr->swarm_ptr, line_ptr->order[rank],
+                                             line_ptr->nextX[rank], line_ptr->nextY[rank]))
+            {
+                HARKLE_ERROR(Harkleline, commit_jacobi_chunk, move_swarm_point failed);
+                success = false;
+            }
+        }
+    }
+
+    job_ptr->workerMoves[workerNum] += numMoves;
+
+    // DONE
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsLine_ptr build_line_engine(hsSwarm_ptr swarm_ptr)
+{
+    // LOCAL VARIABLES
+    hsLine_ptr retVal = NULL;         // Line engine to return
+    bool success = true;              // Set this to false if anything fails
+    hsLineKey_ptr key_arr = NULL;     // Temporary (key, index) array to sort
+    int stepGcd = 0;                  // Greatest common divisor of the first step's components
+    int i = 0;                        // Iterating variable
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harkleline, build_line_engine, Invalid swarm_ptr);
+        success = false;
+    }
+    else if (2 > swarm_ptr->numPnts)
+    {
+        HARKLE_ERROR(Harkleline, build_line_engine, Too few points to determine direction);
+        success = false;
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsLine));
+        key_arr = calloc(swarm_ptr->numPnts, sizeof(hsLineKey));
+
+        if (!retVal || !key_arr)
+        {
+            HARKLE_ERROR(Harkleline, build_line_engine, calloc failed);
+            success = false;
+        }
+        else
+        {
+            retVal->swarm_ptr = swarm_ptr;
+            retVal->numOrdered = swarm_ptr->numPnts;
+            retVal->maxOrdered = swarm_ptr->numPnts;
+            retVal->order = calloc(swarm_ptr->numPnts, sizeof(int));
+            retVal->rank = calloc(swarm_ptr->numPnts, sizeof(int));
+
+            if (!(retVal->order) || !(retVal->rank))
+            {
+                HARKLE_ERROR(Harkleline, build_line_engine, calloc failed);
+                success = false;
+            }
+        }
+    }
+
+    // DETERMINE THE LINE
+    if (true == success)
+    {
+        retVal->vertLine = (swarm_ptr->absX[0] == swarm_ptr->absX[1]) ? true : false;
+        retVal->anchorX = swarm_ptr->absX[0];
+        retVal->anchorY = swarm_ptr->absY[0];
+        retVal->intCache.valid = false;
+
+        // Smallest integer step, pointing toward increasing sort keys
+        retVal->stepX = swarm_ptr->absX[1] - swarm_ptr->absX[0];
+        retVal->stepY = swarm_ptr->absY[1] - swarm_ptr->absY[0];
+        stepGcd = calc_int_gcd(retVal->stepX, retVal->stepY);
+
+        if (0 == stepGcd)
+        {
+            HARKLE_ERROR(Harkleline, build_line_engine, Found duplicate coordinates along the line);
+            success = false;
+        }
+        else
+        {
+            retVal->stepX /= stepGcd;
+            retVal->stepY /= stepGcd;
+
+            if ((true == retVal->vertLine && retVal->stepY < 0) || (false == retVal->vertLine && retVal->stepX < 0))
+            {
+                retVal->stepX = -(retVal->stepX);
+                retVal->stepY = -(retVal->stepY);
+            }
+        }
+    }
+
+    // VERIFY LINE
+    if (true == success && false == verify_line_engine(retVal))
+    {
+        HARKLE_ERROR(Harkleline, build_line_engine, Provided points are not in a line);
+        success = false;
+    }
+
+    // SORT ALONG THE LINE
+    if (true == success)
+    {
+        for (i = 0; i < swarm_ptr->numPnts; i++)
+        {
+            key_arr[i].key = get_line_key(retVal, i);
+            key_arr[i].index = i;
+        }
+
+        qsort(key_arr, swarm_ptr->numPnts, sizeof(hsLineKey), compare_line_keys);
+
+        for (i = 0; i < swarm_ptr->numPnts; i++)
+        {
+            if (i > 0 && key_arr[i].key == key_arr[i - 1].key)
+            {
+                HARKLE_ERROR(Harkleline, build_line_engine, Found duplicate coordinates along the line);
+                success = false;
+                break;
+            }
+            retVal->order[i] = key_arr[i].index;
+            retVal->rank[key_arr[i].index] = i;
+        }
+    }
+
+    // CLEAN UP
+    if (key_arr)
+    {
+        free(key_arr);
+        key_arr = NULL;
+    }
+    if (false == success && retVal)
+    {
+        free_line_engine(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int shwarm_line_point(winDetails_ptr curWindow, hsLine_ptr line_ptr, int maxMoves, int srcNum, bool intercepts)
+{
+    // LOCAL VARIABLES
+    int numMoves = -1;                   // Store the return value from helper functions here
+    int index = -1;                      // Swarm store index of srcNum
+    hsLineLen lowInt = { 0, 0, 0.0 };    // Intercept with the lower sort key
+    hsLineLen highInt = { 0, 0, 0.0 };   // Intercept with the higher sort key
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_point, Invalid curWindow);
+    }
+    else if (!line_ptr || !(line_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_point, Invalid line_ptr);
+    }
+    else if (maxMoves < 1)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_point, Invalid maxMoves);
+    }
+    else
+    {
+        index = get_swarm_index(line_ptr->swarm_ptr, srcNum);
+
+        if (0 > index)
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_point, get_swarm_index failed);
+        }
+        else if (true == intercepts && false == calc_line_engine_intercepts(curWindow, line_ptr, &lowInt, &highInt))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_point, calc_line_engine_intercepts failed);
+        }
+        else
+        {
+            // SWARM
+            numMoves = shwarm_line_index(curWindow, line_ptr, index, maxMoves, intercepts, &lowInt, &highInt);
+            line_ptr->activeValid = false;
+
+            if (0 > numMoves)
+            {
+                HARKLE_ERROR(Harkleline, shwarm_line_point, shwarm_line_index failed);
+            }
+        }
+    }
+
+    // DONE
+    return numMoves;
+}
+
+
+long shwarm_line_sweep(winDetails_ptr curWindow, hsLine_ptr line_ptr, int maxMoves, bool intercepts)
+{
+    // LOCAL VARIABLES
+    long totMoves = -1;                  // Total number of moves made
+    int numMoves = 0;                    // Number of moves made by one point
+    int index = 0;                       // Swarm store index being evaluated
+    int oldLow = -1;                     // Swarm store index of the 'lower' neighbour before the move
+    int oldHigh = -1;                    // Swarm store index of the 'higher' neighbour before the move
+    int curRank = 0;                     // Rank of index
+    int newLow = -1;                     // Swarm store index of the 'lower' neighbour after the move
+    int newHigh = -1;                    // Swarm store index of the 'higher' neighbour after the move
+    int numEvaluated = 0;                // Number of points evaluated
+    int numMoved = 0;                    // Number of points that moved
+    hsLineLen lowInt = { 0, 0, 0.0 };    // Intercept with the lower sort key
+    hsLineLen highInt = { 0, 0, 0.0 };   // Intercept with the higher sort key
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_sweep, Invalid curWindow);
+    }
+    else if (!line_ptr || !(line_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_sweep, Invalid line_ptr);
+    }
+    else if (maxMoves < 1)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_sweep, Invalid maxMoves);
+    }
+    else if (true == intercepts && false == calc_line_engine_intercepts(curWindow, line_ptr, &lowInt, &highInt))
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_sweep, calc_line_engine_intercepts failed);
+    }
+    else if (false == start_active_sweep(line_ptr, intercepts, &lowInt, &highInt))
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_sweep, start_active_sweep failed);
+    }
+    else if (true == line_ptr->trackResiduals && false == line_ptr->residualsValid
+             && false == rebuild_line_residuals(line_ptr, intercepts, &lowInt, &highInt))
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_sweep, rebuild_line_residuals failed);
+    }
+    else
+    {
+        totMoves = 0;
+
+        // Active points, in swarm store order
+        while (0 < line_ptr->numHeap)
+        {
+            index = pop_active_heap(line_ptr);
+            line_ptr->activeMark[index] = HS_LINE_IDLE;
+            curRank = line_ptr->rank[index];
+            oldLow = (curRank > 0) ? line_ptr->order[curRank - 1] : -1;
+            oldHigh = (curRank < line_ptr->numOrdered - 1) ? line_ptr->order[curRank + 1] : -1;
+            numMoves = shwarm_line_index(curWindow, line_ptr, index, maxMoves, intercepts, &lowInt, &highInt);
+            numEvaluated++;
+
+            if (0 > numMoves)
+            {
+                HARKLE_ERROR(Harkleline, shwarm_line_sweep, shwarm_line_index failed);
+                line_ptr->activeValid = false;
+                totMoves = -1;
+                break;
+            }
+            else if (0 < numMoves)
+            {
+                // The point, and its neighbours (before and after the move), might move again
+                curRank = line_ptr->rank[index];
+                newLow = (curRank > 0) ? line_ptr->order[curRank - 1] : -1;
+                newHigh = (curRank < line_ptr->numOrdered - 1) ? line_ptr->order[curRank + 1] : -1;
+                activate_line_index(line_ptr, index, index);
+                activate_line_index(line_ptr, oldLow, index);
+                activate_line_index(line_ptr, oldHigh, index);
+                activate_line_index(line_ptr, newLow, index);
+                activate_line_index(line_ptr, newHigh, index);
+                numMoved++;
+
+                // They are also the only residuals the move could have changed
+                if (true == line_ptr->trackResiduals
+                    && (false == update_line_residual(line_ptr, index, intercepts, &lowInt, &highInt)
+                        || false == update_line_residual(line_ptr, oldLow, intercepts, &lowInt, &highInt)
+                        || false == update_line_residual(line_ptr, oldHigh, intercepts, &lowInt, &highInt)
+                        || false == update_line_residual(line_ptr, newLow, intercepts, &lowInt, &highInt)
+                        || false == update_line_residual(line_ptr, newHigh, intercepts, &lowInt, &highInt)))
+                {
+                    HARKLE_ERROR(Harkleline, shwarm_line_sweep, update_line_residual failed);
+                    line_ptr->residualsValid = false;
+                    totMoves = -1;
+                    break;
+                }
+            }
+
+            totMoves += numMoves;
+        }
+
+        // STATS
+        if (0 <= totMoves)
+        {
+            line_ptr->sweepStats.sweepNum++;
+            line_ptr->sweepStats.numMoves = totMoves;
+            line_ptr->sweepStats.numEvaluated = numEvaluated;
+            line_ptr->sweepStats.numMoved = numMoved;
+            line_ptr->sweepStats.hasResiduals = line_ptr->trackResiduals && line_ptr->residualsValid;
+        }
+
+#ifdef HS_DEBUG_VERIFY_LINE
+        if (totMoves > 0 && false == verify_line_engine(line_ptr))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_sweep, A point left the line);
+            totMoves = -1;
+        }
+#endif  // HS_DEBUG_VERIFY_LINE
+    }
+
+    // DONE
+    return totMoves;
+}
+
+
+bool track_line_equilibrium(hsLine_ptr line_ptr, bool enable)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the setting is changed
+
+    // INPUT VALIDATION
+    if (!line_ptr || !(line_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleline, track_line_equilibrium, Invalid line_ptr);
+    }
+    else
+    {
+        line_ptr->trackResiduals = enable;
+        line_ptr->residualsValid = false;
+        line_ptr->sweepStats.hasResiduals = false;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+long shwarm_line_jacobi_sweep(winDetails_ptr curWindow, hsLine_ptr line_ptr, hsPool_ptr pool_ptr, int maxMoves,
+                              bool intercepts)
+{
+    // LOCAL VARIABLES
+    long totMoves = -1;                  // Total number of moves made
+    bool success = true;                 // Set this to false if anything fails
+    hsJacobiJob job;                     // Shared by every chunk of every phase
+    shawarma oldNode;                    // Stack copy of a point before its move, to clear it from the window
+    int rank = 0;                        // Iterating variable
+    int i = 0;                           // Iterating variable
+
+    memset(&job, 0x0, sizeof(job));
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, Invalid curWindow);
+        success = false;
+    }
+    else if (!line_ptr || !(line_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, Invalid line_ptr);
+        success = false;
+    }
+    else if (!pool_ptr)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, Invalid pool_ptr);
+        success = false;
+    }
+    else if (maxMoves < 1)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, Invalid maxMoves);
+        success = false;
+    }
+
+    // SETUP
+    if (true == success)
+    {
+        job.line_ptr = line_ptr;
+        job.maxMoves = maxMoves;
+        job.useInts = intercepts;
+        job.commitMoves = (!(line_ptr->swarm_ptr->occupy_ptr) && !(curWindow->win_ptr)) ? true : false;
+        job.workerMoves = calloc(pool_ptr->numThreads, sizeof(long));
+
+        if (!(job.workerMoves))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, calloc failed);
+            success = false;
+        }
+        else if (false == prepare_jacobi_buffers(line_ptr))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, prepare_jacobi_buffers failed);
+            success = false;
+        }
+        else if (true == intercepts
+                 && false == calc_line_engine_intercepts(curWindow, line_ptr, &(job.lowInt), &(job.highInt)))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, calc_line_engine_intercepts failed);
+            success = false;
+        }
+    }
+
+    // SWEEP
+    // 1. Freeze the swarm
+    if (true == success && false == run_pool_job(pool_ptr, snapshot_jacobi_chunk, &job, line_ptr->numOrdered))
+    {
+        HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, Snapshot phase failed);
+        success = false;
+    }
+    // Even ranks move, then odd ranks, so no point ever moves at the same time as its neighbours
+    for (job.parity = 0; job.parity < 2 && true == success; job.parity++)
+    {
+        // 2. Propose moves from the snapshot
+        if (false == run_pool_job(pool_ptr, propose_jacobi_chunk, &job, line_ptr->numOrdered))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, Propose phase failed);
+            success = false;
+        }
+        // 3. Commit
+        if (true == success && false == run_pool_job(pool_ptr, commit_jacobi_chunk, &job, line_ptr->numOrdered))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, Commit phase failed);
+            success = false;
+        }
+        // 4. Commit on this thread if the workers couldn't
+        if (true == success && false == job.commitMoves)
+        {
+            memset(&oldNode, 0x0, sizeof(oldNode));
+
+            for (rank = job.parity; rank < line_ptr->numOrdered && true == success; rank += 2)
+            {
+                if (0 < line_ptr->nextMoves[rank])
+                {
+                    oldNode.absX = line_ptr->swarm_ptr->absX[line_ptr->order[rank]];
+                    oldNode.absY = line_ptr->swarm_ptr->absY[line_ptr->order[rank]];
+
+                    if (curWindow->win_ptr && false == clear_this_coord(curWindow, &oldNode))
+                    {
+                        HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, clear_this_coord failed);
+                        success = false;
+                    }
+                    else if (false == move_swarm_point(line_ptr->swarm_ptr, line_ptr->order[rank],
+                                                       line_ptr->nextX[rank], line_ptr->nextY[rank]))
+                    {
+                        HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, move_swarm_point failed);
+                        success = false;
+                    }
+                }
+            }
+        }
+    }
+    if (true == success)
+    {
+        line_ptr->activeValid = false;
+    }
+
+    // TALLY
+    if (true == success)
+    {
+        totMoves = 0;
+
+        for (i = 0; i < pool_ptr->numThreads; i++)
+        {
+            totMoves += job.workerMoves[i];
+        }
+
+#ifdef HS_DEBUG_VERIFY_LINE
+        if (totMoves > 0 && false == verify_line_engine(line_ptr))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_line_jacobi_sweep, A point left the line);
+            totMoves = -1;
+        }
+#endif  // HS_DEBUG_VERIFY_LINE
+    }
+
+    // CLEAN UP
+    if (job.workerMoves)
+    {
+        free(job.workerMoves);
+        job.workerMoves = NULL;
+    }
+
+    // DONE
+    return totMoves;
+}
+
+
+long shwarm_solve_one_dim(winDetails_ptr curWindow, hsLine_ptr line_ptr, bool intercepts, bool animate)
+{
+    // LOCAL VARIABLES
+    long totMoves = 0;                   // Total number of moves made
+    bool success = true;                 // Set this to false if anything fails
+    hsSwarm_ptr swarm_ptr = NULL;        // Swarm store
+    hsLineLen lowEnd = { 0, 0, 0.0 };    // End of the line with the lower sort key
+    hsLineLen highEnd = { 0, 0, 0.0 };   // End of the line with the higher sort key
+    int numGaps = 0;                     // Number of equal gaps the points divide the line into
+    int firstSlot = 0;                   // Gap number of the first point along the line
+    int lowT = 0;                        // Lattice step of lowEnd (see: project_onto_line())
+    int highT = 0;                       // Lattice step of highEnd
+    int tmpT = 0;                        // Lattice step of a target
+    int curT = 0;                        // Lattice step of a point
+    int index = 0;                       // Swarm store index
+    int i = 0;                           // Iterating variable
+    bool movingUp = false;               // The point's target has a higher sort key than the point
+    shawarma oldNode;                    // Stack copy of a point, to clear it from the window
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_solve_one_dim, Invalid curWindow);
+        success = false;
+    }
+    else if (!line_ptr || !(line_ptr->swarm_ptr) || 2 > line_ptr->numOrdered)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_solve_one_dim, Invalid line_ptr);
+        success = false;
+    }
+    else
+    {
+        swarm_ptr = line_ptr->swarm_ptr;
+    }
+
+    // 1. Allocate targets
+    if (true == success && (!(line_ptr->targetX) || !(line_ptr->targetY)))
+    {
+        line_ptr->targetX = calloc(line_ptr->maxOrdered, sizeof(int));
+        line_ptr->targetY = calloc(line_ptr->maxOrdered, sizeof(int));
+
+        if (!(line_ptr->targetX) || !(line_ptr->targetY))
+        {
+            HARKLE_ERROR(Harkleline, shwarm_solve_one_dim, calloc failed);
+            success = false;
+        }
+    }
+
+    // 2. Determine the ends of the line
+    if (true == success)
+    {
+        if (true == intercepts)
+        {
+            // Every point is an interior point between the two intercepts
+            success = calc_line_engine_intercepts(curWindow, line_ptr, &lowEnd, &highEnd);
+            numGaps = line_ptr->numOrdered + 1;
+            firstSlot = 1;
+
+            if (false == success)
+            {
+                HARKLE_ERROR(Harkleline, shwarm_solve_one_dim, calc_line_engine_intercepts failed);
+            }
+        }
+        else
+        {
+            // The end points never move
+            index = line_ptr->order[0];
+            lowEnd.xCoord = swarm_ptr->absX[index];
+            lowEnd.yCoord = swarm_ptr->absY[index];
+            index = line_ptr->order[line_ptr->numOrdered - 1];
+            highEnd.xCoord = swarm_ptr->absX[index];
+            highEnd.yCoord = swarm_ptr->absY[index];
+            numGaps = line_ptr->numOrdered - 1;
+            firstSlot = 0;
+        }
+    }
+
+    // 3. Verify there's room
+    if (true == success)
+    {
+        lowT = project_onto_line(line_ptr, lowEnd.xCoord, lowEnd.yCoord);
+        highT = project_onto_line(line_ptr, highEnd.xCoord, highEnd.yCoord);
+
+        if (highT - lowT < numGaps)
+        {
+            HARKLE_ERROR(Harkleline, shwarm_solve_one_dim, The line is too short to hold every point);
+            success = false;
+        }
+    }
+
+    // 4. Evenly space the points, in order, between the ends (on integer points of the line)
+    if (true == success)
+    {
+        for (i = 0; i < line_ptr->numOrdered; i++)
+        {
+            index = line_ptr->order[i];
+            tmpT = lowT + round_ratio((long long)(highT - lowT) * (i + firstSlot), numGaps);
+            line_ptr->targetX[index] = line_ptr->anchorX + (tmpT * line_ptr->stepX);
+            line_ptr->targetY[index] = line_ptr->anchorY + (tmpT * line_ptr->stepY);
+        }
+        line_ptr->hasTargets = true;
+    }
+
+    // 5. Move straight there
+    //  Order along the line is unchanged so order and rank are still valid.  Points moving 'up' go first,
+    //  from the top, then points moving 'down', from the bottom, so no point ever lands on another.
+    if (true == success && false == animate)
+    {
+        memset(&oldNode, 0x0, sizeof(oldNode));
+        line_ptr->activeValid = false;
+
+        for (i = (2 * line_ptr->numOrdered) - 1; i >= 0 && true == success; i--)
+        {
+            // First pass: ranks numOrdered - 1 down to 0.  Second pass: ranks 0 up to numOrdered - 1.
+            index = (i >= line_ptr->numOrdered) ? line_ptr->order[i - line_ptr->numOrdered]
+                                                : line_ptr->order[line_ptr->numOrdered - 1 - i];
+            movingUp = (get_line_key(line_ptr, index) < ((true == line_ptr->vertLine) ? line_ptr->targetY[index]
+                                                                                     : line_ptr->targetX[index]))
+                       ? true : false;
+
+            if ((i >= line_ptr->numOrdered) == movingUp)
+            {
+                oldNode.absX = swarm_ptr->absX[index];
+                oldNode.absY = swarm_ptr->absY[index];
+                // Counted the way calc_line_step() counts them so the engines' totals compare
+                curT = project_onto_line(line_ptr, oldNode.absX, oldNode.absY);
+                tmpT = project_onto_line(line_ptr, line_ptr->targetX[index], line_ptr->targetY[index]);
+                totMoves += (long)abs(tmpT - curT) * (abs(line_ptr->stepX) + abs(line_ptr->stepY));
+
+                if (curWindow->win_ptr && false == clear_this_coord(curWindow, &oldNode))
+                {
+                    HARKLE_ERROR(Harkleline, shwarm_solve_one_dim, clear_this_coord failed);
+                    success = false;
+                }
+                else if (false == move_swarm_point(swarm_ptr, index, line_ptr->targetX[index],
+                                                   line_ptr->targetY[index]))
+                {
+                    HARKLE_ERROR(Harkleline, shwarm_solve_one_dim, move_swarm_point failed);
+                    success = false;
+                }
+            }
+        }
+    }
+
+    // DONE
+    if (false == success)
+    {
+        totMoves = -1;
+    }
+
+    return totMoves;
+}
+
+
+long shwarm_animate_one_dim(winDetails_ptr curWindow, hsLine_ptr line_ptr, int maxMoves)
+{
+    // LOCAL VARIABLES
+    long totMoves = -1;  // Total number of moves made
+    int numMoves = 0;    // Number of moves made by one point
+    int index = 0;       // Swarm store index
+    int i = 0;           // Iterating variable
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_animate_one_dim, Invalid curWindow);
+    }
+    else if (!line_ptr || !(line_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleline, shwarm_animate_one_dim, Invalid line_ptr);
+    }
+    else if (false == line_ptr->hasTargets)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_animate_one_dim, Targets have not been solved);
+    }
+    else if (maxMoves < 1)
+    {
+        HARKLE_ERROR(Harkleline, shwarm_animate_one_dim, Invalid maxMoves);
+    }
+    else
+    {
+        totMoves = 0;
+        line_ptr->activeValid = false;
+
+        // 1. Points moving 'up' the line, starting at the top, so they get out of each other's way
+        for (i = line_ptr->numOrdered - 1; i >= 0 && totMoves >= 0; i--)
+        {
+            index = line_ptr->order[i];
+
+            if (get_line_key(line_ptr, index) < ((true == line_ptr->vertLine) ? line_ptr->targetY[index]
+                                                                             : line_ptr->targetX[index]))
+            {
+                numMoves = animate_line_index(curWindow, line_ptr, index, maxMoves);
+                totMoves = (0 > numMoves) ? -1 : totMoves + numMoves;
+            }
+        }
+
+        // 2. Points moving 'down' the line, starting at the bottom
+        for (i = 0; i < line_ptr->numOrdered && totMoves >= 0; i++)
+        {
+            index = line_ptr->order[i];
+
+            if (get_line_key(line_ptr, index) >= ((true == line_ptr->vertLine) ? line_ptr->targetY[index]
+                                                                              : line_ptr->targetX[index]))
+            {
+                numMoves = animate_line_index(curWindow, line_ptr, index, maxMoves);
+                totMoves = (0 > numMoves) ? -1 : totMoves + numMoves;
+            }
+        }
+
+        if (0 > totMoves)
+        {
+            HARKLE_ERROR(Harkleline, shwarm_animate_one_dim, animate_line_index failed);
+        }
+    }
+
+    // DONE
+    return totMoves;
+}
+
+
+int inject_line_point(hsLine_ptr line_ptr, int xVal, int yVal, int shNum, char shChar, unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;                  // Swarm store index of the new point
+    bool success = true;              // Set this to false if anything fails
+    int key = 0;                      // Sort key of the new point
+    int newRank = 0;                  // Position of the new point along the line
+    int newMax = 0;                   // New capacity of the engine's per-point arrays
+    int i = 0;                        // Iterating variable
+
+    // INPUT VALIDATION
+    if (!line_ptr || !(line_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleline, inject_line_point, Invalid line_ptr);
+        success = false;
+    }
+    else if (false == is_on_line(line_ptr, xVal, yVal))
+    {
+        HARKLE_ERROR(Harkleline, inject_line_point, Provided point is not on the line);
+        success = false;
+    }
+    else
+    {
+        key = (true == line_ptr->vertLine) ? yVal : xVal;
+        newRank = find_line_rank(line_ptr, key);
+
+        if (newRank < line_ptr->numOrdered && get_line_key(line_ptr, line_ptr->order[newRank]) == key)
+        {
+            HARKLE_ERROR(Harkleline, inject_line_point, Found duplicate coordinates along the line);
+            success = false;
+        }
+    }
+
+    // GROW
+    if (true == success && line_ptr->numOrdered == line_ptr->maxOrdered)
+    {
+        newMax = line_ptr->maxOrdered * 2;
+        success = grow_line_array(&(line_ptr->order), newMax) && grow_line_array(&(line_ptr->rank), newMax)
+                  && grow_line_array(&(line_ptr->targetX), newMax) && grow_line_array(&(line_ptr->targetY), newMax);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkleline, inject_line_point, grow_line_array failed);
+        }
+        else
+        {
+            line_ptr->maxOrdered = newMax;
+        }
+    }
+
+    // ADD IT
+    if (true == success)
+    {
+        retVal = add_swarm_point(line_ptr->swarm_ptr, xVal, yVal, shNum, shChar, shStatus);
+
+        if (0 > retVal)
+        {
+            HARKLE_ERROR(Harkleline, inject_line_point, add_swarm_point failed);
+            success = false;
+        }
+    }
+
+    // INSERT IT IN ORDER
+    if (true == success)
+    {
+        memmove(line_ptr->order + newRank + 1, line_ptr->order + newRank,
+                (line_ptr->numOrdered - newRank) * sizeof(int));
+        line_ptr->order[newRank] = retVal;
+        line_ptr->numOrdered++;
+
+        for (i = newRank; i < line_ptr->numOrdered; i++)
+        {
+            line_ptr->rank[line_ptr->order[i]] = i;
+        }
+
+        // The equilibrium moved
+        line_ptr->hasTargets = false;
+        line_ptr->activeValid = false;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool verify_line_engine(hsLine_ptr line_ptr)
+{
+    // LOCAL VARIABLES
+    bool straightLine = false;  // Set this to true once the line is verified
+    int i = 0;                  // Iterating variable
+
+    // INPUT VALIDATION
+    if (!line_ptr || !(line_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleline, verify_line_engine, Invalid line_ptr);
+    }
+    else
+    {
+        // ITERATE POINTS
+        straightLine = true;
+
+        for (i = 0; i < line_ptr->swarm_ptr->numPnts; i++)
+        {
+            if (false == is_on_line(line_ptr, line_ptr->swarm_ptr->absX[i], line_ptr->swarm_ptr->absY[i]))
+            {
+                straightLine = false;
+                break;
+            }
+        }
+    }
+
+    // DONE
+    return straightLine;
+}
+
+
+bool invalidate_line_intercepts(hsLine_ptr line_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the cache is invalidated
+
+    // INPUT VALIDATION
+    if (!line_ptr)
+    {
+        HARKLE_ERROR(Harkleline, invalidate_line_intercepts, Invalid line_ptr);
+    }
+    else
+    {
+        line_ptr->intCache.valid = false;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool free_line_engine(hsLine_ptr *oldLine_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;        // Set this to true if the engine is freed
+    hsLine_ptr line_ptr = NULL;  // Local copy of *oldLine_ptr
+
+    // INPUT VALIDATION
+    if (!oldLine_ptr || !(*oldLine_ptr))
+    {
+        HARKLE_ERROR(Harkleline, free_line_engine, Invalid oldLine_ptr);
+    }
+    else
+    {
+        // FREE
+        line_ptr = *oldLine_ptr;
+
+        if (line_ptr->order)
+        {
+            free(line_ptr->order);
+        }
+        if (line_ptr->rank)
+        {
+            free(line_ptr->rank);
+        }
+        if (line_ptr->targetX)
+        {
+            free(line_ptr->targetX);
+        }
+        if (line_ptr->targetY)
+        {
+            free(line_ptr->targetY);
+        }
+        if (line_ptr->snapX)
+        {
+            free(line_ptr->snapX);
+        }
+        if (line_ptr->snapY)
+        {
+            free(line_ptr->snapY);
+        }
+        if (line_ptr->nextX)
+        {
+            free(line_ptr->nextX);
+        }
+        if (line_ptr->nextY)
+        {
+            free(line_ptr->nextY);
+        }
+        if (line_ptr->nextMoves)
+        {
+            free(line_ptr->nextMoves);
+        }
+        if (line_ptr->activeMark)
+        {
+            free(line_ptr->activeMark);
+        }
+        if (line_ptr->activeHeap)
+        {
+            free(line_ptr->activeHeap);
+        }
+        if (line_ptr->activeNext)
+        {
+            free(line_ptr->activeNext);
+        }
+        if (line_ptr->residual)
+        {
+            free(line_ptr->residual);
+        }
+        if (line_ptr->resCount)
+        {
+            free(line_ptr->resCount);
+        }
+
+        memset(line_ptr, 0x0, sizeof(hsLine));
+        free(line_ptr);
+        *oldLine_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
@@ -0,0 +1,307 @@
+#ifndef __HARKLELINE__
+#define __HARKLELINE__
+
+#include "Harklecurse.h"        // winDetails_ptr
+#include "Harklepool.h"         // hsPool_ptr
+#include "Harklestore.h"        // hsSwarm_ptr
+#include <stdbool.h>            // bool, true, false
+
+// Active set states (see: hsLine.activeMark)
+#define HS_LINE_IDLE 0                // Can't move until one of its neighbours does
+#define HS_LINE_ACTIVE_NOW 1          // Waiting to be evaluated later in the current sweep
+#define HS_LINE_ACTIVE_NEXT 2         // Waiting to be evaluated in the next sweep
+
+// Defines the struct that caches a line's intercepts with a window
+typedef struct hsInterceptCache
+{
+    bool valid;               // If false, the intercepts must be recalculated before use
+    int upperR;               // upperR of the window the intercepts were calculated for
+    int leftC;                // leftC of the window the intercepts were calculated for
+    int nRows;                // nRows of the window the intercepts were calculated for
+    int nCols;                // nCols of the window the intercepts were calculated for
+    hsLineLen lowInt;         // Intercept with the lower sort key
+    hsLineLen highInt;        // Intercept with the higher sort key
+} hsIntCache, *hsIntCache_ptr;
+
+// Defines the struct that describes the most recent shwarm_line_sweep()'s progress toward equilibrium
+//  A point's residual is the number of lattice steps along the line between it and the midpoint of its
+//  neighbours (0 for the ends of the line).  Every residual is 0 exactly at equilibrium.
+//  Residuals are local: spacing errors that only show up across many points can take many sweeps to
+//  work out even while every residual is 1.
+typedef struct hsLineSweepStats
+{
+    long sweepNum;            // Number of sweeps shwarm_line_sweep() has made (1 after the first)
+    long numMoves;            // Total moves made during the sweep
+    int numEvaluated;         // Number of (active) points evaluated during the sweep
+    int numMoved;             // Number of points that moved during the sweep
+    bool hasResiduals;        // If true, the residual members below are valid (see: track_line_equilibrium())
+    long long totResidual;    // Sum of every point's residual after the sweep
+    int maxResidual;          // Largest residual after the sweep
+    int numUnsettled;         // Number of points with a non-zero residual after the sweep
+} hsLineStats, *hsLineStats_ptr;
+
+// Defines the struct that holds the one dimensional (line) swarm engine
+//  The points of a swarm store are kept sorted along the line so that a point's neighbours are simply
+//  the entries on either side of it in 'order'.  'rank' is the inverse of 'order'.
+//  Every point lies on (anchorX, anchorY) + t * (stepX, stepY) for some integer t.  This invariant is
+//  verified once, when the engine is built (or a point is injected), and every mover preserves it.
+typedef struct hsLineEngine
+{
+    hsSwarm_ptr swarm_ptr;    // Swarm store being swarmed (not owned by the engine)
+    bool vertLine;            // If true, the line is vertical and points are ordered by absY instead of absX
+    int anchorX;              // X coordinate of a point the line passes through
+    int anchorY;              // Y coordinate of a point the line passes through
+    int stepX;                // X component of the smallest step between two integer points on the line
+    int stepY;                // Y component of the smallest step between two integer points on the line
+    hsIntCache intCache;      // The line's intercepts with the most recently used window
+    int numOrdered;           // Number of entries in order and rank
+    int maxOrdered;           // Capacity of order, rank, targetX and targetY
+    int *order;               // order[i] is the swarm store index of the i-th point along the line
+    int *rank;                // rank[index] is the position of swarm store index 'index' in order
+    bool hasTargets;          // If true, targetX and targetY hold the solved equilibrium of every point
+    int *targetX;             // targetX[index] is the equilibrium x coordinate of swarm store index 'index'
+    int *targetY;             // targetY[index] is the equilibrium y coordinate of swarm store index 'index'
+    int maxJacobi;            // Capacity of the Jacobi sweep buffers below (allocated on first use)
+    int *snapX;               // snapX[rank] is the frozen x coordinate of the rank-th point along the line
+    int *snapY;               // snapY[rank] is the frozen y coordinate of the rank-th point along the line
+    int *nextX;               // nextX[rank] is the x coordinate the rank-th point proposes to move to
+    int *nextY;               // nextY[rank] is the y coordinate the rank-th point proposes to move to
+    int *nextMoves;           // nextMoves[rank] is the number of moves the rank-th point's proposal costs
+    bool activeValid;         // If false, every point is active at the start of the next shwarm_line_sweep()
+    bool activeInts;          // The intercepts argument the active set was tracked for
+    hsLineLen activeLowInt;   // The lower intercept the active set was tracked for
+    hsLineLen activeHighInt;  // The higher intercept the active set was tracked for
+    int maxActive;            // Capacity of activeMark, activeHeap and activeNext (allocated on first use)
+    char *activeMark;         // activeMark[index] is the HS_LINE_* state of swarm store index 'index'
+    int numHeap;              // Number of entries in activeHeap
+    int *activeHeap;          // Min-heap of swarm store indices left to evaluate in the current sweep
+    int numNext;              // Number of entries in activeNext
+    int *activeNext;          // Swarm store indices to evaluate in the next sweep
+    hsLineStats sweepStats;   // Progress made by the most recent shwarm_line_sweep()
+    bool trackResiduals;      // If true, shwarm_line_sweep() maintains every point's residual
+    bool residualsValid;      // If false, the residuals are recalculated from scratch by the next sweep
+    int maxTracked;           // Capacity of residual (allocated on first use)
+    int *residual;            // residual[index] is the residual of swarm store index 'index'
+    int maxResCount;          // Capacity of resCount
+    long *resCount;           // resCount[r] is the number of points with a residual of r
+} hsLine, *hsLine_ptr;
+
+
+/*
+    PURPOSE - Allocate a line engine for a swarm store and sort the swarm along its line
+    INPUT
+        swarm_ptr - Pointer to a swarm store of at least two points which all lie on one line
+    OUTPUT
+        On success, pointer to a heap-allocated hsLine struct
+        On failure, NULL
+    NOTES
+        The points are verified to form a line and sorted once, in O(n log n).  Afterwards, the engine
+            maintains the line and the order incrementally as it moves points.
+        The engine does not own swarm_ptr but swarm_ptr must outlive the engine.  Do not add or remove
+            points from swarm_ptr while the engine exists.  Use inject_line_point() instead.
+        It is the caller's responsibility to free the memory with free_line_engine()
+ */
+hsLine_ptr build_line_engine(hsSwarm_ptr swarm_ptr);
+
+
+/*
+    PURPOSE - Update the coordinates of point 'srcNum' by moving it 'maxMoves' toward equilibrium
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine window border points)
+        line_ptr - Pointer to a line engine
+        maxMoves - Number of one-dimensional moves the point may move to pursue equilibrium
+        srcNum - posNum value of the point to move
+        intercepts - If true, line intercepts will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, number of moves made (not to exceed maxMoves).  0 indicates success (and also equilibrium).
+        On failure, -1
+    NOTES
+        This is the swarm store equivalent of shwarm_it(curWindow, headNode_ptr, maxMoves, srcNum, 1, intercepts)
+        Neighbour lookup is O(1) instead of a scan of the entire swarm
+        Points only move along the line, one integer point at a time.  Each step costs abs(stepX) + abs(stepY)
+            moves but a point may always take at least one step, even on steep lines.
+ */
+int shwarm_line_point(winDetails_ptr curWindow, hsLine_ptr line_ptr, int maxMoves, int srcNum, bool intercepts);
+
+
+/*
+    PURPOSE - Move every point in the swarm once, in swarm store order, toward equilibrium
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine window border points)
+        line_ptr - Pointer to a line engine
+        maxMoves - Number of one-dimensional moves each point may move to pursue equilibrium
+        intercepts - If true, line intercepts will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, total number of moves made by all points.  0 indicates equilibrium.
+        On failure, -1
+    NOTES
+        This is the equivalent of calling shwarm_it() for every point in the swarm
+        A point can only move if it, or one of its neighbours, moved since it was last evaluated.  The
+            engine tracks that active set so points that can't move are skipped.  Active points are still
+            evaluated in swarm store order so the result is identical to evaluating every point, but the
+            tail of convergence costs O(changed log changed) per sweep instead of O(n).
+        Every other function that moves points resets the active set so the next sweep starts from scratch
+        Progress is stored in line_ptr->sweepStats.  If track_line_equilibrium() enabled residuals, they are
+            updated incrementally as points move (O(1) per move) so callers can stop at a tolerance
+            instead of waiting for 0 moves.
+ */
+long shwarm_line_sweep(winDetails_ptr curWindow, hsLine_ptr line_ptr, int maxMoves, bool intercepts);
+
+
+/*
+    PURPOSE - Start, or stop, tracking every point's distance from equilibrium
+    INPUT
+        line_ptr - Pointer to a line engine
+        enable - If true, shwarm_line_sweep() maintains residuals and reports them in sweepStats
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The residuals are calculated from scratch (O(n)) by the next sweep, and again whenever the active set
+            is reset.  Afterwards, each move only updates the residuals of the point and its neighbours.
+        Residuals cost roughly one extra midpoint calculation per neighbour per move so they are off by default
+ */
+bool track_line_equilibrium(hsLine_ptr line_ptr, bool enable);
+
+
+/*
+    PURPOSE - Move every point in the swarm once, simultaneously, toward equilibrium across a pool of threads
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine window border points)
+        line_ptr - Pointer to a line engine
+        pool_ptr - Pointer to the worker pool to split the sweep across
+        maxMoves - Number of one-dimensional moves each point may move to pursue equilibrium
+        intercepts - If true, line intercepts will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, total number of moves made by all points.  0 indicates equilibrium.
+        On failure, -1
+    NOTES
+        shwarm_line_sweep() is Gauss-Seidel: each point sees the moves of the points before it, so the
+            sweep is inherently serial.  This sweep is red-black: the even ranks move, all at once, then the
+            odd ranks do.  Each phase calculates moves from a snapshot of the swarm (snapX, snapY) into a
+            second buffer (nextX, nextY), then commits them, and both steps are split across the pool.
+        A point's neighbours never move in the same phase, so two points can't keep undoing each other's
+            moves from a stale snapshot, and a proposal must land strictly between its neighbours so the
+            order along the line never changes.  A sweep of 0 moves leaves every point at the rounded
+            midpoint of its neighbours, which is an equilibrium.
+        Integer fixed points depend on the path taken (see: shwarm_solve_one_dim()) so this sweep can settle
+            a lattice step away from where shwarm_line_sweep() would, in a different number of sweeps.
+        If the swarm store has an occupancy map, or curWindow has a window, moves are committed on the
+            calling thread since neither is thread safe.  Otherwise, commits are parallel too.
+ */
+long shwarm_line_jacobi_sweep(winDetails_ptr curWindow, hsLine_ptr line_ptr, hsPool_ptr pool_ptr, int maxMoves,
+                              bool intercepts);
+
+
+/*
+    PURPOSE - Calculate the one dimensional equilibrium of the swarm directly, without iterating
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine window border points)
+        line_ptr - Pointer to a line engine
+        intercepts - If true, line intercepts will be treated as points for the purposes of equilibrium
+        animate - If true, the equilibrium is only stored as each point's target (see: shwarm_animate_one_dim()).
+            If false, every point is moved straight to its equilibrium.
+    OUTPUT
+        On success, the total number of moves made by all points (0 if animate is true), counted the way
+            calc_line_step() counts them: abs(stepX) + abs(stepY) moves per lattice step
+        On failure, -1
+    NOTES
+        Without rounding, repeated determine_mid_point() + move_shawarma() calls converge to evenly spaced
+            points between the two end points of the line (or between the line intercepts, from
+            calculate_line_intercepts(), if intercepts is true).  This function calculates those positions,
+            rounded to the nearest integer, in O(n).
+        This is NOT, in general, where the iterative engines (shwarm_one_dim(), shwarm_line_sweep() and
+            shwarm_line_jacobi_sweep()) stop:
+            - They round every midpoint and stop at the first integer fixed point they reach.  That
+                depends on where the points started and is usually a lattice step or two from the evenly
+                spaced ideal (e.g., ends 0 and 22: solved 7 and 15, iterated 8 and 15).
+            - calculate_line_intercepts() returns absolute coordinates, offset by curWindow's upperR and
+                leftC, but the swarm is seeded relative to the window.  Points seeded below the low
+                intercept stay below it in the iterative engines, while this function places every point
+                between the intercepts (e.g., 30 points on the default headless 40 x 80 field: solved
+                onto 5..36, iterated onto 1..36).
+        Points keep their order along the line.  If the line is too short to hold every point at a unique
+            coordinate, this function fails without moving anything.
+ */
+long shwarm_solve_one_dim(winDetails_ptr curWindow, hsLine_ptr line_ptr, bool intercepts, bool animate);
+
+
+/*
+    PURPOSE - Move every point 'maxMoves' toward the targets calculated by shwarm_solve_one_dim()
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to clear old coordinates, if it has a window)
+        line_ptr - Pointer to a line engine that has targets
+        maxMoves - Number of one-dimensional moves each point may move toward its target
+    OUTPUT
+        On success, total number of moves made by all points.  0 indicates every point reached its target.
+        On failure, -1
+    NOTES
+        Points never pass, or land on, their neighbours along the line.  A point that would has to wait
+            for its neighbour to move out of the way first.
+ */
+long shwarm_animate_one_dim(winDetails_ptr curWindow, hsLine_ptr line_ptr, int maxMoves);
+
+
+/*
+    PURPOSE - Add a new point to the swarm and the engine (before or after equilibrium)
+    INPUT
+        line_ptr - Pointer to a line engine
+        xVal - Absolute, from the ncurse window's top left, x coordinate of this point
+        yVal - Absolute, from the ncurse window's top left, y coordinate of this point
+        shNum - Identifying number of this point (must be unique and greater than 0)
+        shChar - The character to print at coordinate (xVal, yVal)
+        shStatus - Initial value of the implementation-defined flags available for this point
+    OUTPUT
+        On success, the swarm store index of the new point
+        On failure, -1
+    NOTES
+        The point must lie on the line and may not share a coordinate with an existing point
+        Any targets from shwarm_solve_one_dim() are discarded since the equilibrium changed
+ */
+int inject_line_point(hsLine_ptr line_ptr, int xVal, int yVal, int shNum, char shChar, unsigned long shStatus);
+
+
+/*
+    PURPOSE - Verify every point in the swarm still lies on the engine's line
+    INPUT
+        line_ptr - Pointer to a line engine
+    OUTPUT
+        If all points lie on the line, true
+        Otherwise, false
+        On error, false
+    NOTES
+        This is an O(n) consistency check.  The engine never needs it.  If HS_DEBUG_VERIFY_LINE is defined,
+            shwarm_line_sweep() calls it after every sweep.
+ */
+bool verify_line_engine(hsLine_ptr line_ptr);
+
+
+/*
+    PURPOSE - Discard a line engine's cached intercepts
+    INPUT
+        line_ptr - Pointer to a line engine
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Intercepts are calculated once per (line, window) pair.  A change to the window's dimensions is
+            detected automatically.  Call this function if the line itself changes (e.g., anchorX, anchorY
+            or the step are modified).
+ */
+bool invalidate_line_intercepts(hsLine_ptr line_ptr);
+
+
+/*
+    PURPOSE - Free the heap-allocated memory associated with a line engine
+    INPUT
+        oldLine_ptr - A pointer to a heap-allocated hsLine struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The swarm store is not freed.  Call this function as free_line_engine(&myLine_ptr);
+ */
+bool free_line_engine(hsLine_ptr *oldLine_ptr);
+
+
+#endif  // __HARKLELINE__
@@ -0,0 +1,236 @@
+#include "Harklemove.h"
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harklescan.h"         // get_scan_kernel(), HS_SCAN_HAVE_AVX2
+#include <stdlib.h>             // abs()
+
+#ifdef HS_SCAN_HAVE_AVX2
+#include <immintrin.h>          // AVX2 intrinsics
+#endif  // HS_SCAN_HAVE_AVX2
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Calculate where move_shawarma() would leave one point
+    INPUT
+        curX - Current x coordinate
+        curY - Current y coordinate
+        dstX - Destination x coordinate
+        dstY - Destination y coordinate
+        maxMoves - Maximum number of moves
+        newX_ptr - [Out] X coordinate after the moves
+        newY_ptr - [Out] Y coordinate after the moves
+    OUTPUT
+        Number of moves made
+    NOTES
+        With xDist and yDist left to go, and numMoves = min(maxMoves, xDist + yDist):
+            1. The farther axis makes the first min(numMoves, |xDist - yDist|) moves (x if they're even)
+            2. The rest alternate, x first, so x makes the odd one out
+        This function does not perform input validation
+ */
+int calc_closed_form_move(int curX, int curY, int dstX, int dstY, int maxMoves, int *newX_ptr, int *newY_ptr)
+{
+    // LOCAL VARIABLES
+    int absXDist = abs(dstX - curX);               // Distance to go along x
+    int absYDist = abs(dstY - curY);               // Distance to go along y
+    int numMoves = absXDist + absYDist;            // Number of moves made
+    int leadMoves = abs(absXDist - absYDist);      // Moves the farther axis makes before the axes alternate
+    int xMoves = 0;                                // Moves made along x
+    int yMoves = 0;                                // Moves made along y
+
+    if (numMoves > maxMoves)
+    {
+        numMoves = maxMoves;
+    }
+    if (leadMoves > numMoves)
+    {
+        leadMoves = numMoves;
+    }
+
+    // Alternating moves
+    xMoves = (numMoves - leadMoves + 1) / 2;
+    yMoves = (numMoves - leadMoves) / 2;
+
+    // Leading moves
+    if (absXDist >= absYDist)
+    {
+        xMoves += leadMoves;
+    }
+    else
+    {
+        yMoves += leadMoves;
+    }
+
+    *newX_ptr = (dstX < curX) ? curX - xMoves : curX + xMoves;
+    *newY_ptr = (dstY < curY) ? curY - yMoves : curY + yMoves;
+
+    // DONE
+    return numMoves;
+}
+
+
+/*
+    PURPOSE - Scalar kernel for move_shawarma_bulk(), over indices [first, last)
+    INPUT
+        See: move_shawarma_bulk()
+        first - First index to move
+        last - One past the last index to move
+    OUTPUT
+        Total number of moves made
+    NOTES
+        This function does not perform input validation
+ */
+long move_bulk_scalar(int *curX, int *curY, int *dstX, int *dstY, int first, int last, int maxMoves, int *newX,
+                      int *newY, int *numMoves_arr)
+{
+    // LOCAL VARIABLES
+    long totMoves = 0;  // Total number of moves made
+    int numMoves = 0;   // Moves made by one point
+    int i = 0;          // Iterating variable
+
+    for (i = first; i < last; i++)
+    {
+        numMoves = calc_closed_form_move(curX[i], curY[i], dstX[i], dstY[i], maxMoves, &(newX[i]), &(newY[i]));
+        totMoves += numMoves;
+
+        if (numMoves_arr)
+        {
+            numMoves_arr[i] = numMoves;
+        }
+    }
+
+    // DONE
+    return totMoves;
+}
+
+
+#ifdef HS_SCAN_HAVE_AVX2
+/*
+    PURPOSE - AVX2 kernel for move_shawarma_bulk()
+    INPUT
+        See: move_shawarma_bulk()
+    OUTPUT
+        Total number of moves made
+    NOTES
+        calc_closed_form_move() with every branch replaced by a min, a mask or a sign, HS_SCAN_LANES points at a
+            time
+        This function does not perform input validation
+ */
+__attribute__((target("avx2")))
+long move_bulk_avx2(int *curX, int *curY, int *dstX, int *dstY, int numPnts, int maxMoves, int *newX, int *newY,
+                    int *numMoves_arr)
+{
+    // LOCAL VARIABLES
+    long totMoves = 0;                                     // Total number of moves made
+    long laneMoves[HS_SCAN_LANES / 2];                     // totVec, spilled
+    __m256i maxVec = _mm256_set1_epi32(maxMoves);          // maxMoves, in every lane
+    __m256i oneVec = _mm256_set1_epi32(1);                 // 1, in every lane
+    __m256i totVec = _mm256_setzero_si256();               // Total number of moves made, per 64-bit lane
+    __m256i xVec;                                          // Current x coordinates
+    __m256i yVec;                                          // Current y coordinates
+    __m256i deltaX;                                        // Signed distance to go along x
+    __m256i deltaY;                                        // Signed distance to go along y
+    __m256i absXDist;                                      // Distance to go along x
+    __m256i absYDist;                                      // Distance to go along y
+    __m256i numMoves;                                      // Number of moves made
+    __m256i leadMoves;                                     // Moves the farther axis makes first
+    __m256i restMoves;                                     // Moves the axes alternate
+    __m256i yLeads;                                        // All ones where y is strictly farther to go
+    __m256i xMoves;                                        // Moves made along x
+    __m256i yMoves;                                        // Moves made along y
+    int i = 0;                                             // Iterating variable
+    int lane = 0;                                          // Iterating variable
+
+    for (i = 0; i + HS_SCAN_LANES <= numPnts; i += HS_SCAN_LANES)
+    {
+        xVec = _mm256_loadu_si256((__m256i *)(curX + i));
+        yVec = _mm256_loadu_si256((__m256i *)(curY + i));
+        deltaX = _mm256_sub_epi32(_mm256_loadu_si256((__m256i *)(dstX + i)), xVec);
+        deltaY = _mm256_sub_epi32(_mm256_loadu_si256((__m256i *)(dstY + i)), yVec);
+        absXDist = _mm256_abs_epi32(deltaX);
+        absYDist = _mm256_abs_epi32(deltaY);
+
+        numMoves = _mm256_min_epi32(_mm256_add_epi32(absXDist, absYDist), maxVec);
+        leadMoves = _mm256_min_epi32(_mm256_abs_epi32(_mm256_sub_epi32(absXDist, absYDist)), numMoves);
+        restMoves = _mm256_sub_epi32(numMoves, leadMoves);
+        yLeads = _mm256_cmpgt_epi32(absYDist, absXDist);
+
+        xMoves = _mm256_add_epi32(_mm256_srli_epi32(_mm256_add_epi32(restMoves, oneVec), 1),
+                                  _mm256_andnot_si256(yLeads, leadMoves));
+        yMoves = _mm256_add_epi32(_mm256_srli_epi32(restMoves, 1), _mm256_and_si256(yLeads, leadMoves));
+
+        // _mm256_sign_epi32() zeroes the lanes with nowhere to go, which have no moves anyway
+        _mm256_storeu_si256((__m256i *)(newX + i), _mm256_add_epi32(xVec, _mm256_sign_epi32(xMoves, deltaX)));
+        _mm256_storeu_si256((__m256i *)(newY + i), _mm256_add_epi32(yVec, _mm256_sign_epi32(yMoves, deltaY)));
+
+        if (numMoves_arr)
+        {
+            _mm256_storeu_si256((__m256i *)(numMoves_arr + i), numMoves);
+        }
+
+        // Widen before summing so a large swarm can't overflow a lane
+        totVec = _mm256_add_epi64(totVec, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(numMoves)));
+        totVec = _mm256_add_epi64(totVec, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(numMoves, 1)));
+    }
+
+    _mm256_storeu_si256((__m256i *)laneMoves, totVec);
+
+    for (lane = 0; lane < HS_SCAN_LANES / 2; lane++)
+    {
+        totMoves += laneMoves[lane];
+    }
+
+    // LEFTOVERS
+    totMoves += move_bulk_scalar(curX, curY, dstX, dstY, i, numPnts, maxMoves, newX, newY, numMoves_arr);
+
+    // DONE
+    return totMoves;
+}
+#endif  // HS_SCAN_HAVE_AVX2
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+long move_shawarma_bulk(int *curX, int *curY, int *dstX, int *dstY, int numPnts, int maxMoves, int *newX, int *newY,
+                        int *numMoves_arr)
+{
+    // LOCAL VARIABLES
+    long totMoves = -1;  // Total number of moves made
+
+    // INPUT VALIDATION
+    if (!curX || !curY || !dstX || !dstY || 0 > numPnts)
+    {
+        HARKLE_ERROR(Harklemove, move_shawarma_bulk, Invalid coordinate arrays);
+    }
+    else if (!newX || !newY)
+    {
+        HARKLE_ERROR(Harklemove, move_shawarma_bulk, Invalid out parameters);
+    }
+    else if (1 > maxMoves)
+    {
+        HARKLE_ERROR(Harklemove, move_shawarma_bulk, Invalid number of moves);
+    }
+    else
+    {
+        // MOVE THEM
+#ifdef HS_SCAN_HAVE_AVX2
+        if (HS_SCAN_KERNEL_AVX2 == get_scan_kernel())
+        {
+            totMoves = move_bulk_avx2(curX, curY, dstX, dstY, numPnts, maxMoves, newX, newY, numMoves_arr);
+        }
+        else
+#endif  // HS_SCAN_HAVE_AVX2
+        {
+            totMoves = move_bulk_scalar(curX, curY, dstX, dstY, 0, numPnts, maxMoves, newX, newY, numMoves_arr);
+        }
+    }
+
+    // DONE
+    return totMoves;
+}
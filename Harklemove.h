@@ -0,0 +1,39 @@
+#ifndef __HARKLEMOVE__
+#define __HARKLEMOVE__
+
+#include <stdbool.h>            // bool, true, false
+
+// Bulk, closed form, point movement
+//  move_shawarma() walks a point toward its destination one unit at a time, always along the axis with the
+//  farther to go (x breaks ties).  That walk has a closed form: the farther axis closes the gap until both
+//  axes are even, then the axes alternate (x first).  move_shawarma_bulk() evaluates it for every point of a
+//  swarm at once, with no per-step loop, HS_SCAN_LANES points per instruction on the AVX2 kernel (see:
+//  select_scan_kernel()).
+
+
+/*
+    PURPOSE - Move every point up to maxMoves steps toward its destination, exactly like move_shawarma()
+    INPUT
+        curX - numPnts current x coordinates
+        curY - numPnts current y coordinates
+        dstX - numPnts destination x coordinates
+        dstY - numPnts destination y coordinates
+        numPnts - Number of points
+        maxMoves - Maximum number of moves each point may make
+        newX - [Out] numPnts x coordinates after the moves (may be curX)
+        newY - [Out] numPnts y coordinates after the moves (may be curY)
+        numMoves_arr - [Optional/Out] numPnts move counts
+    OUTPUT
+        On success, total number of moves made by every point
+        On failure, -1
+    NOTES
+        Each point ends where move_shawarma(node_ptr, dstCoord_ptr, maxMoves) would leave it, and makes the same
+            number of moves, without visiting any of the coordinates in between.  It is the caller's job to
+            decide if the destination is free.
+        The distance along each axis, and their sum, must fit in an int
+ */
+long move_shawarma_bulk(int *curX, int *curY, int *dstX, int *dstY, int numPnts, int maxMoves, int *newX, int *newY,
+                        int *numMoves_arr);
+
+
+#endif  // __HARKLEMOVE__
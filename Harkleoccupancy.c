@@ -0,0 +1,489 @@
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harkleoccupancy.h"
+#include <stdlib.h>             // calloc(), free()
+#include <string.h>             // memset()
+
+// Marks an empty hashed grid slot (row major offsets are never negative)
+#define HS_OCCUPANCY_EMPTY_SLOT -1
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Translate a coordinate into its row major offset within the field
+    INPUT
+        occupy_ptr - Pointer to an occupancy map
+        xCoord - X coordinate
+        yCoord - Y coordinate
+    OUTPUT
+        On success, the offset of (xCoord, yCoord)
+        If the coordinate is outside the field, -1
+    NOTES
+        This function does not perform input validation
+ */
+long long calc_occupancy_offset(hsOccupancy_ptr occupy_ptr, int xCoord, int yCoord)
+{
+    // LOCAL VARIABLES
+    long long retVal = -1;  // Row major offset
+
+    if (xCoord >= occupy_ptr->xMin && xCoord <= occupy_ptr->xMax
+        && yCoord >= occupy_ptr->yMin && yCoord <= occupy_ptr->yMax)
+    {
+        retVal = ((long long)(yCoord - occupy_ptr->yMin) * (occupy_ptr->xMax - occupy_ptr->xMin + 1))
+                 + (xCoord - occupy_ptr->xMin);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Calculate the hashed grid slot an offset's probe sequence starts at
+    INPUT
+        occupy_ptr - Pointer to a hashed occupancy map
+        offset - Row major offset
+    OUTPUT
+        Index of offset's home slot
+    NOTES
+        Fibonacci hashing spreads the (very regular) row major offsets across the grid
+        This function does not perform input validation
+ */
+long long calc_occupancy_home(hsOccupancy_ptr occupy_ptr, long long offset)
+{
+    return (long long)(((unsigned long long)offset * 0x9E3779B97F4A7C15ULL) >> 16) & (occupy_ptr->numSlots - 1);
+}
+
+
+/*
+    PURPOSE - Find the hashed grid slot that holds an offset, or the empty slot it belongs in
+    INPUT
+        occupy_ptr - Pointer to a hashed occupancy map
+        offset - Row major offset to find
+    OUTPUT
+        Index of the slot holding offset, or of the empty slot that ends its probe sequence
+    NOTES
+        The grid is never full (see: occupy_coordinate()) so the probe always ends
+        This function does not perform input validation
+ */
+long long find_occupancy_slot(hsOccupancy_ptr occupy_ptr, long long offset)
+{
+    // LOCAL VARIABLES
+    long long slot = calc_occupancy_home(occupy_ptr, offset);  // Current probe
+
+    while (HS_OCCUPANCY_EMPTY_SLOT != occupy_ptr->hashGrid[slot] && offset != occupy_ptr->hashGrid[slot])
+    {
+        slot = (slot + 1) & (occupy_ptr->numSlots - 1);
+    }
+
+    // DONE
+    return slot;
+}
+
+
+/*
+    PURPOSE - Double the number of slots in a hashed grid
+    INPUT
+        occupy_ptr - Pointer to a hashed occupancy map
+    OUTPUT
+        On success, true
+        On failure, false (and the grid is unchanged)
+    NOTES
+        This function does not perform input validation
+ */
+bool grow_occupancy_grid(hsOccupancy_ptr occupy_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;                          // Set this to false if anything fails
+    long long *oldGrid = occupy_ptr->hashGrid;    // The grid being replaced
+    long long oldSlots = occupy_ptr->numSlots;    // Size of the grid being replaced
+    long long *newGrid = NULL;                    // The replacement grid
+    long long i = 0;                              // Iterating variable
+
+    // ALLOCATE
+    newGrid = calloc(oldSlots * 2, sizeof(long long));
+
+    if (!newGrid)
+    {
+        HARKLE_ERROR(Harkleoccupancy, grow_occupancy_grid, calloc failed);
+        success = false;
+    }
+    else
+    {
+        // REHASH
+        for (i = 0; i < oldSlots * 2; i++)
+        {
+            newGrid[i] = HS_OCCUPANCY_EMPTY_SLOT;
+        }
+        occupy_ptr->hashGrid = newGrid;
+        occupy_ptr->numSlots = oldSlots * 2;
+
+        for (i = 0; i < oldSlots; i++)
+        {
+            if (HS_OCCUPANCY_EMPTY_SLOT != oldGrid[i])
+            {
+                newGrid[find_occupancy_slot(occupy_ptr, oldGrid[i])] = oldGrid[i];
+            }
+        }
+
+        free(oldGrid);
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Empty a hashed grid slot without breaking the probe sequences that pass through it
+    INPUT
+        occupy_ptr - Pointer to a hashed occupancy map
+        slot - Index of the occupied slot to empty
+    NOTES
+        Linear probing backward shift deletion, so the grid never accumulates tombstones
+        This function does not perform input validation
+ */
+void empty_occupancy_slot(hsOccupancy_ptr occupy_ptr, long long slot)
+{
+    // LOCAL VARIABLES
+    long long mask = occupy_ptr->numSlots - 1;  // numSlots is a power of two
+    long long nextSlot = slot;                   // Later slot in the same probe sequence
+    long long homeSlot = 0;                      // Where nextSlot's offset hashes to
+
+    // SHIFT ENTRIES BACK
+    while (1)
+    {
+        nextSlot = (nextSlot + 1) & mask;
+
+        if (HS_OCCUPANCY_EMPTY_SLOT == occupy_ptr->hashGrid[nextSlot])
+        {
+            break;  // End of the probe sequence
+        }
+
+        homeSlot = calc_occupancy_home(occupy_ptr, occupy_ptr->hashGrid[nextSlot]);
+
+        // An entry whose home is cyclically within (slot, nextSlot] must stay put
+        if ((slot <= nextSlot) ? (homeSlot <= slot || homeSlot > nextSlot)
+                               : (homeSlot <= slot && homeSlot > nextSlot))
+        {
+            occupy_ptr->hashGrid[slot] = occupy_ptr->hashGrid[nextSlot];
+            slot = nextSlot;
+        }
+    }
+
+    occupy_ptr->hashGrid[slot] = HS_OCCUPANCY_EMPTY_SLOT;
+
+    // DONE
+    return;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsOccupancy_ptr build_occupancy_map(int xMin, int xMax, int yMin, int yMax, int expPnts)
+{
+    // LOCAL VARIABLES
+    hsOccupancy_ptr retVal = NULL;  // Occupancy map to return
+    bool success = true;            // Set this to false if anything fails
+    long long numCoords = 0;        // Number of coordinates in the field
+    long long i = 0;                // Iterating variable
+
+    // INPUT VALIDATION
+    if (xMin > xMax)
+    {
+        HARKLE_ERROR(Harkleoccupancy, build_occupancy_map, Invalid x coordinate min and max);
+        success = false;
+    }
+    else if (yMin > yMax)
+    {
+        HARKLE_ERROR(Harkleoccupancy, build_occupancy_map, Invalid y coordinate min and max);
+        success = false;
+    }
+    else if (0 > expPnts)
+    {
+        HARKLE_ERROR(Harkleoccupancy, build_occupancy_map, Invalid expPnts);
+        success = false;
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsOccupancy));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harkleoccupancy, build_occupancy_map, calloc failed);
+            success = false;
+        }
+        else
+        {
+            retVal->xMin = xMin;
+            retVal->xMax = xMax;
+            retVal->yMin = yMin;
+            retVal->yMax = yMax;
+            numCoords = ((long long)xMax - xMin + 1) * ((long long)yMax - yMin + 1);
+
+            if ((numCoords + 7) / 8 <= HS_OCCUPANCY_MAX_BITMAP_BYTES)
+            {
+                // Bitmap
+                retVal->bitmap = calloc((numCoords + 7) / 8, sizeof(unsigned char));
+            }
+            else
+            {
+                // Hashed grid, at most half full
+                retVal->numSlots = HS_OCCUPANCY_DEFAULT_SLOTS;
+
+                while (retVal->numSlots < 2 * (long long)expPnts)
+                {
+                    retVal->numSlots *= 2;
+                }
+
+                retVal->hashGrid = calloc(retVal->numSlots, sizeof(long long));
+
+                if (retVal->hashGrid)
+                {
+                    for (i = 0; i < retVal->numSlots; i++)
+                    {
+                        retVal->hashGrid[i] = HS_OCCUPANCY_EMPTY_SLOT;
+                    }
+                }
+            }
+
+            if (!(retVal->bitmap) && !(retVal->hashGrid))
+            {
+                HARKLE_ERROR(Harkleoccupancy, build_occupancy_map, calloc failed);
+                success = false;
+            }
+        }
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        free_occupancy_map(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool is_coordinate_occupied(hsOccupancy_ptr occupy_ptr, int xCoord, int yCoord)
+{
+    // LOCAL VARIABLES
+    bool occupied = false;  // Set this to true if the coordinate is occupied
+    long long offset = -1;  // Row major offset of the coordinate
+
+    // INPUT VALIDATION
+    if (!occupy_ptr)
+    {
+        HARKLE_ERROR(Harkleoccupancy, is_coordinate_occupied, Invalid occupy_ptr);
+    }
+    else
+    {
+        offset = calc_occupancy_offset(occupy_ptr, xCoord, yCoord);
+
+        if (0 > offset)
+        {
+            occupied = false;  // Outside the field
+        }
+        else if (occupy_ptr->bitmap)
+        {
+            occupied = (occupy_ptr->bitmap[offset / 8] & (1 << (offset % 8))) ? true : false;
+        }
+        else
+        {
+            occupied = (offset == occupy_ptr->hashGrid[find_occupancy_slot(occupy_ptr, offset)]) ? true : false;
+        }
+    }
+
+    // DONE
+    return occupied;
+}
+
+
+bool occupy_coordinate(hsOccupancy_ptr occupy_ptr, int xCoord, int yCoord)
+{
+    // LOCAL VARIABLES
+    bool success = true;    // Set this to false if anything fails
+    long long offset = -1;  // Row major offset of the coordinate
+    long long slot = 0;     // Hashed grid slot
+
+    // INPUT VALIDATION
+    if (!occupy_ptr)
+    {
+        HARKLE_ERROR(Harkleoccupancy, occupy_coordinate, Invalid occupy_ptr);
+        success = false;
+    }
+    else
+    {
+        offset = calc_occupancy_offset(occupy_ptr, xCoord, yCoord);
+
+        if (0 > offset)
+        {
+            HARKLE_ERROR(Harkleoccupancy, occupy_coordinate, Coordinate is outside the field);
+            success = false;
+        }
+        else if (true == is_coordinate_occupied(occupy_ptr, xCoord, yCoord))
+        {
+            HARKLE_ERROR(Harkleoccupancy, occupy_coordinate, Coordinate is already occupied);
+            success = false;
+        }
+    }
+
+    // OCCUPY
+    if (true == success)
+    {
+        if (occupy_ptr->bitmap)
+        {
+            occupy_ptr->bitmap[offset / 8] |= (1 << (offset % 8));
+        }
+        else
+        {
+            // Keep the grid at most half full so probes stay short
+            if (2 * (occupy_ptr->numOccupied + 1) > occupy_ptr->numSlots)
+            {
+                success = grow_occupancy_grid(occupy_ptr);
+
+                if (false == success)
+                {
+                    HARKLE_ERROR(Harkleoccupancy, occupy_coordinate, grow_occupancy_grid failed);
+                }
+            }
+
+            if (true == success)
+            {
+                slot = find_occupancy_slot(occupy_ptr, offset);
+                occupy_ptr->hashGrid[slot] = offset;
+            }
+        }
+
+        if (true == success)
+        {
+            occupy_ptr->numOccupied++;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool vacate_coordinate(hsOccupancy_ptr occupy_ptr, int xCoord, int yCoord)
+{
+    // LOCAL VARIABLES
+    bool success = true;    // Set this to false if anything fails
+    long long offset = -1;  // Row major offset of the coordinate
+
+    // INPUT VALIDATION
+    if (!occupy_ptr)
+    {
+        HARKLE_ERROR(Harkleoccupancy, vacate_coordinate, Invalid occupy_ptr);
+        success = false;
+    }
+    else if (false == is_coordinate_occupied(occupy_ptr, xCoord, yCoord))
+    {
+        HARKLE_ERROR(Harkleoccupancy, vacate_coordinate, Coordinate is not occupied);
+        success = false;
+    }
+
+    // VACATE
+    if (true == success)
+    {
+        offset = calc_occupancy_offset(occupy_ptr, xCoord, yCoord);
+
+        if (occupy_ptr->bitmap)
+        {
+            occupy_ptr->bitmap[offset / 8] &= ~(1 << (offset % 8));
+        }
+        else
+        {
+            empty_occupancy_slot(occupy_ptr, find_occupancy_slot(occupy_ptr, offset));
+        }
+
+        occupy_ptr->numOccupied--;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool move_coordinate_occupant(hsOccupancy_ptr occupy_ptr, int oldX, int oldY, int newX, int newY)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!occupy_ptr)
+    {
+        HARKLE_ERROR(Harkleoccupancy, move_coordinate_occupant, Invalid occupy_ptr);
+        success = false;
+    }
+    else if (oldX != newX || oldY != newY)
+    {
+        // MOVE
+        if (0 > calc_occupancy_offset(occupy_ptr, newX, newY)
+            || true == is_coordinate_occupied(occupy_ptr, newX, newY))
+        {
+            HARKLE_ERROR(Harkleoccupancy, move_coordinate_occupant, New coordinate is unavailable);
+            success = false;
+        }
+        else if (false == vacate_coordinate(occupy_ptr, oldX, oldY))
+        {
+            HARKLE_ERROR(Harkleoccupancy, move_coordinate_occupant, vacate_coordinate failed);
+            success = false;
+        }
+        else if (false == occupy_coordinate(occupy_ptr, newX, newY))
+        {
+            HARKLE_ERROR(Harkleoccupancy, move_coordinate_occupant, occupy_coordinate failed);
+            occupy_coordinate(occupy_ptr, oldX, oldY);  // Put it back
+            success = false;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool free_occupancy_map(hsOccupancy_ptr *oldOccupy_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;             // Set this to true if the map is freed
+    hsOccupancy_ptr occupy_ptr = NULL;  // Local copy of *oldOccupy_ptr
+
+    // INPUT VALIDATION
+    if (!oldOccupy_ptr || !(*oldOccupy_ptr))
+    {
+        HARKLE_ERROR(Harkleoccupancy, free_occupancy_map, Invalid oldOccupy_ptr);
+    }
+    else
+    {
+        // FREE
+        occupy_ptr = *oldOccupy_ptr;
+
+        if (occupy_ptr->bitmap)
+        {
+            free(occupy_ptr->bitmap);
+        }
+        if (occupy_ptr->hashGrid)
+        {
+            free(occupy_ptr->hashGrid);
+        }
+
+        memset(occupy_ptr, 0x0, sizeof(hsOccupancy));
+        free(occupy_ptr);
+        *oldOccupy_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
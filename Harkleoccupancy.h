@@ -0,0 +1,121 @@
+#ifndef __HARKLEOCCUPANCY__
+#define __HARKLEOCCUPANCY__
+
+#include <stdbool.h>            // bool, true, false
+
+// Largest bitmap, in bytes, an occupancy map will allocate.  Larger fields use a hashed grid instead.
+#define HS_OCCUPANCY_MAX_BITMAP_BYTES (1 << 24)
+// Starting number of hashed grid slots if the caller doesn't have a better guess
+#define HS_OCCUPANCY_DEFAULT_SLOTS 1024
+
+// Defines the struct that tracks which coordinates of a field are occupied
+//  Small fields (see: HS_OCCUPANCY_MAX_BITMAP_BYTES) get one bit per coordinate.  Huge fields get an
+//  open addressing (linear probing) hash set of occupied coordinates so memory scales with the swarm
+//  instead of the field.  Either way, every check and update is O(1).
+typedef struct hsOccupancyMap
+{
+    int xMin;                 // Smallest x coordinate in the field
+    int xMax;                 // Largest x coordinate in the field
+    int yMin;                 // Smallest y coordinate in the field
+    int yMax;                 // Largest y coordinate in the field
+    long long numOccupied;    // Number of occupied coordinates
+    unsigned char *bitmap;    // One bit per coordinate, row major (NULL if hashed)
+    long long numSlots;       // Number of slots in hashGrid (a power of two)
+    long long *hashGrid;      // Occupied coordinates, as row major offsets (NULL if bitmap)
+} hsOccupancy, *hsOccupancy_ptr;
+
+
+/*
+    PURPOSE - Allocate an empty occupancy map for a field
+    INPUT
+        xMin - Smallest x coordinate in the field
+        xMax - Largest x coordinate in the field
+        yMin - Smallest y coordinate in the field
+        yMax - Largest y coordinate in the field
+        expPnts - Number of points expected to occupy the field (only a hint, 0 if unknown)
+    OUTPUT
+        On success, pointer to a heap-allocated hsOccupancy struct
+        On failure, NULL
+    NOTES
+        It is the caller's responsibility to free the memory with free_occupancy_map()
+ */
+hsOccupancy_ptr build_occupancy_map(int xMin, int xMax, int yMin, int yMax, int expPnts);
+
+
+/*
+    PURPOSE - Determine if a coordinate is occupied
+    INPUT
+        occupy_ptr - Pointer to an occupancy map
+        xCoord - X coordinate to check
+        yCoord - Y coordinate to check
+    OUTPUT
+        If the coordinate is occupied, true
+        Otherwise, false (coordinates outside the field are never occupied)
+        On error, false
+    NOTES
+        This is the O(1) replacement for verify_unique_coordinates() (which returns the opposite)
+ */
+bool is_coordinate_occupied(hsOccupancy_ptr occupy_ptr, int xCoord, int yCoord);
+
+
+/*
+    PURPOSE - Mark a coordinate as occupied
+    INPUT
+        occupy_ptr - Pointer to an occupancy map
+        xCoord - X coordinate to occupy
+        yCoord - Y coordinate to occupy
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Fails if the coordinate is outside the field or already occupied
+ */
+bool occupy_coordinate(hsOccupancy_ptr occupy_ptr, int xCoord, int yCoord);
+
+
+/*
+    PURPOSE - Mark a coordinate as unoccupied
+    INPUT
+        occupy_ptr - Pointer to an occupancy map
+        xCoord - X coordinate to vacate
+        yCoord - Y coordinate to vacate
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Fails if the coordinate is not occupied
+ */
+bool vacate_coordinate(hsOccupancy_ptr occupy_ptr, int xCoord, int yCoord);
+
+
+/*
+    PURPOSE - Move an occupant from one coordinate to another
+    INPUT
+        occupy_ptr - Pointer to an occupancy map
+        oldX - X coordinate to vacate
+        oldY - Y coordinate to vacate
+        newX - X coordinate to occupy
+        newY - Y coordinate to occupy
+    OUTPUT
+        On success, true
+        On failure (e.g., a collision at the new coordinate), false and the map is unchanged
+    NOTES
+        Moving to the same coordinate succeeds without changing anything
+ */
+bool move_coordinate_occupant(hsOccupancy_ptr occupy_ptr, int oldX, int oldY, int newX, int newY);
+
+
+/*
+    PURPOSE - Free the heap-allocated memory associated with an occupancy map
+    INPUT
+        oldOccupy_ptr - A pointer to a heap-allocated hsOccupancy struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Call this function as free_occupancy_map(&myOccupy_ptr);
+ */
+bool free_occupancy_map(hsOccupancy_ptr *oldOccupy_ptr);
+
+
+#endif  // __HARKLEOCCUPANCY__
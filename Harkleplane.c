@@ -0,0 +1,1043 @@
+#include "Harklecurse.h"
+#include "Harklegeom.h"         // calc_int_point_sq_dist()
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harklemove.h"         // move_shawarma_bulk()
+#include "Harkleoccupancy.h"    // is_coordinate_occupied()
+#include "Harkleplane.h"
+#include "Harklestore.h"
+#include "Harkleswarm.h"
+#include <math.h>               // ceil(), sqrt()
+#include <stdlib.h>             // calloc(), free()
+#include <string.h>             // memset()
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Translate a coordinate into the cell that holds it
+    INPUT
+        grid_ptr - Pointer to a built grid
+        xCoord - X coordinate
+        yCoord - Y coordinate
+    OUTPUT
+        The cell number (coordinates outside the field are clamped to the nearest cell)
+    NOTES
+        This function does not perform input validation
+ */
+int calc_plane_cell(hsGrid_ptr grid_ptr, int xCoord, int yCoord)
+{
+    // LOCAL VARIABLES
+    int cellX = xCoord / grid_ptr->cellSize;  // Column of cells
+    int cellY = yCoord / grid_ptr->cellSize;  // Row of cells
+
+    if (xCoord < 0)
+    {
+        cellX = 0;
+    }
+    else if (cellX >= grid_ptr->numCellsX)
+    {
+        cellX = grid_ptr->numCellsX - 1;
+    }
+    if (yCoord < 0)
+    {
+        cellY = 0;
+    }
+    else if (cellY >= grid_ptr->numCellsY)
+    {
+        cellY = grid_ptr->numCellsY - 1;
+    }
+
+    // DONE
+    return (cellY * grid_ptr->numCellsX) + cellX;
+}
+
+
+/*
+    PURPOSE - Add a swarm store index to the front of a cell's list
+    INPUT
+        grid_ptr - Pointer to a built grid
+        index - Swarm store index
+        cell - Cell number
+    OUTPUT
+        None
+    NOTES
+        This function does not perform input validation
+ */
+void link_plane_index(hsGrid_ptr grid_ptr, int index, int cell)
+{
+    grid_ptr->cellOf[index] = cell;
+    grid_ptr->prevInCell[index] = -1;
+    grid_ptr->nextInCell[index] = grid_ptr->cellHead[cell];
+
+    if (-1 != grid_ptr->cellHead[cell])
+    {
+        grid_ptr->prevInCell[grid_ptr->cellHead[cell]] = index;
+    }
+
+    grid_ptr->cellHead[cell] = index;
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Remove a swarm store index from its cell's list
+    INPUT
+        grid_ptr - Pointer to a built grid
+        index - Swarm store index
+    OUTPUT
+        None
+    NOTES
+        This function does not perform input validation
+ */
+void unlink_plane_index(hsGrid_ptr grid_ptr, int index)
+{
+    if (-1 != grid_ptr->prevInCell[index])
+    {
+        grid_ptr->nextInCell[grid_ptr->prevInCell[index]] = grid_ptr->nextInCell[index];
+    }
+    else
+    {
+        grid_ptr->cellHead[grid_ptr->cellOf[index]] = grid_ptr->nextInCell[index];
+    }
+    if (-1 != grid_ptr->nextInCell[index])
+    {
+        grid_ptr->prevInCell[grid_ptr->nextInCell[index]] = grid_ptr->prevInCell[index];
+    }
+
+    grid_ptr->nextInCell[index] = -1;
+    grid_ptr->prevInCell[index] = -1;
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Make sure a plane engine's grid matches the window and the swarm, rebuilding it if not
+    INPUT
+        curWindow - Pointer to a winDetails struct
+        plane_ptr - Pointer to a plane engine
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        A rebuild is O(cells + points).  Afterwards, moves keep the grid in sync.
+        This function does not perform input validation
+ */
+bool prepare_plane_grid(winDetails_ptr curWindow, hsPlane_ptr plane_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;                         // Set this to false if anything fails
+    hsGrid_ptr grid_ptr = &(plane_ptr->grid);    // The grid
+    hsSwarm_ptr swarm_ptr = plane_ptr->swarm_ptr;  // The swarm
+    int cellSize = plane_ptr->reqCellSize;       // Width and height of each cell
+    long long numCells = 0;                      // Number of cells
+    int i = 0;                                   // Iterating variable
+
+    if (false == grid_ptr->valid || curWindow->nRows != grid_ptr->nRows || curWindow->nCols != grid_ptr->nCols
+        || swarm_ptr->numPnts != grid_ptr->numIndexed)
+    {
+        grid_ptr->valid = false;
+
+        // 1. Size the cells
+        if (0 == cellSize)
+        {
+            cellSize = (int)ceil(sqrt(((double)curWindow->nRows * curWindow->nCols * HS_PLANE_CELL_POINTS)
+                                      / ((swarm_ptr->numPnts > 0) ? swarm_ptr->numPnts : 1)));
+        }
+        if (cellSize < 1)
+        {
+            cellSize = 1;
+        }
+
+        grid_ptr->nRows = curWindow->nRows;
+        grid_ptr->nCols = curWindow->nCols;
+        grid_ptr->cellSize = cellSize;
+        grid_ptr->numCellsX = (curWindow->nCols + cellSize - 1) / cellSize;
+        grid_ptr->numCellsY = (curWindow->nRows + cellSize - 1) / cellSize;
+        numCells = (long long)grid_ptr->numCellsX * grid_ptr->numCellsY;
+
+        if (1 > numCells || numCells > 0x7FFFFFFF)
+        {
+            HARKLE_ERROR(Harkleplane, prepare_plane_grid, Invalid window dimensions);
+            success = false;
+        }
+
+        // 2. Allocate
+        if (true == success)
+        {
+            if (grid_ptr->cellHead)
+            {
+                free(grid_ptr->cellHead);
+            }
+
+            grid_ptr->cellHead = calloc(numCells, sizeof(int));
+
+            if (!(grid_ptr->cellHead))
+            {
+                HARKLE_ERROR(Harkleplane, prepare_plane_grid, calloc failed);
+                success = false;
+            }
+        }
+        if (true == success && grid_ptr->maxIndexed < swarm_ptr->numPnts)
+        {
+            if (grid_ptr->cellOf)
+            {
+                free(grid_ptr->cellOf);
+            }
+            if (grid_ptr->nextInCell)
+            {
+                free(grid_ptr->nextInCell);
+            }
+            if (grid_ptr->prevInCell)
+            {
+                free(grid_ptr->prevInCell);
+            }
+
+            grid_ptr->maxIndexed = 0;
+            grid_ptr->cellOf = calloc(swarm_ptr->numPnts, sizeof(int));
+            grid_ptr->nextInCell = calloc(swarm_ptr->numPnts, sizeof(int));
+            grid_ptr->prevInCell = calloc(swarm_ptr->numPnts, sizeof(int));
+
+            if (!(grid_ptr->cellOf) || !(grid_ptr->nextInCell) || !(grid_ptr->prevInCell))
+            {
+                HARKLE_ERROR(Harkleplane, prepare_plane_grid, calloc failed);
+                success = false;
+            }
+            else
+            {
+                grid_ptr->maxIndexed = swarm_ptr->numPnts;
+            }
+        }
+
+        // 3. Bucket every point
+        if (true == success)
+        {
+            memset(grid_ptr->cellHead, 0xFF, numCells * sizeof(int));  // Every cell starts empty (-1)
+
+            for (i = 0; i < swarm_ptr->numPnts; i++)
+            {
+                link_plane_index(grid_ptr, i, calc_plane_cell(grid_ptr, swarm_ptr->absX[i], swarm_ptr->absY[i]));
+            }
+
+            grid_ptr->numIndexed = swarm_ptr->numPnts;
+            grid_ptr->valid = true;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Search the grid, ring by ring, for the points closest to a coordinate
+    INPUT
+        curWindow - Pointer to a winDetails struct
+        plane_ptr - Pointer to a plane engine with a prepared grid
+        index - Swarm store index of the point the search is for (it is never its own neighbour)
+        srcX - X coordinate of the 'origin' (the point's own, or one it's considering moving to)
+        srcY - Y coordinate of the 'origin'
+        intercepts - If true, the field's walls are treated as points
+        coord_arr - Array of HS_PLANE_NEIGHBOURS hsLineLen struct pointers to use as 'out' parameters
+    OUTPUT
+        On success, number of coord_arr entries populated, closest first
+        On failure, -1
+    NOTES
+        Every point in ring r (the cells r cells away from the point's own cell) is at least
+            (r - 1) * cellSize, plus the point's distance to the edge of its own cell, away.  The search stops
+            once the farthest point kept is closer than that.
+        Candidates are ranked by squared distance (exact in a double) and only the ones kept get a square root
+        Equal distances go to the lower posNum and walls rank after every point (see: keep_closest_coordinate())
+            so this finds the same points as find_closest_two_dim_points()
+        This function does not perform input validation
+ */
+int search_plane_grid(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int index, int srcX, int srcY,
+                      bool intercepts, hsLineLen_ptr *coord_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = 0;                              // Number of coord_arr entries in use
+    hsGrid_ptr grid_ptr = &(plane_ptr->grid);      // The grid
+    hsSwarm_ptr swarm_ptr = plane_ptr->swarm_ptr;  // The swarm
+    int homeCell = calc_plane_cell(grid_ptr, srcX, srcY);  // Cell holding the 'origin'
+    int homeX = homeCell % grid_ptr->numCellsX;    // Column of homeCell
+    int homeY = homeCell / grid_ptr->numCellsX;    // Row of homeCell
+    int maxRing = 0;                               // Farthest ring that holds any cell
+    int edgeDist = 0;                              // Distance from the 'origin' point to the edge of homeCell
+    int ring = 0;                                  // Current ring
+    int cellX = 0;                                 // Column of the cell being searched
+    int cellY = 0;                                 // Row of the cell being searched
+    int lowY = 0;                                  // Top row of the ring inside the grid
+    int highY = 0;                                 // Bottom row of the ring inside the grid
+    int step = 0;                                  // Column increment along the current row of the ring
+    int other = 0;                                 // Swarm store index of a point in the cell
+    long long ringDist = 0;                        // Closest any point in the current ring can be
+    long long tieKey_arr[HS_PLANE_NEIGHBOURS];     // Tie keys of the coord_arr entries
+    int i = 0;                                     // Iterating variable
+    hsLineLen wall_arr[4];                         // The field's walls
+
+    // 1. Walls
+    if (true == intercepts)
+    {
+        if (false == calc_two_dim_wall_points(curWindow, srcX, srcY, wall_arr))
+        {
+            HARKLE_ERROR(Harkleplane, search_plane_grid, calc_two_dim_wall_points failed);
+            numFound = -1;
+        }
+        for (i = 0; i < 4 && 0 <= numFound; i++)
+        {
+            numFound = keep_closest_coordinate(coord_arr, tieKey_arr, HS_PLANE_NEIGHBOURS, numFound,
+                                               wall_arr[i].xCoord, wall_arr[i].yCoord,
+                                               wall_arr[i].dist * wall_arr[i].dist, HS_WALL_TIE_KEY(i));
+        }
+    }
+
+    // 2. Rings of cells
+    if (0 <= numFound)
+    {
+        maxRing = homeX;
+        maxRing = (grid_ptr->numCellsX - 1 - homeX > maxRing) ? grid_ptr->numCellsX - 1 - homeX : maxRing;
+        maxRing = (homeY > maxRing) ? homeY : maxRing;
+        maxRing = (grid_ptr->numCellsY - 1 - homeY > maxRing) ? grid_ptr->numCellsY - 1 - homeY : maxRing;
+        edgeDist = srcX - (homeX * grid_ptr->cellSize);
+        edgeDist = ((homeX + 1) * grid_ptr->cellSize - 1 - srcX < edgeDist)
+                   ? (homeX + 1) * grid_ptr->cellSize - 1 - srcX : edgeDist;
+        edgeDist = (srcY - (homeY * grid_ptr->cellSize) < edgeDist) ? srcY - (homeY * grid_ptr->cellSize) : edgeDist;
+        edgeDist = ((homeY + 1) * grid_ptr->cellSize - 1 - srcY < edgeDist)
+                   ? (homeY + 1) * grid_ptr->cellSize - 1 - srcY : edgeDist;
+        edgeDist = (edgeDist < 0) ? 0 : edgeDist;  // Points outside the field were clamped into homeCell
+    }
+
+    for (ring = 0; ring <= maxRing && 0 <= numFound; ring++)
+    {
+        ringDist = ((ring - 1) * (long long)grid_ptr->cellSize) + edgeDist + 1;
+
+        if (ring > 0 && HS_PLANE_NEIGHBOURS == numFound
+            && coord_arr[HS_PLANE_NEIGHBOURS - 1]->dist < (double)(ringDist * ringDist))
+        {
+            break;  // Nothing in this ring, or beyond, is closer (or as close, with a lower posNum)
+        }
+
+        lowY = (homeY - ring < 0) ? 0 : homeY - ring;
+        highY = (homeY + ring >= grid_ptr->numCellsY) ? grid_ptr->numCellsY - 1 : homeY + ring;
+
+        for (cellY = lowY; cellY <= highY && 0 <= numFound; cellY++)
+        {
+            // The top and bottom rows of the ring are whole.  Every other row is just its two ends.
+            step = (cellY == homeY - ring || cellY == homeY + ring) ? 1 : 2 * ring;
+
+            for (cellX = homeX - ring; cellX <= homeX + ring && 0 <= numFound; cellX += step)
+            {
+                if (cellX >= 0 && cellX < grid_ptr->numCellsX)
+                {
+                    other = grid_ptr->cellHead[(cellY * grid_ptr->numCellsX) + cellX];
+
+                    while (-1 != other && 0 <= numFound)
+                    {
+                        if (other != index)
+                        {
+                            numFound = keep_closest_coordinate(coord_arr, tieKey_arr, HS_PLANE_NEIGHBOURS,
+                                                               numFound, swarm_ptr->absX[other],
+                                                               swarm_ptr->absY[other],
+                                                               (double)calc_int_point_sq_dist(srcX, srcY,
+                                                                                              swarm_ptr->absX[other],
+                                                                                              swarm_ptr->absY[other]),
+                                                               swarm_ptr->posNum[other]);
+                        }
+
+                        other = grid_ptr->nextInCell[other];
+                    }
+                }
+            }
+        }
+    }
+
+    if (0 > numFound)
+    {
+        HARKLE_ERROR(Harkleplane, search_plane_grid, keep_closest_coordinate failed);
+    }
+
+    // 3. Measure the keepers
+    for (i = 0; i < numFound; i++)
+    {
+        coord_arr[i]->dist = sqrt(coord_arr[i]->dist);
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+/*
+    PURPOSE - Determine if a coordinate is held by any point in the swarm
+    INPUT
+        plane_ptr - Pointer to a plane engine with a prepared grid
+        xCoord - X coordinate
+        yCoord - Y coordinate
+    OUTPUT
+        If the coordinate is occupied, true
+        Otherwise, false
+    NOTES
+        Uses the swarm store's occupancy map, if attached, and otherwise scans the coordinate's cell
+        This function does not perform input validation
+ */
+bool is_plane_coord_occupied(hsPlane_ptr plane_ptr, int xCoord, int yCoord)
+{
+    // LOCAL VARIABLES
+    bool retVal = false;                           // Set this to true if a point holds the coordinate
+    hsSwarm_ptr swarm_ptr = plane_ptr->swarm_ptr;  // The swarm
+    int other = -1;                                // Swarm store index of a point in the coordinate's cell
+
+    if (swarm_ptr->occupy_ptr)
+    {
+        retVal = is_coordinate_occupied(swarm_ptr->occupy_ptr, xCoord, yCoord);
+    }
+    else
+    {
+        other = plane_ptr->grid.cellHead[calc_plane_cell(&(plane_ptr->grid), xCoord, yCoord)];
+
+        while (-1 != other && false == retVal)
+        {
+            if (xCoord == swarm_ptr->absX[other] && yCoord == swarm_ptr->absY[other])
+            {
+                retVal = true;
+            }
+
+            other = plane_ptr->grid.nextInCell[other];
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Move the point at swarm store index 'index', keeping the window and grid in sync
+    INPUT
+        curWindow - Pointer to a winDetails struct
+        plane_ptr - Pointer to a plane engine with a prepared grid
+        index - Swarm store index of the point to move
+        newX - X coordinate to move to
+        newY - Y coordinate to move to
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This function does not perform input validation
+ */
+bool commit_plane_move(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int index, int newX, int newY)
+{
+    // LOCAL VARIABLES
+    bool success = true;                           // Set this to false if anything fails
+    hsSwarm_ptr swarm_ptr = plane_ptr->swarm_ptr;  // The swarm
+    int newCell = 0;                               // Cell holding the point after its move
+    shawarma oldNode;                              // Stack copy of the point before its move, to clear it
+
+    memset(&oldNode, 0x0, sizeof(oldNode));
+    oldNode.absX = swarm_ptr->absX[index];
+    oldNode.absY = swarm_ptr->absY[index];
+
+    if (curWindow->win_ptr && false == clear_this_coord(curWindow, &oldNode))
+    {
+        HARKLE_ERROR(Harkleplane, commit_plane_move, clear_this_coord failed);
+        success = false;
+    }
+    else if (false == move_swarm_point(swarm_ptr, index, newX, newY))
+    {
+        HARKLE_ERROR(Harkleplane, commit_plane_move, move_swarm_point failed);
+        success = false;
+    }
+    else
+    {
+        newCell = calc_plane_cell(&(plane_ptr->grid), newX, newY);
+
+        if (newCell != plane_ptr->grid.cellOf[index])
+        {
+            unlink_plane_index(&(plane_ptr->grid), index);
+            link_plane_index(&(plane_ptr->grid), index, newCell);
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Make sure the bulk sweep buffers can hold every point in the swarm
+    INPUT
+        plane_ptr - Pointer to a plane engine
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The buffers are only ever grown, and their contents never need to survive a sweep, so they are
+            simply reallocated
+        This function does not perform input validation
+ */
+bool prepare_plane_bulk(hsPlane_ptr plane_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;                                // Set this to false if anything fails
+    int numPnts = plane_ptr->swarm_ptr->numPnts;        // Number of points to make room for
+    int **buf_arr[] = { &(plane_ptr->targetX), &(plane_ptr->targetY), &(plane_ptr->nextX), &(plane_ptr->nextY),
+                        &(plane_ptr->nextMoves), NULL };
+    int i = 0;                                          // Iterating variable
+
+    if (plane_ptr->maxBulk < numPnts)
+    {
+        for (i = 0; NULL != buf_arr[i] && true == success; i++)
+        {
+            if (*(buf_arr[i]))
+            {
+                free(*(buf_arr[i]));
+            }
+
+            *(buf_arr[i]) = calloc(numPnts, sizeof(int));
+
+            if (!(*(buf_arr[i])))
+            {
+                HARKLE_ERROR(Harkleplane, prepare_plane_bulk, calloc failed);
+                success = false;
+            }
+        }
+
+        if (true == success)
+        {
+            if (plane_ptr->closeBuf)
+            {
+                free(plane_ptr->closeBuf);
+            }
+
+            plane_ptr->closeBuf = calloc((size_t)numPnts * HS_PLANE_NEIGHBOURS, sizeof(hsLineLen));
+
+            if (!(plane_ptr->closeBuf))
+            {
+                HARKLE_ERROR(Harkleplane, prepare_plane_bulk, calloc failed);
+                success = false;
+            }
+        }
+
+        plane_ptr->maxBulk = (true == success) ? numPnts : 0;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Move the point at swarm store index 'index' toward equilibrium
+    INPUT
+        curWindow - Pointer to a winDetails struct
+        plane_ptr - Pointer to a plane engine with a prepared grid
+        index - Swarm store index of the point to move
+        maxMoves - Number of one-dimensional moves the point may move
+        intercepts - If true, the field's walls will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, number of moves made
+        On failure, -1
+    NOTES
+        This function does not perform input validation
+ */
+int shwarm_plane_index(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int index, int maxMoves, bool intercepts)
+{
+    // LOCAL VARIABLES
+    int numMoves = -1;                             // Number of moves made
+    bool success = true;                           // Set this to false if anything fails
+    hsSwarm_ptr swarm_ptr = plane_ptr->swarm_ptr;  // The swarm
+    int numClosePnts = 0;                          // Return value from search_plane_grid()
+    shawarma srcNode;                              // The point before its move
+    shawarma stepNode;                             // The point after its last unblocked step
+    shawarma tmpNode;                              // The point after its next step
+    hsLineLen point1 = { 0, 0, 0.0 };              // Out parameter for search_plane_grid()
+    hsLineLen point2 = { 0, 0, 0.0 };              // Out parameter for search_plane_grid()
+    hsLineLen point3 = { 0, 0, 0.0 };              // Out parameter for search_plane_grid()
+    hsLineLen target = { 0, 0, 0.0 };              // Out parameter for determine_triangulation_point()
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, &point3, NULL };
+    int newClosePnts = 0;                          // Return value from search_plane_grid() after the move
+    hsLineLen newPoint1 = { 0, 0, 0.0 };           // Out parameter for search_plane_grid() after the move
+    hsLineLen newPoint2 = { 0, 0, 0.0 };           // Out parameter for search_plane_grid() after the move
+    hsLineLen newPoint3 = { 0, 0, 0.0 };           // Out parameter for search_plane_grid() after the move
+    hsLineLen_ptr newCoord_arr[] = { &newPoint1, &newPoint2, &newPoint3, NULL };
+
+    // 1. Find the closest points
+    numClosePnts = search_plane_grid(curWindow, plane_ptr, index, swarm_ptr->absX[index], swarm_ptr->absY[index],
+                                     intercepts, coord_arr);
+
+    if (0 > numClosePnts)
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_index, search_plane_grid failed);
+        success = false;
+    }
+    // 2. Calculate the target (as long as the point is pinned by three others)
+    else if (HS_PLANE_NEIGHBOURS == numClosePnts && false == determine_triangulation_point(curWindow, coord_arr,
+                                                                                           &target))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_index, determine_triangulation_point failed);
+        success = false;
+    }
+    else
+    {
+        memset(&srcNode, 0x0, sizeof(srcNode));
+        srcNode.absX = swarm_ptr->absX[index];
+        srcNode.absY = swarm_ptr->absY[index];
+        srcNode.posNum = swarm_ptr->posNum[index];
+        srcNode.graphic = swarm_ptr->graphic[index];
+        srcNode.hcFlags = swarm_ptr->hcFlags[index];
+        stepNode = srcNode;
+        numMoves = 0;
+    }
+
+    // 3. Step toward the target until it's reached, or blocked
+    while (true == success && HS_PLANE_NEIGHBOURS == numClosePnts && numMoves < maxMoves)
+    {
+        tmpNode = stepNode;
+
+        if (1 != move_shawarma(&tmpNode, &target, 1)
+            || true == is_plane_coord_occupied(plane_ptr, tmpNode.absX, tmpNode.absY))
+        {
+            break;  // On target or blocked
+        }
+
+        stepNode = tmpNode;
+        numMoves++;
+    }
+
+    // 4. Only keep a move that leaves the point closer to equidistant from its (new) closest points
+    if (true == success && 0 < numMoves)
+    {
+        newClosePnts = search_plane_grid(curWindow, plane_ptr, index, stepNode.absX, stepNode.absY, intercepts,
+                                         newCoord_arr);
+
+        if (0 > newClosePnts)
+        {
+            HARKLE_ERROR(Harkleplane, shwarm_plane_index, search_plane_grid failed);
+            numMoves = -1;
+        }
+        else if (HS_PLANE_NEIGHBOURS == newClosePnts && false == is_triangulation_improved(coord_arr, newCoord_arr))
+        {
+            numMoves = 0;  // No better off
+        }
+    }
+
+    // 5. Commit the move
+    if (true == success && 0 < numMoves
+        && false == commit_plane_move(curWindow, plane_ptr, index, stepNode.absX, stepNode.absY))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_index, commit_plane_move failed);
+        numMoves = -1;
+    }
+
+    // DONE
+    return numMoves;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsPlane_ptr build_plane_engine(hsSwarm_ptr swarm_ptr, int cellSize)
+{
+    // LOCAL VARIABLES
+    hsPlane_ptr retVal = NULL;  // Plane engine to return
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harkleplane, build_plane_engine, Invalid swarm_ptr);
+    }
+    else if (0 > cellSize)
+    {
+        HARKLE_ERROR(Harkleplane, build_plane_engine, Invalid cellSize);
+    }
+    else
+    {
+        // ALLOCATE
+        retVal = calloc(1, sizeof(hsPlane));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harkleplane, build_plane_engine, calloc failed);
+        }
+        else
+        {
+            retVal->swarm_ptr = swarm_ptr;
+            retVal->reqCellSize = cellSize;
+            retVal->grid.valid = false;  // Built by the first call with a window
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int find_plane_neighbours(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int index, bool intercepts,
+                          hsLineLen_ptr *coord_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = -1;  // Number of coord_arr entries populated
+    int i = 0;          // Iterating variable
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleplane, find_plane_neighbours, Invalid curWindow);
+    }
+    else if (!plane_ptr || !(plane_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleplane, find_plane_neighbours, Invalid plane_ptr);
+    }
+    else if (0 > index || index >= plane_ptr->swarm_ptr->numPnts)
+    {
+        HARKLE_ERROR(Harkleplane, find_plane_neighbours, Invalid index);
+    }
+    else if (!coord_arr)
+    {
+        HARKLE_ERROR(Harkleplane, find_plane_neighbours, Invalid coord_arr);
+    }
+    else
+    {
+        for (i = 0; i < HS_PLANE_NEIGHBOURS; i++)
+        {
+            if (!(coord_arr[i]))
+            {
+                HARKLE_ERROR(Harkleplane, find_plane_neighbours, Invalid coord_arr entry);
+                break;
+            }
+        }
+
+        // SEARCH
+        if (HS_PLANE_NEIGHBOURS == i)
+        {
+            if (false == prepare_plane_grid(curWindow, plane_ptr))
+            {
+                HARKLE_ERROR(Harkleplane, find_plane_neighbours, prepare_plane_grid failed);
+            }
+            else
+            {
+                numFound = search_plane_grid(curWindow, plane_ptr, index, plane_ptr->swarm_ptr->absX[index],
+                                             plane_ptr->swarm_ptr->absY[index], intercepts, coord_arr);
+            }
+        }
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+int shwarm_plane_point(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int shNum, int maxMoves, bool intercepts)
+{
+    // LOCAL VARIABLES
+    int numMoves = -1;  // Number of moves made
+    int index = -1;     // Swarm store index of shNum
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_point, Invalid curWindow);
+    }
+    else if (!plane_ptr || !(plane_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_point, Invalid plane_ptr);
+    }
+    else if (maxMoves < 1)
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_point, Invalid maxMoves);
+    }
+    else
+    {
+        index = get_swarm_index(plane_ptr->swarm_ptr, shNum);
+
+        if (0 > index)
+        {
+            HARKLE_ERROR(Harkleplane, shwarm_plane_point, get_swarm_index failed);
+        }
+        else if (false == prepare_plane_grid(curWindow, plane_ptr))
+        {
+            HARKLE_ERROR(Harkleplane, shwarm_plane_point, prepare_plane_grid failed);
+        }
+        else
+        {
+            numMoves = shwarm_plane_index(curWindow, plane_ptr, index, maxMoves, intercepts);
+
+            if (0 > numMoves)
+            {
+                HARKLE_ERROR(Harkleplane, shwarm_plane_point, shwarm_plane_index failed);
+            }
+        }
+    }
+
+    // DONE
+    return numMoves;
+}
+
+
+long shwarm_plane_sweep(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int maxMoves, bool intercepts)
+{
+    // LOCAL VARIABLES
+    long totMoves = -1;  // Total number of moves made
+    int numMoves = 0;    // Number of moves made by one point
+    int i = 0;           // Iterating variable
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_sweep, Invalid curWindow);
+    }
+    else if (!plane_ptr || !(plane_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_sweep, Invalid plane_ptr);
+    }
+    else if (maxMoves < 1)
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_sweep, Invalid maxMoves);
+    }
+    else if (false == prepare_plane_grid(curWindow, plane_ptr))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_sweep, prepare_plane_grid failed);
+    }
+    else
+    {
+        totMoves = 0;
+
+        for (i = 0; i < plane_ptr->swarm_ptr->numPnts; i++)
+        {
+            numMoves = shwarm_plane_index(curWindow, plane_ptr, i, maxMoves, intercepts);
+
+            if (0 > numMoves)
+            {
+                HARKLE_ERROR(Harkleplane, shwarm_plane_sweep, shwarm_plane_index failed);
+                totMoves = -1;
+                break;
+            }
+
+            totMoves += numMoves;
+        }
+    }
+
+    // DONE
+    return totMoves;
+}
+
+
+long shwarm_plane_bulk_sweep(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int maxMoves, bool intercepts)
+{
+    // LOCAL VARIABLES
+    long totMoves = -1;                       // Total number of moves made
+    bool success = true;                      // Set this to false if anything fails
+    hsSwarm_ptr swarm_ptr = NULL;             // The swarm
+    int numClosePnts = 0;                     // Return value from search_plane_grid()
+    hsLineLen target = { 0, 0, 0.0 };         // Out parameter for determine_triangulation_point()
+    hsLineLen_ptr coord_arr[HS_PLANE_NEIGHBOURS + 1] = { NULL };  // One point's entries in closeBuf
+    hsLineLen newPoint1 = { 0, 0, 0.0 };      // Out parameter for search_plane_grid() after the move
+    hsLineLen newPoint2 = { 0, 0, 0.0 };      // Out parameter for search_plane_grid() after the move
+    hsLineLen newPoint3 = { 0, 0, 0.0 };      // Out parameter for search_plane_grid() after the move
+    hsLineLen_ptr newCoord_arr[] = { &newPoint1, &newPoint2, &newPoint3, NULL };
+    int i = 0;                                // Iterating variable
+    int j = 0;                                // Iterating variable
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, Invalid curWindow);
+        success = false;
+    }
+    else if (!plane_ptr || !(plane_ptr->swarm_ptr))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, Invalid plane_ptr);
+        success = false;
+    }
+    else if (maxMoves < 1)
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, Invalid maxMoves);
+        success = false;
+    }
+    else if (false == prepare_plane_grid(curWindow, plane_ptr))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, prepare_plane_grid failed);
+        success = false;
+    }
+    else if (false == prepare_plane_bulk(plane_ptr))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, prepare_plane_bulk failed);
+        success = false;
+    }
+    else
+    {
+        swarm_ptr = plane_ptr->swarm_ptr;
+    }
+
+    // SWEEP
+    // 1. Aim every point at the point equidistant from its closest points (nothing moves yet)
+    for (i = 0; true == success && i < swarm_ptr->numPnts; i++)
+    {
+        plane_ptr->targetX[i] = swarm_ptr->absX[i];
+        plane_ptr->targetY[i] = swarm_ptr->absY[i];
+
+        for (j = 0; j < HS_PLANE_NEIGHBOURS; j++)
+        {
+            coord_arr[j] = plane_ptr->closeBuf + (i * HS_PLANE_NEIGHBOURS) + j;
+        }
+
+        numClosePnts = search_plane_grid(curWindow, plane_ptr, i, swarm_ptr->absX[i], swarm_ptr->absY[i],
+                                         intercepts, coord_arr);
+
+        if (0 > numClosePnts)
+        {
+            HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, search_plane_grid failed);
+            success = false;
+        }
+        else if (HS_PLANE_NEIGHBOURS == numClosePnts)
+        {
+            if (false == determine_triangulation_point(curWindow, coord_arr, &target))
+            {
+                HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, determine_triangulation_point failed);
+                success = false;
+            }
+            else
+            {
+                plane_ptr->targetX[i] = target.xCoord;
+                plane_ptr->targetY[i] = target.yCoord;
+            }
+        }
+    }
+
+    // 2. Move every point toward its target at once
+    if (true == success && 0 > move_shawarma_bulk(swarm_ptr->absX, swarm_ptr->absY, plane_ptr->targetX,
+                                                  plane_ptr->targetY, swarm_ptr->numPnts, maxMoves, plane_ptr->nextX,
+                                                  plane_ptr->nextY, plane_ptr->nextMoves))
+    {
+        HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, move_shawarma_bulk failed);
+        success = false;
+    }
+
+    // 3. Only keep a move that leaves the point closer to equidistant from its (new) closest points
+    for (i = 0; true == success && i < swarm_ptr->numPnts; i++)
+    {
+        if (0 < plane_ptr->nextMoves[i])
+        {
+            for (j = 0; j < HS_PLANE_NEIGHBOURS; j++)
+            {
+                coord_arr[j] = plane_ptr->closeBuf + (i * HS_PLANE_NEIGHBOURS) + j;
+            }
+
+            numClosePnts = search_plane_grid(curWindow, plane_ptr, i, plane_ptr->nextX[i], plane_ptr->nextY[i],
+                                             intercepts, newCoord_arr);
+
+            if (0 > numClosePnts)
+            {
+                HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, search_plane_grid failed);
+                success = false;
+            }
+            else if (HS_PLANE_NEIGHBOURS == numClosePnts
+                     && false == is_triangulation_improved(coord_arr, newCoord_arr))
+            {
+                plane_ptr->nextMoves[i] = 0;  // No better off
+            }
+        }
+    }
+
+    // 4. Commit, in one pass, skipping proposals that land on a point
+    if (true == success)
+    {
+        totMoves = 0;
+
+        for (i = 0; i < swarm_ptr->numPnts; i++)
+        {
+            if (0 < plane_ptr->nextMoves[i]
+                && false == is_plane_coord_occupied(plane_ptr, plane_ptr->nextX[i], plane_ptr->nextY[i]))
+            {
+                if (false == commit_plane_move(curWindow, plane_ptr, i, plane_ptr->nextX[i], plane_ptr->nextY[i]))
+                {
+                    HARKLE_ERROR(Harkleplane, shwarm_plane_bulk_sweep, commit_plane_move failed);
+                    totMoves = -1;
+                    break;
+                }
+
+                totMoves += plane_ptr->nextMoves[i];
+            }
+        }
+    }
+
+    // DONE
+    return totMoves;
+}
+
+
+bool free_plane_engine(hsPlane_ptr *oldPlane_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;          // Set this to true if the engine is freed
+    hsPlane_ptr plane_ptr = NULL;  // Local copy of *oldPlane_ptr
+
+    // INPUT VALIDATION
+    if (!oldPlane_ptr || !(*oldPlane_ptr))
+    {
+        HARKLE_ERROR(Harkleplane, free_plane_engine, Invalid oldPlane_ptr);
+    }
+    else
+    {
+        // FREE
+        plane_ptr = *oldPlane_ptr;
+
+        if (plane_ptr->grid.cellHead)
+        {
+            free(plane_ptr->grid.cellHead);
+        }
+        if (plane_ptr->grid.cellOf)
+        {
+            free(plane_ptr->grid.cellOf);
+        }
+        if (plane_ptr->grid.nextInCell)
+        {
+            free(plane_ptr->grid.nextInCell);
+        }
+        if (plane_ptr->grid.prevInCell)
+        {
+            free(plane_ptr->grid.prevInCell);
+        }
+        if (plane_ptr->targetX)
+        {
+            free(plane_ptr->targetX);
+        }
+        if (plane_ptr->targetY)
+        {
+            free(plane_ptr->targetY);
+        }
+        if (plane_ptr->nextX)
+        {
+            free(plane_ptr->nextX);
+        }
+        if (plane_ptr->nextY)
+        {
+            free(plane_ptr->nextY);
+        }
+        if (plane_ptr->nextMoves)
+        {
+            free(plane_ptr->nextMoves);
+        }
+        if (plane_ptr->closeBuf)
+        {
+            free(plane_ptr->closeBuf);
+        }
+
+        memset(plane_ptr, 0x0, sizeof(hsPlane));
+        free(plane_ptr);
+        *oldPlane_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
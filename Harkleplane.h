@@ -0,0 +1,161 @@
+#ifndef __HARKLEPLANE__
+#define __HARKLEPLANE__
+
+#include "Harklecurse.h"        // winDetails_ptr
+#include "Harklestore.h"        // hsSwarm_ptr
+#include "Harkleswarm.h"        // hsLineLen_ptr
+#include <stdbool.h>            // bool, true, false
+
+// Number of closest points that pin a point in two dimensions (see: determine_triangulation_point())
+#define HS_PLANE_NEIGHBOURS 3
+// Average number of points per grid cell the plane engine sizes its cells for
+#define HS_PLANE_CELL_POINTS 2
+
+// Defines the struct that buckets a swarm store's points into a uniform grid of square cells
+//  Each cell holds an intrusive, doubly linked, list of swarm store indices so inserting, removing and
+//  moving a point between cells is O(1).  With cells sized for a few points each, the closest points are
+//  found in the first ring or two of cells around a point: O(1) expected per query.
+typedef struct hsPlaneGrid
+{
+    bool valid;               // If false, the grid must be rebuilt before use
+    int nRows;                // nRows of the window the grid was built for
+    int nCols;                // nCols of the window the grid was built for
+    int cellSize;             // Width (and height) of every cell
+    int numCellsX;            // Number of columns of cells
+    int numCellsY;            // Number of rows of cells
+    int *cellHead;            // cellHead[cell] is the swarm store index of the cell's first point (-1 if empty)
+    int numIndexed;           // Number of swarm store points in the grid
+    int maxIndexed;           // Capacity of the per-point arrays below
+    int *cellOf;              // cellOf[index] is the cell holding swarm store index 'index'
+    int *nextInCell;          // nextInCell[index] is the next point in the same cell (-1 for the last)
+    int *prevInCell;          // prevInCell[index] is the previous point in the same cell (-1 for the first)
+} hsGrid, *hsGrid_ptr;
+
+// Defines the struct that swarms a swarm store in two dimensions
+//  Every point moves toward the point equidistant from its three closest points, treating the field's walls
+//  as points if asked to (see: determine_triangulation_point()).  The neighbours come from a uniform grid
+//  (see: hsGrid) instead of a scan of the swarm so a sweep is linear in the number of points.
+//  The grid is built by the first call that passes a window (and rebuilt if the window, or the number of
+//  points, changes).  Move points with the plane engine functions so the grid stays in sync.
+//  A move is only kept if it shrinks the spread of the point's three distances by a whole step (see:
+//  is_triangulation_improved()) or rounding to the lattice would keep some points trading places forever.
+typedef struct hsPlaneEngine
+{
+    hsSwarm_ptr swarm_ptr;    // Swarm store being organized (not owned by the engine)
+    int reqCellSize;          // Cell size requested by the caller (0 to size cells for HS_PLANE_CELL_POINTS)
+    hsGrid grid;              // Uniform grid spatial index of swarm_ptr
+    int maxBulk;              // Capacity of the bulk sweep buffers below (allocated on first use)
+    int *targetX;             // targetX[index] is the x coordinate swarm store index 'index' is headed for
+    int *targetY;             // targetY[index] is the y coordinate swarm store index 'index' is headed for
+    int *nextX;               // nextX[index] is the x coordinate swarm store index 'index' proposes to move to
+    int *nextY;               // nextY[index] is the y coordinate swarm store index 'index' proposes to move to
+    int *nextMoves;           // nextMoves[index] is the number of moves swarm store index 'index' proposes
+    hsLineLen *closeBuf;      // HS_PLANE_NEIGHBOURS closest points, per index, before the proposed moves
+} hsPlane, *hsPlane_ptr;
+
+
+/*
+    PURPOSE - Allocate a plane engine for a swarm store
+    INPUT
+        swarm_ptr - Pointer to a swarm store
+        cellSize - Width and height of each grid cell (If 0, cells are sized for HS_PLANE_CELL_POINTS each)
+    OUTPUT
+        On success, pointer to a heap-allocated hsPlane struct
+        On failure, NULL
+    NOTES
+        The engine does not own swarm_ptr
+        It is the caller's responsibility to free the memory with free_plane_engine()
+ */
+hsPlane_ptr build_plane_engine(hsSwarm_ptr swarm_ptr, int cellSize);
+
+
+/*
+    PURPOSE - Find the closest points to one point in the swarm
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to size the grid and determine the field's walls)
+        plane_ptr - Pointer to a plane engine
+        index - Swarm store index of the 'origin' point
+        intercepts - If true, the field's walls are treated as points
+        coord_arr - Array of HS_PLANE_NEIGHBOURS hsLineLen struct pointers to use as 'out' parameters
+    OUTPUT
+        On success, number of coord_arr entries populated, closest first
+        On failure, -1
+    NOTES
+        This is the grid-backed equivalent of find_closest_points() with a three entry coord_arr
+ */
+int find_plane_neighbours(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int index, bool intercepts,
+                          hsLineLen_ptr *coord_arr);
+
+
+/*
+    PURPOSE - Move one point toward equilibrium
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine the field's walls)
+        plane_ptr - Pointer to a plane engine
+        shNum - Identifying number (posNum) of the point to move
+        maxMoves - Number of one-dimensional moves the point may move to pursue equilibrium
+        intercepts - If true, the field's walls will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, number of moves made (not to exceed maxMoves).  0 indicates equilibrium (or a blocked point).
+        On failure, -1
+    NOTES
+        This is the plane engine equivalent of shwarm_it(..., 2, ...).  The point moves with move_shawarma()
+            one step at a time and stops short of any occupied coordinate.
+ */
+int shwarm_plane_point(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int shNum, int maxMoves, bool intercepts);
+
+
+/*
+    PURPOSE - Move every point in the swarm once toward equilibrium
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine the field's walls)
+        plane_ptr - Pointer to a plane engine
+        maxMoves - Number of one-dimensional moves each point may move to pursue equilibrium
+        intercepts - If true, the field's walls will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, total number of moves made by all points.  0 indicates equilibrium.
+        On failure, -1
+    NOTES
+        Points are moved in swarm store order and each one sees the moves made before it
+ */
+long shwarm_plane_sweep(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int maxMoves, bool intercepts);
+
+
+/*
+    PURPOSE - Move every point in the swarm once toward equilibrium, all at once
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine the field's walls)
+        plane_ptr - Pointer to a plane engine
+        maxMoves - Number of one-dimensional moves each point may move to pursue equilibrium
+        intercepts - If true, the field's walls will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, total number of moves made by all points.  0 indicates equilibrium.
+        On failure, -1
+    NOTES
+        shwarm_plane_sweep() is Gauss-Seidel: each point sees the moves made before it.  This sweep is Jacobi:
+            every point is aimed at a target calculated from the same (unmoved) swarm, every move is calculated
+            at once by move_shawarma_bulk(), and the moves are committed in one pass, in swarm store order.
+        A point jumps straight to its proposed coordinate instead of stepping there so it can pass other
+            points.  A proposal that lands on a point (including one committed earlier in the pass) is dropped.
+            A proposal that doesn't improve the point's equilibrium is dropped too (see:
+            is_triangulation_improved()).
+        The path to equilibrium (and the number of sweeps) differs from shwarm_plane_sweep()'s
+ */
+long shwarm_plane_bulk_sweep(winDetails_ptr curWindow, hsPlane_ptr plane_ptr, int maxMoves, bool intercepts);
+
+
+/*
+    PURPOSE - Free the heap-allocated memory associated with a plane engine
+    INPUT
+        oldPlane_ptr - A pointer to a heap-allocated hsPlane struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The swarm store is not freed
+        Call this function as free_plane_engine(&myPlane_ptr);
+ */
+bool free_plane_engine(hsPlane_ptr *oldPlane_ptr);
+
+
+#endif  // __HARKLEPLANE__
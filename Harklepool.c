@@ -0,0 +1,491 @@
+#include "Harklepool.h"
+#include "Harklerror.h"         // HARKLE_ERROR
+#include <stdlib.h>             // calloc(), free()
+#include <string.h>             // memset()
+#include <time.h>               // clock_gettime()
+#include <unistd.h>             // sysconf()
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Read the monotonic clock
+    INPUT - None
+    OUTPUT
+        Seconds since an arbitrary, fixed, point in the past
+ */
+double read_pool_clock(void)
+{
+    // LOCAL VARIABLES
+    struct timespec now;  // Current time
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    // DONE
+    return now.tv_sec + (now.tv_nsec / 1000000000.0);
+}
+
+
+/*
+    PURPOSE - Take the next chunk to process, from the worker's own deque or, failing that, another's
+    INPUT
+        pool_ptr - Pointer to a worker pool
+        worker_ptr - Pointer to the worker looking for a chunk
+    OUTPUT
+        The chunk number to process, or -1 if every deque is empty
+    NOTES
+        The owner takes chunks from the front of its deque.  Thieves take one chunk from the back of
+            the first non-empty deque they find, starting with the next worker, so the owner and a thief
+            only contend over the last chunk.
+        Chunks are never added during a job so one pass over every deque that finds nothing means the
+            job has no chunks left to start
+        This function does not perform input validation
+ */
+int take_pool_chunk(hsPool_ptr pool_ptr, hsPoolWorker_ptr worker_ptr)
+{
+    // LOCAL VARIABLES
+    int chunkNum = -1;                  // Chunk to process
+    hsPoolWorker_ptr victim_ptr = NULL;  // Worker to steal from
+    int i = 0;                          // Iterating variable
+
+    // 1. Own deque
+    pthread_mutex_lock(&(worker_ptr->chunkLock));
+
+    if (worker_ptr->nextChunk < worker_ptr->endChunk)
+    {
+        chunkNum = worker_ptr->nextChunk;
+        worker_ptr->nextChunk++;
+    }
+
+    pthread_mutex_unlock(&(worker_ptr->chunkLock));
+
+    // 2. Steal
+    for (i = 1; i < pool_ptr->numThreads && -1 == chunkNum; i++)
+    {
+        victim_ptr = &(pool_ptr->worker_arr[(worker_ptr->workerNum + i) % pool_ptr->numThreads]);
+        pthread_mutex_lock(&(victim_ptr->chunkLock));
+
+        if (victim_ptr->nextChunk < victim_ptr->endChunk)
+        {
+            victim_ptr->endChunk--;
+            chunkNum = victim_ptr->endChunk;
+            worker_ptr->stats.numSteals++;
+        }
+
+        pthread_mutex_unlock(&(victim_ptr->chunkLock));
+    }
+
+    // DONE
+    return chunkNum;
+}
+
+
+/*
+    PURPOSE - Process chunks of the current job until none are left
+    INPUT
+        pool_ptr - Pointer to a worker pool
+        worker_ptr - Pointer to the worker doing the processing
+        job - Current job
+        jobArg - Current job's argument
+        numItems - Number of items in the current job
+        chunkItems - Number of items per chunk in the current job
+    OUTPUT
+        On success, true
+        On failure (of any chunk this worker processed), false
+    NOTES
+        Records the time spent in worker_ptr->jobBusySecs and adds it to the worker's statistics
+        This function does not perform input validation
+ */
+bool run_pool_chunks(hsPool_ptr pool_ptr, hsPoolWorker_ptr worker_ptr, hsPoolJob job, void *jobArg, int numItems,
+                     int chunkItems)
+{
+    // LOCAL VARIABLES
+    bool success = true;                  // Set this to false if any chunk fails
+    double startSecs = read_pool_clock(); // Time the worker started looking for chunks
+    int chunkNum = 0;                     // Chunk to process
+    int first = 0;                        // First item in the chunk
+    int last = 0;                         // One past the last item in the chunk
+
+    // WORK
+    chunkNum = take_pool_chunk(pool_ptr, worker_ptr);
+
+    while (0 <= chunkNum)
+    {
+        first = chunkNum * chunkItems;
+        last = (numItems - first > chunkItems) ? first + chunkItems : numItems;
+
+        if (false == job(jobArg, first, last, worker_ptr->workerNum))
+        {
+            success = false;
+        }
+
+        worker_ptr->stats.numChunks++;
+        chunkNum = take_pool_chunk(pool_ptr, worker_ptr);
+    }
+
+    // RECORD
+    worker_ptr->jobBusySecs = read_pool_clock() - startSecs;
+    worker_ptr->stats.busySecs += worker_ptr->jobBusySecs;
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Worker thread start routine
+    INPUT
+        arg - hsPoolWorker_ptr identifying the worker
+    OUTPUT
+        NULL
+    NOTES
+        Sleeps until a job starts, processes (and steals) chunks until there are none left, reports back
+            and goes back to sleep until the pool shuts down
+ */
+void *pool_worker_loop(void *arg)
+{
+    // LOCAL VARIABLES
+    hsPoolWorker_ptr worker_ptr = (hsPoolWorker_ptr)arg;  // Worker identity
+    hsPool_ptr pool_ptr = worker_ptr->pool_ptr;           // Pool
+    unsigned long lastJob = 0;                            // Number of the last job this worker processed (none yet)
+    hsPoolJob job = NULL;                                 // Local copy of the current job
+    void *jobArg = NULL;                                  // Local copy of the current job's argument
+    int numItems = 0;                                     // Local copy of the current job's item count
+    int chunkItems = 0;                                   // Local copy of the current job's chunk size
+    bool success = true;                                  // Return value from run_pool_chunks()
+
+    // Don't read jobNum here.  A job may already have started before this thread was scheduled.
+    pthread_mutex_lock(&(pool_ptr->poolLock));
+
+    while (false == pool_ptr->shutdown)
+    {
+        // WAIT FOR A JOB
+        if (lastJob == pool_ptr->jobNum)
+        {
+            pthread_cond_wait(&(pool_ptr->startCond), &(pool_ptr->poolLock));
+        }
+        else
+        {
+            lastJob = pool_ptr->jobNum;
+            job = pool_ptr->job;
+            jobArg = pool_ptr->jobArg;
+            numItems = pool_ptr->numItems;
+            chunkItems = pool_ptr->chunkItems;
+            pthread_mutex_unlock(&(pool_ptr->poolLock));
+
+            // WORK
+            success = run_pool_chunks(pool_ptr, worker_ptr, job, jobArg, numItems, chunkItems);
+
+            // REPORT
+            pthread_mutex_lock(&(pool_ptr->poolLock));
+
+            if (false == success)
+            {
+                pool_ptr->jobFailed = true;
+            }
+
+            pool_ptr->numPending--;
+
+            if (0 == pool_ptr->numPending)
+            {
+                pthread_cond_signal(&(pool_ptr->doneCond));
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&(pool_ptr->poolLock));
+
+    // DONE
+    return NULL;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsPool_ptr build_worker_pool(int numThreads)
+{
+    // LOCAL VARIABLES
+    hsPool_ptr retVal = NULL;  // Pool to return
+    bool success = true;       // Set this to false if anything fails
+    long numProcs = 0;         // Return value from sysconf()
+    int i = 0;                 // Iterating variable
+
+    // INPUT VALIDATION
+    if (0 > numThreads || HS_POOL_MAX_THREADS < numThreads)
+    {
+        HARKLE_ERROR(Harklepool, build_worker_pool, Invalid numThreads);
+        success = false;
+    }
+    else if (0 == numThreads)
+    {
+        numProcs = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = (1 > numProcs) ? 1 : ((HS_POOL_MAX_THREADS < numProcs) ? HS_POOL_MAX_THREADS : (int)numProcs);
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsPool));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklepool, build_worker_pool, calloc failed);
+            success = false;
+        }
+        else if (0 != pthread_mutex_init(&(retVal->poolLock), NULL)
+                 || 0 != pthread_cond_init(&(retVal->startCond), NULL)
+                 || 0 != pthread_cond_init(&(retVal->doneCond), NULL))
+        {
+            HARKLE_ERROR(Harklepool, build_worker_pool, Failed to initialize synchronization);
+            free(retVal);
+            retVal = NULL;
+            success = false;
+        }
+        else
+        {
+            // The pool only has to clean up workers that were actually started (see: numThreads)
+            retVal->worker_arr = calloc(numThreads, sizeof(hsPoolWorker));
+            retVal->thread_arr = calloc(numThreads, sizeof(pthread_t));
+
+            if (!(retVal->worker_arr) || !(retVal->thread_arr))
+            {
+                HARKLE_ERROR(Harklepool, build_worker_pool, calloc failed);
+                success = false;
+            }
+        }
+    }
+
+    // START WORKERS
+    if (true == success)
+    {
+        for (i = 0; i < numThreads; i++)
+        {
+            retVal->worker_arr[i].pool_ptr = retVal;
+            retVal->worker_arr[i].workerNum = i;
+
+            if (0 != pthread_mutex_init(&(retVal->worker_arr[i].chunkLock), NULL))
+            {
+                HARKLE_ERROR(Harklepool, build_worker_pool, pthread_mutex_init failed);
+                success = false;
+                break;
+            }
+            // Worker 0 is the calling thread
+            else if (i > 0 && 0 != pthread_create(&(retVal->thread_arr[i - 1]), NULL, pool_worker_loop,
+                                                  &(retVal->worker_arr[i])))
+            {
+                HARKLE_ERROR(Harklepool, build_worker_pool, pthread_create failed);
+                pthread_mutex_destroy(&(retVal->worker_arr[i].chunkLock));
+                success = false;
+                break;
+            }
+
+            retVal->numThreads = i + 1;
+        }
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        free_worker_pool(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool run_pool_job(hsPool_ptr pool_ptr, hsPoolJob job, void *jobArg, int numItems)
+{
+    // LOCAL VARIABLES
+    bool success = false;    // Set this to true if every chunk succeeds
+    double startSecs = 0.0;  // Time the job started
+    double jobSecs = 0.0;    // Wall time of the entire job
+    int baseChunks = 0;      // Number of chunks every worker is dealt
+    int extraChunks = 0;     // Number of workers, from worker 0 up, dealt one chunk more
+    bool runInline = false;  // Set this to true if the calling thread runs the job on its own
+    int i = 0;               // Iterating variable
+
+    // INPUT VALIDATION
+    if (!pool_ptr || !(pool_ptr->worker_arr))
+    {
+        HARKLE_ERROR(Harklepool, run_pool_job, Invalid pool_ptr);
+    }
+    else if (!job)
+    {
+        HARKLE_ERROR(Harklepool, run_pool_job, Invalid job);
+    }
+    else if (0 > numItems)
+    {
+        HARKLE_ERROR(Harklepool, run_pool_job, Invalid numItems);
+    }
+    else
+    {
+        // CHUNK THE JOB
+        pthread_mutex_lock(&(pool_ptr->poolLock));
+        pool_ptr->job = job;
+        pool_ptr->jobArg = jobArg;
+        pool_ptr->numItems = numItems;
+        pool_ptr->chunkItems = numItems / (pool_ptr->numThreads * HS_POOL_CHUNKS_PER_THREAD);
+
+        if (HS_POOL_MIN_CHUNK_ITEMS > pool_ptr->chunkItems)
+        {
+            pool_ptr->chunkItems = HS_POOL_MIN_CHUNK_ITEMS;
+        }
+
+        pool_ptr->numChunks = (numItems + pool_ptr->chunkItems - 1) / pool_ptr->chunkItems;
+
+        // Deal each worker a contiguous run of chunks, the low chunks first, so a short job lands on
+        //  the calling thread instead of a worker that has to wake up for it.  Nobody touches the deques
+        //  between jobs.
+        baseChunks = pool_ptr->numChunks / pool_ptr->numThreads;
+        extraChunks = pool_ptr->numChunks % pool_ptr->numThreads;
+
+        for (i = 0; i < pool_ptr->numThreads; i++)
+        {
+            pool_ptr->worker_arr[i].nextChunk = (i * baseChunks) + (i < extraChunks ? i : extraChunks);
+            pool_ptr->worker_arr[i].endChunk = pool_ptr->worker_arr[i].nextChunk + baseChunks
+                                               + (i < extraChunks ? 1 : 0);
+            pool_ptr->worker_arr[i].jobBusySecs = 0.0;
+        }
+
+        // START THE JOB
+        // A job of one chunk (or a pool of one thread) has nothing to share so the calling thread runs it
+        //  without waking the pool
+        runInline = (1 >= pool_ptr->numChunks || 1 == pool_ptr->numThreads);
+        pool_ptr->jobFailed = false;
+        pool_ptr->numPending = (true == runInline) ? 0 : pool_ptr->numThreads - 1;
+        startSecs = read_pool_clock();
+
+        if (false == runInline)
+        {
+            pool_ptr->jobNum++;
+            pthread_cond_broadcast(&(pool_ptr->startCond));
+        }
+
+        pthread_mutex_unlock(&(pool_ptr->poolLock));
+
+        // WORK
+        success = run_pool_chunks(pool_ptr, &(pool_ptr->worker_arr[0]), job, jobArg, numItems,
+                                  pool_ptr->chunkItems);
+
+        // WAIT FOR THE WORKERS
+        pthread_mutex_lock(&(pool_ptr->poolLock));
+
+        while (0 < pool_ptr->numPending)
+        {
+            pthread_cond_wait(&(pool_ptr->doneCond), &(pool_ptr->poolLock));
+        }
+
+        if (true == pool_ptr->jobFailed)
+        {
+            success = false;
+        }
+
+        // Whatever part of the job a worker wasn't busy for, it was idle
+        jobSecs = read_pool_clock() - startSecs;
+
+        for (i = 0; i < pool_ptr->numThreads; i++)
+        {
+            if (jobSecs > pool_ptr->worker_arr[i].jobBusySecs)
+            {
+                pool_ptr->worker_arr[i].stats.idleSecs += jobSecs - pool_ptr->worker_arr[i].jobBusySecs;
+            }
+        }
+
+        pool_ptr->job = NULL;
+        pool_ptr->jobArg = NULL;
+        pthread_mutex_unlock(&(pool_ptr->poolLock));
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool reset_pool_stats(hsPool_ptr pool_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the statistics are reset
+    int i = 0;             // Iterating variable
+
+    // INPUT VALIDATION
+    if (!pool_ptr || !(pool_ptr->worker_arr))
+    {
+        HARKLE_ERROR(Harklepool, reset_pool_stats, Invalid pool_ptr);
+    }
+    else
+    {
+        for (i = 0; i < pool_ptr->numThreads; i++)
+        {
+            memset(&(pool_ptr->worker_arr[i].stats), 0x0, sizeof(hsPoolStats));
+        }
+
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool free_worker_pool(hsPool_ptr *oldPool_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;        // Set this to true if the pool is freed
+    hsPool_ptr pool_ptr = NULL;  // Local copy of *oldPool_ptr
+    int i = 0;                   // Iterating variable
+
+    // INPUT VALIDATION
+    if (!oldPool_ptr || !(*oldPool_ptr))
+    {
+        HARKLE_ERROR(Harklepool, free_worker_pool, Invalid oldPool_ptr);
+    }
+    else
+    {
+        pool_ptr = *oldPool_ptr;
+
+        // STOP THE WORKERS
+        pthread_mutex_lock(&(pool_ptr->poolLock));
+        pool_ptr->shutdown = true;
+        pthread_cond_broadcast(&(pool_ptr->startCond));
+        pthread_mutex_unlock(&(pool_ptr->poolLock));
+
+        for (i = 1; i < pool_ptr->numThreads; i++)
+        {
+            pthread_join(pool_ptr->thread_arr[i - 1], NULL);
+        }
+
+        // FREE
+        for (i = 0; i < pool_ptr->numThreads; i++)
+        {
+            pthread_mutex_destroy(&(pool_ptr->worker_arr[i].chunkLock));
+        }
+
+        pthread_cond_destroy(&(pool_ptr->doneCond));
+        pthread_cond_destroy(&(pool_ptr->startCond));
+        pthread_mutex_destroy(&(pool_ptr->poolLock));
+
+        if (pool_ptr->thread_arr)
+        {
+            free(pool_ptr->thread_arr);
+        }
+        if (pool_ptr->worker_arr)
+        {
+            free(pool_ptr->worker_arr);
+        }
+
+        memset(pool_ptr, 0x0, sizeof(hsPool));
+        free(pool_ptr);
+        *oldPool_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
@@ -0,0 +1,140 @@
+#ifndef __HARKLEPOOL__
+#define __HARKLEPOOL__
+
+#include <pthread.h>            // pthread_t, pthread_mutex_t, pthread_cond_t
+#include <stdbool.h>            // bool, true, false
+
+// Largest number of threads a worker pool will use
+#define HS_POOL_MAX_THREADS 256
+// Number of chunks each thread's share of a job is split into, so there is something left to steal
+#define HS_POOL_CHUNKS_PER_THREAD 8
+// Smallest chunk worth scheduling (and stealing) on its own
+#define HS_POOL_MIN_CHUNK_ITEMS 256
+
+/*
+    PURPOSE - Process items [first, last) of a pool job
+    INPUT
+        jobArg - The jobArg passed to run_pool_job()
+        first - Index of the first item to process
+        last - One past the index of the last item to process
+        workerNum - Number of the worker running this chunk, 0 through numThreads - 1
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+typedef bool (*hsPoolJob)(void *jobArg, int first, int last, int workerNum);
+
+// Defines the struct that accumulates one worker's scheduling statistics across jobs
+typedef struct hsPoolStatistics
+{
+    long numChunks;                 // Number of chunks processed (own and stolen)
+    long numSteals;                 // Number of chunks stolen from other workers
+    double busySecs;                // Seconds spent processing, or looking for, chunks
+    double idleSecs;                // Seconds spent waiting for the rest of the pool to finish a job
+} hsPoolStats, *hsPoolStats_ptr;
+
+// Defines the struct that holds one worker's deque of chunks
+//  A worker owns the chunks [nextChunk, endChunk) of the current job.  It takes chunks from the front
+//  while thieves take them from the back, both under chunkLock.
+typedef struct hsPoolWorker
+{
+    struct hsWorkerPool *pool_ptr;  // Pool this worker belongs to
+    int workerNum;                  // 0 through numThreads - 1 (the calling thread is worker 0)
+    pthread_mutex_t chunkLock;      // Protects nextChunk and endChunk
+    int nextChunk;                  // Next chunk the worker will process itself
+    int endChunk;                   // One past the last chunk still in the deque
+    double jobBusySecs;             // Seconds this worker was busy during the most recent job
+    hsPoolStats stats;              // Scheduling statistics (see: reset_pool_stats())
+} hsPoolWorker, *hsPoolWorker_ptr;
+
+// Defines the struct that holds a fixed pool of worker threads
+//  The threads are started once and sleep between jobs.  run_pool_job() splits a job's items into
+//  HS_POOL_CHUNKS_PER_THREAD contiguous chunks per thread and deals each thread a contiguous run of them,
+//  starting with the calling thread.  A thread that runs out of chunks steals from the back of another
+//  thread's deque so uneven per-item work (e.g., a late sweep where only a few regions still move)
+//  doesn't leave threads idle.  The calling thread works as worker 0 and run_pool_job() returns once every
+//  chunk is done.  A job of a single chunk runs on the calling thread without waking the others.  Jobs
+//  are never queued: one job runs at a time.
+typedef struct hsWorkerPool
+{
+    int numThreads;                 // Number of threads working each job, including the calling thread
+    pthread_t *thread_arr;          // numThreads - 1 worker threads
+    hsPoolWorker_ptr worker_arr;    // numThreads worker deques (index 0 is the calling thread)
+    pthread_mutex_t poolLock;       // Protects every member below
+    pthread_cond_t startCond;       // Signalled when a job starts (or the pool shuts down)
+    pthread_cond_t doneCond;        // Signalled when the last worker finishes its chunk
+    unsigned long jobNum;           // Incremented every time a job starts
+    int numPending;                 // Number of workers still processing the current job
+    bool shutdown;                  // Set this to true to stop the workers
+    hsPoolJob job;                  // Current job
+    void *jobArg;                   // Current job's argument
+    int numItems;                   // Number of items in the current job
+    int chunkItems;                 // Number of items per chunk in the current job
+    int numChunks;                  // Number of chunks in the current job
+    bool jobFailed;                 // Set to true if any chunk of the current job fails
+} hsPool, *hsPool_ptr;
+
+
+/*
+    PURPOSE - Start a pool of worker threads
+    INPUT
+        numThreads - Number of threads to work each job, including the calling thread
+            (If 0, one per online processor is used)
+    OUTPUT
+        On success, pointer to a heap-allocated hsPool struct
+        On failure, NULL
+    NOTES
+        A pool of one thread starts no threads at all.  Jobs simply run on the calling thread.
+        It is the caller's responsibility to stop the threads and free the memory with free_worker_pool()
+ */
+hsPool_ptr build_worker_pool(int numThreads);
+
+
+/*
+    PURPOSE - Run a job across every thread in the pool and wait for it to finish
+    INPUT
+        pool_ptr - Pointer to a worker pool
+        job - Function that processes a contiguous chunk of the job's items
+        jobArg - Argument passed to every call to job
+        numItems - Number of items in the job
+    OUTPUT
+        On success, true
+        On failure (including the failure of any chunk), false
+    NOTES
+        Every chunk has finished when this function returns, whether it succeeds or not
+        A job of no more than HS_POOL_MIN_CHUNK_ITEMS items is a single chunk and runs on the calling
+            thread as worker 0
+        Chunk boundaries only depend on numItems and the number of threads but which worker processes a
+            chunk depends on stealing.  Jobs must not rely on it beyond using workerNum to pick a
+            per-worker accumulator.
+ */
+bool run_pool_job(hsPool_ptr pool_ptr, hsPoolJob job, void *jobArg, int numItems);
+
+
+/*
+    PURPOSE - Zero the scheduling statistics of every worker in a pool
+    INPUT
+        pool_ptr - Pointer to a worker pool
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Do not call this function while a job is running
+ */
+bool reset_pool_stats(hsPool_ptr pool_ptr);
+
+
+/*
+    PURPOSE - Stop a pool's worker threads and free the heap-allocated memory associated with it
+    INPUT
+        oldPool_ptr - A pointer to a heap-allocated hsPool struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Call this function as free_worker_pool(&myPool_ptr);
+ */
+bool free_worker_pool(hsPool_ptr *oldPool_ptr);
+
+
+#endif  // __HARKLEPOOL__
@@ -0,0 +1,379 @@
+#include "Harklequeue.h"
+#include "Harklerror.h"         // HARKLE_ERROR
+#include <stdlib.h>             // aligned_alloc(), calloc(), free()
+#include <string.h>             // memset()
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Push one delta into a delta queue's ring, if there's room
+    INPUT
+        queue_ptr - Pointer to a delta queue
+        delta_ptr - Pointer to the delta to push
+    OUTPUT
+        True if the delta was pushed, false if the ring is full
+    NOTES
+        Only reads the consumer's head when the cached copy says the ring is full
+        This function does not perform input validation
+ */
+bool push_delta_ring(hsDeltaQueue_ptr queue_ptr, hsDelta_ptr delta_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;     // Set this to false if the ring is full
+    unsigned long tail = 0;  // Index of the next delta to push
+
+    tail = atomic_load_explicit(&(queue_ptr->tail), memory_order_relaxed);  // Only we write tail
+
+    if (tail - queue_ptr->headCache >= queue_ptr->capacity)
+    {
+        queue_ptr->headCache = atomic_load_explicit(&(queue_ptr->head), memory_order_acquire);
+
+        if (tail - queue_ptr->headCache >= queue_ptr->capacity)
+        {
+            success = false;
+        }
+    }
+
+    if (true == success)
+    {
+        queue_ptr->ring_arr[tail & queue_ptr->mask] = *delta_ptr;
+        atomic_store_explicit(&(queue_ptr->tail), tail + 1, memory_order_release);  // Publish the delta
+        atomic_fetch_add_explicit(&(queue_ptr->numPushed), 1, memory_order_relaxed);
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Move a delta queue's backlog into its ring, oldest first, until the backlog is empty or the ring
+        is full
+    INPUT
+        queue_ptr - Pointer to a delta queue
+    OUTPUT
+        None
+    NOTES
+        This function does not perform input validation
+ */
+void drain_delta_backlog(hsDeltaQueue_ptr queue_ptr)
+{
+    // LOCAL VARIABLES
+    int posNum = 0;  // Oldest point in the backlog
+
+    while (0 < queue_ptr->numPending)
+    {
+        posNum = queue_ptr->pending_arr[queue_ptr->firstPending];
+
+        if (false == push_delta_ring(queue_ptr, &(queue_ptr->pendDelta_arr[posNum])))
+        {
+            break;  // Still full
+        }
+
+        queue_ptr->isPending[posNum] = false;
+        queue_ptr->firstPending = (queue_ptr->firstPending + 1) % (queue_ptr->maxPosNum + 1);
+        queue_ptr->numPending--;
+    }
+
+    if (0 == queue_ptr->numPending)
+    {
+        queue_ptr->firstPending = 0;
+    }
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Hold a delta in a delta queue's backlog, merging it with the point's held delta if it has one
+    INPUT
+        queue_ptr - Pointer to a delta queue
+        delta_ptr - Pointer to the delta to hold
+    OUTPUT
+        None
+    NOTES
+        This function does not perform input validation
+ */
+void hold_delta_backlog(hsDeltaQueue_ptr queue_ptr, hsDelta_ptr delta_ptr)
+{
+    // LOCAL VARIABLES
+    hsDelta_ptr held_ptr = &(queue_ptr->pendDelta_arr[delta_ptr->posNum]);  // The point's held delta
+
+    if (true == queue_ptr->isPending[delta_ptr->posNum])
+    {
+        // Keep the cell it left first, take the cell it entered last
+        held_ptr->newX = delta_ptr->newX;
+        held_ptr->newY = delta_ptr->newY;
+        atomic_fetch_add_explicit(&(queue_ptr->numMerged), 1, memory_order_relaxed);
+    }
+    else
+    {
+        *held_ptr = *delta_ptr;
+        queue_ptr->isPending[delta_ptr->posNum] = true;
+        queue_ptr->pending_arr[(queue_ptr->firstPending + queue_ptr->numPending) % (queue_ptr->maxPosNum + 1)] = \
+            delta_ptr->posNum;
+        queue_ptr->numPending++;
+    }
+
+    // DONE
+    return;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsDeltaQueue_ptr build_delta_queue(int capacity, int maxPosNum, int mode)
+{
+    // LOCAL VARIABLES
+    hsDeltaQueue_ptr retVal = NULL;  // Heap-allocated delta queue
+    bool success = true;             // Set this to false if anything fails
+    unsigned long ringSize = 1;      // capacity, rounded up to a power of 2
+
+    // INPUT VALIDATION
+    if (1 > capacity)
+    {
+        HARKLE_ERROR(Harklequeue, build_delta_queue, Invalid capacity);
+        success = false;
+    }
+    else if (0 > maxPosNum)
+    {
+        HARKLE_ERROR(Harklequeue, build_delta_queue, Invalid maxPosNum);
+        success = false;
+    }
+    else if (HS_QUEUE_DROP != mode && HS_QUEUE_COALESCE != mode)
+    {
+        HARKLE_ERROR(Harklequeue, build_delta_queue, Invalid mode);
+        success = false;
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        // The producer's and consumer's members each start a cache line so the struct must too
+        retVal = aligned_alloc(HS_QUEUE_CACHE_LINE, sizeof(hsDeltaQueue));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklequeue, build_delta_queue, aligned_alloc failed);
+            success = false;
+        }
+        else
+        {
+            memset(retVal, 0x0, sizeof(hsDeltaQueue));
+        }
+    }
+    if (true == success)
+    {
+        while (ringSize < (unsigned long)capacity)
+        {
+            ringSize <<= 1;
+        }
+
+        retVal->capacity = ringSize;
+        retVal->mask = ringSize - 1;
+        retVal->maxPosNum = maxPosNum;
+        retVal->mode = mode;
+        atomic_init(&(retVal->tail), 0);
+        atomic_init(&(retVal->head), 0);
+        atomic_init(&(retVal->numPushed), 0);
+        atomic_init(&(retVal->numDropped), 0);
+        atomic_init(&(retVal->numMerged), 0);
+        atomic_init(&(retVal->numPopped), 0);
+        retVal->ring_arr = calloc(ringSize, sizeof(hsDelta));
+
+        if (HS_QUEUE_COALESCE == mode)
+        {
+            retVal->pending_arr = calloc(maxPosNum + 1, sizeof(int));
+            retVal->isPending = calloc(maxPosNum + 1, sizeof(bool));
+            retVal->pendDelta_arr = calloc(maxPosNum + 1, sizeof(hsDelta));
+        }
+
+        if (!(retVal->ring_arr) || (HS_QUEUE_COALESCE == mode && (!(retVal->pending_arr)
+            || !(retVal->isPending) || !(retVal->pendDelta_arr))))
+        {
+            HARKLE_ERROR(Harklequeue, build_delta_queue, calloc failed);
+            success = false;
+        }
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        free_delta_queue(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool push_delta_queue(hsDeltaQueue_ptr queue_ptr, int posNum, int oldX, int oldY, int newX, int newY)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    hsDelta delta;        // The delta to push
+
+    // INPUT VALIDATION
+    if (!queue_ptr)
+    {
+        HARKLE_ERROR(Harklequeue, push_delta_queue, Invalid queue_ptr);
+        success = false;
+    }
+    else if (0 > posNum || queue_ptr->maxPosNum < posNum)
+    {
+        HARKLE_ERROR(Harklequeue, push_delta_queue, Invalid posNum);
+        success = false;
+    }
+
+    // PUSH
+    if (true == success)
+    {
+        delta.posNum = posNum;
+        delta.oldX = oldX;
+        delta.oldY = oldY;
+        delta.newX = newX;
+        delta.newY = newY;
+
+        // Nothing may overtake the backlog
+        if (0 < queue_ptr->numPending)
+        {
+            drain_delta_backlog(queue_ptr);
+        }
+
+        if (0 < queue_ptr->numPending || false == push_delta_ring(queue_ptr, &delta))
+        {
+            if (HS_QUEUE_COALESCE == queue_ptr->mode)
+            {
+                hold_delta_backlog(queue_ptr, &delta);
+            }
+            else
+            {
+                atomic_fetch_add_explicit(&(queue_ptr->numDropped), 1, memory_order_relaxed);
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+int flush_delta_queue(hsDeltaQueue_ptr queue_ptr)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;  // Number of points still in the backlog
+
+    // INPUT VALIDATION
+    if (!queue_ptr)
+    {
+        HARKLE_ERROR(Harklequeue, flush_delta_queue, Invalid queue_ptr);
+    }
+    else
+    {
+        // FLUSH
+        drain_delta_backlog(queue_ptr);
+        retVal = queue_ptr->numPending;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int pop_delta_queue(hsDeltaQueue_ptr queue_ptr, hsDelta_ptr delta_arr, int maxDeltas)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;             // Number of deltas popped
+    unsigned long head = 0;      // Index of the next delta to pop (only we write head)
+    unsigned long numReady = 0;  // Number of deltas in the ring
+    int i = 0;                   // Iterating variable
+
+    // INPUT VALIDATION
+    if (!queue_ptr)
+    {
+        HARKLE_ERROR(Harklequeue, pop_delta_queue, Invalid queue_ptr);
+    }
+    else if (!delta_arr || 1 > maxDeltas)
+    {
+        HARKLE_ERROR(Harklequeue, pop_delta_queue, Invalid delta_arr);
+    }
+    else
+    {
+        // POP
+        head = atomic_load_explicit(&(queue_ptr->head), memory_order_relaxed);
+
+        if (head == queue_ptr->tailCache)
+        {
+            queue_ptr->tailCache = atomic_load_explicit(&(queue_ptr->tail), memory_order_acquire);
+        }
+
+        numReady = queue_ptr->tailCache - head;
+        retVal = numReady < (unsigned long)maxDeltas ? (int)numReady : maxDeltas;
+
+        for (i = 0; i < retVal; i++)
+        {
+            delta_arr[i] = queue_ptr->ring_arr[(head + i) & queue_ptr->mask];
+        }
+
+        if (0 < retVal)
+        {
+            atomic_store_explicit(&(queue_ptr->head), head + retVal, memory_order_release);  // Free the slots
+            atomic_fetch_add_explicit(&(queue_ptr->numPopped), retVal, memory_order_relaxed);
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool free_delta_queue(hsDeltaQueue_ptr *oldQueue_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;                // Set this to true if the queue is freed
+    hsDeltaQueue_ptr queue_ptr = NULL;   // Local copy of *oldQueue_ptr
+
+    // INPUT VALIDATION
+    if (!oldQueue_ptr || !(*oldQueue_ptr))
+    {
+        HARKLE_ERROR(Harklequeue, free_delta_queue, Invalid oldQueue_ptr);
+    }
+    else
+    {
+        // FREE
+        queue_ptr = *oldQueue_ptr;
+
+        if (queue_ptr->ring_arr)
+        {
+            free(queue_ptr->ring_arr);
+        }
+        if (queue_ptr->pending_arr)
+        {
+            free(queue_ptr->pending_arr);
+        }
+        if (queue_ptr->isPending)
+        {
+            free(queue_ptr->isPending);
+        }
+        if (queue_ptr->pendDelta_arr)
+        {
+            free(queue_ptr->pendDelta_arr);
+        }
+
+        memset(queue_ptr, 0x0, sizeof(hsDeltaQueue));
+        free(queue_ptr);
+        *oldQueue_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
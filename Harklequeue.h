@@ -0,0 +1,138 @@
+#ifndef __HARKLEQUEUE__
+#define __HARKLEQUEUE__
+
+#include <stdatomic.h>          // atomic_bool, atomic_long, atomic_ulong
+#include <stdbool.h>            // bool, true, false
+
+// Default number of deltas a delta queue's ring holds
+#define HS_QUEUE_DEFAULT_CAPACITY 1024
+// Size of a cache line, to keep the producer's and consumer's members apart
+#define HS_QUEUE_CACHE_LINE 64
+// Delta queue modes
+#define HS_QUEUE_DROP 1              // A delta that doesn't fit in the ring is dropped
+#define HS_QUEUE_COALESCE 2          // A delta that doesn't fit in the ring is held, merged per point, until it fits
+
+// Defines the struct that describes one point's move
+typedef struct hsPositionDelta
+{
+    int posNum;                      // Number of the point that moved
+    int oldX;                        // X coordinate of the cell it left
+    int oldY;                        // Y coordinate of the cell it left
+    int newX;                        // X coordinate of the cell it entered
+    int newY;                        // Y coordinate of the cell it entered
+} hsDelta, *hsDelta_ptr;
+
+// Defines the struct that carries position deltas from one producer thread to one consumer thread
+//  The ring is lock-free: the producer only writes tail, the consumer only writes head, and each one caches
+//  the other's index so it only touches the other's cache line when the ring looks full (or empty).  Neither
+//  side ever waits.  When the ring is full the producer either drops the delta (HS_QUEUE_DROP) or holds it
+//  in a backlog (HS_QUEUE_COALESCE) that keeps one delta per point: a point that moves again while it's held
+//  keeps its original old cell and takes the new cell of its latest move.  The backlog is moved into the
+//  ring, oldest first, as the consumer catches up, and every delta queued behind it waits its turn so a
+//  point's deltas are always popped in order.
+typedef struct hsDeltaQueue
+{
+    // Fixed at build time
+    hsDelta *ring_arr;               // capacity deltas
+    unsigned long capacity;          // Number of deltas the ring holds (a power of 2)
+    unsigned long mask;              // capacity - 1
+    int maxPosNum;                   // Largest posNum the queue accepts
+    int mode;                        // HS_QUEUE_DROP or HS_QUEUE_COALESCE
+    // Producer only
+    _Alignas(HS_QUEUE_CACHE_LINE) atomic_ulong tail;  // Index of the next delta to push (written by the producer)
+    unsigned long headCache;         // Last head the producer read
+    int numPending;                  // Number of points in the backlog
+    int firstPending;                // Index, in pending_arr, of the oldest point in the backlog
+    int *pending_arr;                // maxPosNum + 1 posNums in the backlog, a circular FIFO
+    bool *isPending;                 // isPending[posNum] is true if posNum is in the backlog
+    hsDelta *pendDelta_arr;          // pendDelta_arr[posNum] is posNum's merged delta, if it's in the backlog
+    atomic_long numPushed;           // Number of deltas pushed into the ring
+    atomic_long numDropped;          // Number of deltas dropped because the ring was full
+    atomic_long numMerged;           // Number of deltas merged into one already in the backlog
+    // Consumer only
+    _Alignas(HS_QUEUE_CACHE_LINE) atomic_ulong head;  // Index of the next delta to pop (written by the consumer)
+    unsigned long tailCache;         // Last tail the consumer read
+    atomic_long numPopped;           // Number of deltas popped
+} hsDeltaQueue, *hsDeltaQueue_ptr;
+
+
+/*
+    PURPOSE - Allocate a delta queue
+    INPUT
+        capacity - Minimum number of deltas the ring holds (rounded up to a power of 2)
+        maxPosNum - Largest posNum that will be pushed
+        mode - HS_QUEUE_DROP or HS_QUEUE_COALESCE
+    OUTPUT
+        On success, pointer to a heap-allocated hsDeltaQueue struct
+        On failure, NULL
+    NOTES
+        It is the caller's responsibility to free the memory with free_delta_queue()
+ */
+hsDeltaQueue_ptr build_delta_queue(int capacity, int maxPosNum, int mode);
+
+
+/*
+    PURPOSE - Push one point's move into a delta queue
+    INPUT
+        queue_ptr - Pointer to a delta queue
+        posNum - Number of the point that moved, 0 through maxPosNum
+        oldX - X coordinate of the cell it left
+        oldY - Y coordinate of the cell it left
+        newX - X coordinate of the cell it entered
+        newY - Y coordinate of the cell it entered
+    OUTPUT
+        On success, true (whether the delta was queued, held or dropped)
+        On failure, false
+    NOTES
+        Only call this function from the producer thread
+        Never blocks
+ */
+bool push_delta_queue(hsDeltaQueue_ptr queue_ptr, int posNum, int oldX, int oldY, int newX, int newY);
+
+
+/*
+    PURPOSE - Move as much of a delta queue's backlog into the ring as will fit
+    INPUT
+        queue_ptr - Pointer to a delta queue
+    OUTPUT
+        On success, the number of points still in the backlog
+        On failure, -1
+    NOTES
+        Only call this function from the producer thread
+        push_delta_queue() does this too.  Call this function when there's nothing left to push (e.g., at
+            equilibrium) until it returns 0.
+ */
+int flush_delta_queue(hsDeltaQueue_ptr queue_ptr);
+
+
+/*
+    PURPOSE - Pop deltas from a delta queue
+    INPUT
+        queue_ptr - Pointer to a delta queue
+        delta_arr - [Out] Array to copy the deltas into
+        maxDeltas - Number of deltas delta_arr holds
+    OUTPUT
+        On success, the number of deltas popped (0 if the queue is empty)
+        On failure, -1
+    NOTES
+        Only call this function from the consumer thread
+        Never blocks
+ */
+int pop_delta_queue(hsDeltaQueue_ptr queue_ptr, hsDelta_ptr delta_arr, int maxDeltas);
+
+
+/*
+    PURPOSE - Free the heap-allocated memory associated with a delta queue
+    INPUT
+        oldQueue_ptr - A pointer to a heap-allocated hsDeltaQueue struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Neither thread may be using the queue
+        Call this function as free_delta_queue(&myQueue_ptr);
+ */
+bool free_delta_queue(hsDeltaQueue_ptr *oldQueue_ptr);
+
+
+#endif  // __HARKLEQUEUE__
@@ -0,0 +1,751 @@
+#include "Harklecurse.h"        // winDetails_ptr
+#include "Harklerender.h"
+#include "Harklerror.h"         // HARKLE_ERROR
+#include <errno.h>              // EINTR
+#include <ncurses.h>            // mvwaddch(), wnoutrefresh(), doupdate()
+#include <stdlib.h>             // calloc(), free(), realloc()
+#include <string.h>             // memcpy(), memset()
+#include <time.h>               // clock_gettime(), clock_nanosleep(), nanosleep()
+
+#define HS_RENDER_NANOS_PER_SEC 1000000000L  // Nanoseconds in a second
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Append a cell to one of a renderer's cell lists, growing it if necessary
+    INPUT
+        cell_arr_ptr - Pointer to the list
+        numCells_ptr - Pointer to the number of cells in the list
+        maxCells_ptr - Pointer to the capacity of the list
+        xCoord - X coordinate of the cell
+        yCoord - Y coordinate of the cell
+        graphic - Character to print there
+    OUTPUT
+        On success, true
+        On failure, false (and the list is unchanged)
+    NOTES
+        The list doubles when it's full so appends are amortized O(1)
+        This function does not perform input validation
+ */
+bool append_render_cell(hsRenderCell **cell_arr_ptr, int *numCells_ptr, int *maxCells_ptr, int xCoord, int yCoord,
+                        char graphic)
+{
+    // LOCAL VARIABLES
+    bool success = true;           // Set this to false if anything fails
+    hsRenderCell *tmp_ptr = NULL;  // Return value from realloc()
+
+    // GROW
+    if (*numCells_ptr == *maxCells_ptr)
+    {
+        tmp_ptr = realloc(*cell_arr_ptr, (size_t)(*maxCells_ptr) * 2 * sizeof(hsRenderCell));
+
+        if (!tmp_ptr)
+        {
+            HARKLE_ERROR(Harklerender, append_render_cell, realloc failed);
+            success = false;
+        }
+        else
+        {
+            *cell_arr_ptr = tmp_ptr;
+            *maxCells_ptr *= 2;
+        }
+    }
+
+    // APPEND
+    if (true == success)
+    {
+        (*cell_arr_ptr)[*numCells_ptr].xCoord = xCoord;
+        (*cell_arr_ptr)[*numCells_ptr].yCoord = yCoord;
+        (*cell_arr_ptr)[*numCells_ptr].graphic = graphic;
+        (*numCells_ptr)++;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Translate a field window coordinate into a drawnIn index
+    INPUT
+        render_ptr - Pointer to a renderer
+        xCoord - X coordinate in the field window
+        yCoord - Y coordinate in the field window
+    OUTPUT
+        The index, or -1 if the coordinate is outside the field window
+    NOTES
+        This function does not perform input validation
+ */
+long calc_render_cell(hsRender_ptr render_ptr, int xCoord, int yCoord)
+{
+    // LOCAL VARIABLES
+    long retVal = -1;  // drawnIn index
+
+    if (xCoord >= 0 && xCoord < render_ptr->fieldWin->nCols && yCoord >= 0 && yCoord < render_ptr->fieldWin->nRows)
+    {
+        retVal = ((long)yCoord * render_ptr->fieldWin->nCols) + xCoord;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Free a render loop's queue and arrays, and the loop itself, without touching its thread
+    INPUT
+        loop_ptr - Pointer to a heap-allocated hsRenderLoop struct
+    OUTPUT
+        None
+    NOTES
+        This function does not perform input validation
+ */
+void free_render_loop_memory(hsRenderLoop_ptr loop_ptr)
+{
+    if (loop_ptr->queue_ptr)
+    {
+        free_delta_queue(&(loop_ptr->queue_ptr));
+    }
+    if (loop_ptr->graphic_arr)
+    {
+        free(loop_ptr->graphic_arr);
+    }
+    if (loop_ptr->shownX)
+    {
+        free(loop_ptr->shownX);
+    }
+    if (loop_ptr->shownY)
+    {
+        free(loop_ptr->shownY);
+    }
+    if (loop_ptr->latestX)
+    {
+        free(loop_ptr->latestX);
+    }
+    if (loop_ptr->latestY)
+    {
+        free(loop_ptr->latestY);
+    }
+    if (loop_ptr->moved_arr)
+    {
+        free(loop_ptr->moved_arr);
+    }
+    if (loop_ptr->isMoved)
+    {
+        free(loop_ptr->isMoved);
+    }
+    if (loop_ptr->delta_arr)
+    {
+        free(loop_ptr->delta_arr);
+    }
+
+    memset(loop_ptr, 0x0, sizeof(hsRenderLoop));
+    free(loop_ptr);
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Pop every move waiting in a render loop's queue
+    INPUT
+        loop_ptr - Pointer to a render loop
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Each move updates the point's latest coordinates and adds the point to moved_arr (once)
+        Only call this function from the render thread
+        This function does not perform input validation
+ */
+bool pop_render_moves(hsRenderLoop_ptr loop_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    int numPopped = 0;    // Return value from pop_delta_queue()
+    int pntNum = 0;       // Point that moved
+    int i = 0;            // Iterating variable
+
+    do
+    {
+        numPopped = pop_delta_queue(loop_ptr->queue_ptr, loop_ptr->delta_arr, HS_RENDER_DELTA_BATCH);
+
+        if (0 > numPopped)
+        {
+            HARKLE_ERROR(Harklerender, pop_render_moves, pop_delta_queue failed);
+            success = false;
+        }
+
+        for (i = 0; i < numPopped; i++)
+        {
+            pntNum = loop_ptr->delta_arr[i].posNum;
+            loop_ptr->latestX[pntNum] = loop_ptr->delta_arr[i].newX;
+            loop_ptr->latestY[pntNum] = loop_ptr->delta_arr[i].newY;
+
+            if (false == loop_ptr->isMoved[pntNum])
+            {
+                loop_ptr->isMoved[pntNum] = true;
+                loop_ptr->moved_arr[loop_ptr->numMoved] = pntNum;
+                loop_ptr->numMoved++;
+            }
+        }
+    }
+    while (true == success && HS_RENDER_DELTA_BATCH == numPopped);
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Draw every point that moved since a render loop's last frame
+    INPUT
+        loop_ptr - Pointer to a render loop
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Each moved point is recorded once, from the cell the last frame drew it in to its latest cell, so a point
+            that moved through a cell another point is drawn in doesn't blank it
+        Only call this function from the render thread
+        This function does not perform input validation
+ */
+bool draw_render_frame(hsRenderLoop_ptr loop_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    int pntNum = 0;       // Point that moved
+    int i = 0;            // Iterating variable
+
+    // RECORD
+    for (i = 0; true == success && i < loop_ptr->numMoved; i++)
+    {
+        pntNum = loop_ptr->moved_arr[i];
+        success = record_render_move(loop_ptr->render_ptr, loop_ptr->shownX[pntNum], loop_ptr->shownY[pntNum],
+                                     loop_ptr->latestX[pntNum], loop_ptr->latestY[pntNum],
+                                     loop_ptr->graphic_arr[pntNum]);
+        loop_ptr->shownX[pntNum] = loop_ptr->latestX[pntNum];
+        loop_ptr->shownY[pntNum] = loop_ptr->latestY[pntNum];
+        loop_ptr->isMoved[pntNum] = false;
+    }
+    loop_ptr->numMoved = 0;
+
+    // DRAW
+    if (true == success)
+    {
+        success = flush_renderer(loop_ptr->render_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Body of a render loop's thread
+    INPUT
+        loop_arg - Pointer to the render loop
+    OUTPUT
+        NULL
+    NOTES
+        Sleeps until an absolute deadline so the time spent drawing doesn't stretch the frame.  A frame that
+            runs past the next deadline pushes the schedule back instead of drawing a burst of late frames.
+        The stop flag is read before the final pop so the last frame always shows every published move
+ */
+void *render_loop_thread(void *loop_arg)
+{
+    // LOCAL VARIABLES
+    hsRenderLoop_ptr loop_ptr = (hsRenderLoop_ptr)loop_arg;  // The render loop
+    struct timespec nextFrame;                               // When the next frame is due
+    struct timespec now;                                     // Current time
+    bool stop = false;                                       // Local copy of loop_ptr->stop
+    bool success = true;                                     // Set this to false if a frame fails
+    int errNum = 0;                                          // Return value from clock_nanosleep()
+
+    clock_gettime(CLOCK_MONOTONIC, &nextFrame);
+
+    while (false == stop && true == success)
+    {
+        // 1. Wait for the next frame
+        nextFrame.tv_nsec += loop_ptr->frameNanos;
+        while (nextFrame.tv_nsec >= HS_RENDER_NANOS_PER_SEC)
+        {
+            nextFrame.tv_nsec -= HS_RENDER_NANOS_PER_SEC;
+            nextFrame.tv_sec++;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (now.tv_sec > nextFrame.tv_sec || (now.tv_sec == nextFrame.tv_sec && now.tv_nsec > nextFrame.tv_nsec))
+        {
+            nextFrame = now;  // Fell behind
+        }
+        do
+        {
+            errNum = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &nextFrame, NULL);
+        }
+        while (EINTR == errNum);
+
+        // 2. Take every move published so far
+        stop = atomic_load_explicit(&(loop_ptr->stop), memory_order_acquire);
+        success = pop_render_moves(loop_ptr);
+
+        // 3. Draw them
+        if (true == success && 0 < loop_ptr->numMoved)
+        {
+            success = draw_render_frame(loop_ptr);
+
+            if (false == success)
+            {
+                HARKLE_ERROR(Harklerender, render_loop_thread, draw_render_frame failed);
+            }
+        }
+    }
+
+    if (false == success)
+    {
+        atomic_store_explicit(&(loop_ptr->failed), true, memory_order_release);
+    }
+
+    // DONE
+    return NULL;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsRender_ptr build_renderer(winDetails_ptr stdWin, winDetails_ptr fieldWin)
+{
+    // LOCAL VARIABLES
+    hsRender_ptr retVal = NULL;  // Heap-allocated renderer
+    bool success = true;         // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!stdWin || !(stdWin->win_ptr))
+    {
+        HARKLE_ERROR(Harklerender, build_renderer, Invalid stdWin);
+        success = false;
+    }
+    else if (!fieldWin || !(fieldWin->win_ptr) || 1 > fieldWin->nRows || 1 > fieldWin->nCols)
+    {
+        HARKLE_ERROR(Harklerender, build_renderer, Invalid fieldWin);
+        success = false;
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsRender));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklerender, build_renderer, calloc failed);
+            success = false;
+        }
+    }
+    if (true == success)
+    {
+        retVal->stdWin = stdWin;
+        retVal->fieldWin = fieldWin;
+        retVal->frameNum = 1;
+        retVal->clear_arr = calloc(HS_RENDER_DEFAULT_CAPACITY, sizeof(hsRenderCell));
+        retVal->draw_arr = calloc(HS_RENDER_DEFAULT_CAPACITY, sizeof(hsRenderCell));
+        retVal->drawnIn = calloc((size_t)fieldWin->nRows * fieldWin->nCols, sizeof(unsigned int));
+
+        if (!(retVal->clear_arr) || !(retVal->draw_arr) || !(retVal->drawnIn))
+        {
+            HARKLE_ERROR(Harklerender, build_renderer, calloc failed);
+            success = false;
+        }
+        else
+        {
+            retVal->maxClears = HS_RENDER_DEFAULT_CAPACITY;
+            retVal->maxDraws = HS_RENDER_DEFAULT_CAPACITY;
+        }
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        free_renderer(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool record_render_point(hsRender_ptr render_ptr, int xCoord, int yCoord, char graphic)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Return value from append_render_cell()
+
+    // INPUT VALIDATION
+    if (!render_ptr)
+    {
+        HARKLE_ERROR(Harklerender, record_render_point, Invalid render_ptr);
+    }
+    else
+    {
+        // RECORD
+        success = append_render_cell(&(render_ptr->draw_arr), &(render_ptr->numDraws), &(render_ptr->maxDraws),
+                                     xCoord, yCoord, graphic);
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool record_render_move(hsRender_ptr render_ptr, int oldX, int oldY, int newX, int newY, char graphic)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!render_ptr)
+    {
+        HARKLE_ERROR(Harklerender, record_render_move, Invalid render_ptr);
+        success = false;
+    }
+    else if (oldX != newX || oldY != newY)
+    {
+        // RECORD
+        success = append_render_cell(&(render_ptr->clear_arr), &(render_ptr->numClears), &(render_ptr->maxClears),
+                                     oldX, oldY, ' ');
+
+        if (true == success)
+        {
+            success = append_render_cell(&(render_ptr->draw_arr), &(render_ptr->numDraws), &(render_ptr->maxDraws),
+                                         newX, newY, graphic);
+
+            if (false == success)
+            {
+                render_ptr->numClears--;  // Keep the pair together
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool flush_renderer(hsRender_ptr render_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;   // Set this to false if anything fails
+    long cell = 0;         // drawnIn index
+    int i = 0;             // Iterating variable
+
+    // INPUT VALIDATION
+    if (!render_ptr)
+    {
+        HARKLE_ERROR(Harklerender, flush_renderer, Invalid render_ptr);
+        success = false;
+    }
+
+    // DRAW
+    // 1. Mark the cells being drawn so a point that moved into a cleared cell isn't erased
+    for (i = 0; true == success && i < render_ptr->numDraws; i++)
+    {
+        cell = calc_render_cell(render_ptr, render_ptr->draw_arr[i].xCoord, render_ptr->draw_arr[i].yCoord);
+
+        if (-1 < cell)
+        {
+            render_ptr->drawnIn[cell] = render_ptr->frameNum;
+        }
+    }
+
+    // 2. Blank the cells that were left
+    for (i = 0; true == success && i < render_ptr->numClears; i++)
+    {
+        cell = calc_render_cell(render_ptr, render_ptr->clear_arr[i].xCoord, render_ptr->clear_arr[i].yCoord);
+
+        if (-1 < cell && render_ptr->drawnIn[cell] != render_ptr->frameNum)
+        {
+            // Mark it so a cell left by two points is only written once
+            render_ptr->drawnIn[cell] = render_ptr->frameNum;
+
+            if (ERR == mvwaddch(render_ptr->fieldWin->win_ptr, render_ptr->clear_arr[i].yCoord,
+                                render_ptr->clear_arr[i].xCoord, ' '))
+            {
+                HARKLE_ERROR(Harklerender, flush_renderer, mvwaddch failed to clear a cell);
+                success = false;
+            }
+            else
+            {
+                render_ptr->numWritten++;
+            }
+        }
+    }
+
+    // 3. Draw the cells that were entered
+    for (i = 0; true == success && i < render_ptr->numDraws; i++)
+    {
+        if (ERR == mvwaddch(render_ptr->fieldWin->win_ptr, render_ptr->draw_arr[i].yCoord,
+                            render_ptr->draw_arr[i].xCoord, render_ptr->draw_arr[i].graphic))
+        {
+            HARKLE_ERROR(Harklerender, flush_renderer, mvwaddch failed to draw a cell);
+            success = false;
+        }
+        else
+        {
+            render_ptr->numWritten++;
+        }
+    }
+
+    // 4. One update for both windows
+    if (true == success && ERR == wnoutrefresh(render_ptr->stdWin->win_ptr))
+    {
+        HARKLE_ERROR(Harklerender, flush_renderer, wnoutrefresh failed on stdWin);
+        success = false;
+    }
+    if (true == success && ERR == wnoutrefresh(render_ptr->fieldWin->win_ptr))
+    {
+        HARKLE_ERROR(Harklerender, flush_renderer, wnoutrefresh failed on fieldWin);
+        success = false;
+    }
+    if (true == success && ERR == doupdate())
+    {
+        HARKLE_ERROR(Harklerender, flush_renderer, doupdate failed);
+        success = false;
+    }
+
+    // NEXT FRAME
+    if (render_ptr)
+    {
+        render_ptr->numClears = 0;
+        render_ptr->numDraws = 0;
+        render_ptr->numFrames++;
+        render_ptr->frameNum++;
+
+        // Stale marks could match again once the frame number wraps
+        if (0 == render_ptr->frameNum)
+        {
+            memset(render_ptr->drawnIn, 0x0,
+                   (size_t)render_ptr->fieldWin->nRows * render_ptr->fieldWin->nCols * sizeof(unsigned int));
+            render_ptr->frameNum = 1;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool free_renderer(hsRender_ptr *oldRender_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;            // Set this to true if the renderer is freed
+    hsRender_ptr render_ptr = NULL;  // Local copy of *oldRender_ptr
+
+    // INPUT VALIDATION
+    if (!oldRender_ptr || !(*oldRender_ptr))
+    {
+        HARKLE_ERROR(Harklerender, free_renderer, Invalid oldRender_ptr);
+    }
+    else
+    {
+        // FREE
+        render_ptr = *oldRender_ptr;
+
+        if (render_ptr->clear_arr)
+        {
+            free(render_ptr->clear_arr);
+        }
+        if (render_ptr->draw_arr)
+        {
+            free(render_ptr->draw_arr);
+        }
+        if (render_ptr->drawnIn)
+        {
+            free(render_ptr->drawnIn);
+        }
+
+        memset(render_ptr, 0x0, sizeof(hsRender));
+        free(render_ptr);
+        *oldRender_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+hsRenderLoop_ptr start_render_loop(hsRender_ptr render_ptr, int numPnts, int *xCoords, int *yCoords, char *graphics,
+                                   int frameRate, int queueCapacity)
+{
+    // LOCAL VARIABLES
+    hsRenderLoop_ptr retVal = NULL;  // Heap-allocated render loop
+    bool success = true;             // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!render_ptr)
+    {
+        HARKLE_ERROR(Harklerender, start_render_loop, Invalid render_ptr);
+        success = false;
+    }
+    else if (1 > numPnts || !xCoords || !yCoords || !graphics)
+    {
+        HARKLE_ERROR(Harklerender, start_render_loop, Invalid swarm);
+        success = false;
+    }
+    else if (1 > frameRate || HS_RENDER_MAX_FPS < frameRate)
+    {
+        HARKLE_ERROR(Harklerender, start_render_loop, Invalid frame rate);
+        success = false;
+    }
+    else if (0 > queueCapacity)
+    {
+        HARKLE_ERROR(Harklerender, start_render_loop, Invalid queue capacity);
+        success = false;
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsRenderLoop));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklerender, start_render_loop, calloc failed);
+            success = false;
+        }
+    }
+    if (true == success)
+    {
+        retVal->render_ptr = render_ptr;
+        retVal->numPnts = numPnts;
+        retVal->frameNanos = HS_RENDER_NANOS_PER_SEC / frameRate;
+        atomic_init(&(retVal->stop), false);
+        atomic_init(&(retVal->failed), false);
+        retVal->queue_ptr = build_delta_queue(0 < queueCapacity ? queueCapacity : HS_QUEUE_DEFAULT_CAPACITY,
+                                              numPnts - 1, HS_QUEUE_COALESCE);
+        retVal->graphic_arr = calloc(numPnts, sizeof(char));
+        retVal->shownX = calloc(numPnts, sizeof(int));
+        retVal->shownY = calloc(numPnts, sizeof(int));
+        retVal->latestX = calloc(numPnts, sizeof(int));
+        retVal->latestY = calloc(numPnts, sizeof(int));
+        retVal->moved_arr = calloc(numPnts, sizeof(int));
+        retVal->isMoved = calloc(numPnts, sizeof(bool));
+        retVal->delta_arr = calloc(HS_RENDER_DELTA_BATCH, sizeof(hsDelta));
+
+        if (!(retVal->queue_ptr))
+        {
+            HARKLE_ERROR(Harklerender, start_render_loop, build_delta_queue failed);
+            success = false;
+        }
+        else if (!(retVal->graphic_arr) || !(retVal->shownX) || !(retVal->shownY) || !(retVal->latestX)
+                 || !(retVal->latestY) || !(retVal->moved_arr) || !(retVal->isMoved) || !(retVal->delta_arr))
+        {
+            HARKLE_ERROR(Harklerender, start_render_loop, calloc failed);
+            success = false;
+        }
+        else
+        {
+            memcpy(retVal->graphic_arr, graphics, numPnts * sizeof(char));
+            memcpy(retVal->shownX, xCoords, numPnts * sizeof(int));
+            memcpy(retVal->shownY, yCoords, numPnts * sizeof(int));
+            memcpy(retVal->latestX, xCoords, numPnts * sizeof(int));
+            memcpy(retVal->latestY, yCoords, numPnts * sizeof(int));
+        }
+    }
+
+    // START
+    if (true == success && 0 != pthread_create(&(retVal->thread), NULL, render_loop_thread, retVal))
+    {
+        HARKLE_ERROR(Harklerender, start_render_loop, pthread_create failed);
+        success = false;
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        free_render_loop_memory(retVal);
+        retVal = NULL;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool commit_render_move(hsRenderLoop_ptr loop_ptr, int pntNum, int oldX, int oldY, int newX, int newY)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!loop_ptr)
+    {
+        HARKLE_ERROR(Harklerender, commit_render_move, Invalid loop_ptr);
+        success = false;
+    }
+    else if (0 > pntNum || loop_ptr->numPnts <= pntNum)
+    {
+        HARKLE_ERROR(Harklerender, commit_render_move, Invalid pntNum);
+        success = false;
+    }
+    else if (true == atomic_load_explicit(&(loop_ptr->failed), memory_order_acquire))
+    {
+        success = false;
+    }
+
+    // COMMIT
+    if (true == success && (oldX != newX || oldY != newY))
+    {
+        success = push_delta_queue(loop_ptr->queue_ptr, pntNum, oldX, oldY, newX, newY);
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool free_render_loop(hsRenderLoop_ptr *oldLoop_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;                // Set this to true if every frame was drawn
+    hsRenderLoop_ptr loop_ptr = NULL;    // Local copy of *oldLoop_ptr
+    struct timespec frameTime;           // One frame, to wait between flushes
+
+    // INPUT VALIDATION
+    if (!oldLoop_ptr || !(*oldLoop_ptr))
+    {
+        HARKLE_ERROR(Harklerender, free_render_loop, Invalid oldLoop_ptr);
+    }
+    else
+    {
+        // FLUSH
+        // The render thread frees room in the ring every frame so the backlog always drains, unless it died
+        loop_ptr = *oldLoop_ptr;
+        frameTime.tv_sec = loop_ptr->frameNanos / HS_RENDER_NANOS_PER_SEC;
+        frameTime.tv_nsec = loop_ptr->frameNanos % HS_RENDER_NANOS_PER_SEC;
+
+        while (0 < flush_delta_queue(loop_ptr->queue_ptr)
+               && false == atomic_load_explicit(&(loop_ptr->failed), memory_order_acquire))
+        {
+            nanosleep(&frameTime, NULL);
+        }
+
+        // STOP
+        atomic_store_explicit(&(loop_ptr->stop), true, memory_order_release);
+        pthread_join(loop_ptr->thread, NULL);
+        success = !atomic_load_explicit(&(loop_ptr->failed), memory_order_acquire);
+
+        // FREE
+        free_render_loop_memory(loop_ptr);
+        *oldLoop_ptr = NULL;
+    }
+
+    // DONE
+    return success;
+}
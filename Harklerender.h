@@ -0,0 +1,212 @@
+#ifndef __HARKLERENDER__
+#define __HARKLERENDER__
+
+#include "Harklecurse.h"        // winDetails_ptr
+#include "Harklequeue.h"        // hsDeltaQueue_ptr
+#include <pthread.h>            // pthread_t
+#include <stdatomic.h>          // atomic_bool
+#include <stdbool.h>            // bool, true, false
+
+// Starting capacity of each of a renderer's cell lists
+#define HS_RENDER_DEFAULT_CAPACITY 64
+// Default number of frames a render loop draws each second
+#define HS_RENDER_DEFAULT_FPS 30
+// Largest number of frames a render loop will draw each second
+#define HS_RENDER_MAX_FPS 1000
+// Number of deltas a render loop pops from its queue at once
+#define HS_RENDER_DELTA_BATCH 256
+
+// Defines the struct that describes one field window cell to redraw
+typedef struct hsRenderCell
+{
+    int xCoord;               // X coordinate in the field window
+    int yCoord;               // Y coordinate in the field window
+    char graphic;             // Character to print there
+} hsRenderCell, *hsRenderCell_ptr;
+
+// Defines the struct that redraws only the field window cells that changed
+//  Moves are recorded as they happen (a clear at the old cell and a draw at the new one) and nothing is
+//  written to the windows until flush_renderer().  A flush writes every clear, skipping cells something is
+//  drawn in this frame, then every draw, and pushes stdWin and fieldWin to the terminal with one
+//  wnoutrefresh()/doupdate() pair.  Unchanged cells are never touched so the cost of a frame scales with
+//  the number of moves instead of the size of the swarm.
+typedef struct hsRenderer
+{
+    winDetails_ptr stdWin;    // Main window (not owned by the renderer)
+    winDetails_ptr fieldWin;  // Field window the swarm is drawn in (not owned by the renderer)
+    int numClears;            // Number of cells in clear_arr
+    int maxClears;            // Capacity of clear_arr
+    hsRenderCell *clear_arr;  // Cells to blank this frame
+    int numDraws;             // Number of cells in draw_arr
+    int maxDraws;             // Capacity of draw_arr
+    hsRenderCell *draw_arr;   // Cells to draw this frame
+    unsigned int frameNum;    // Incremented by every flush (never 0)
+    unsigned int *drawnIn;    // drawnIn[yCoord * nCols + xCoord] is the last frameNum that cell was drawn in
+    long numFrames;           // Number of frames flushed
+    long numWritten;          // Number of cells written to fieldWin, across every frame
+} hsRender, *hsRender_ptr;
+
+// Defines the struct that decouples the thread simulating a swarm from the terminal
+//  The simulating thread publishes each point's moves with commit_render_move() as often as it likes and
+//  never waits on the terminal: moves go into a lock-free, coalescing delta queue (see: hsDeltaQueue).  A
+//  render thread wakes frameRate times a second, on an absolute clock_nanosleep() schedule, pops every move
+//  published since the last frame, records the cell each moved point was last drawn in and the cell it's in
+//  now, and flushes the renderer.  A point that moved several times between two frames is drawn once, where
+//  it ended up.  Once the loop starts the render thread owns the renderer and both windows.
+typedef struct hsRenderLoop
+{
+    hsRender_ptr render_ptr;      // Renderer the render thread flushes (not owned by the loop)
+    hsDeltaQueue_ptr queue_ptr;   // Moves published by the simulating thread
+    int numPnts;                  // Number of points, numbered 0 through numPnts - 1
+    long frameNanos;              // Nanoseconds between frames
+    char *graphic_arr;            // numPnts characters to print at each point
+    int *shownX;                  // numPnts x coordinates drawn by the last frame (render thread only)
+    int *shownY;                  // numPnts y coordinates drawn by the last frame (render thread only)
+    int *latestX;                 // numPnts x coordinates popped from the queue (render thread only)
+    int *latestY;                 // numPnts y coordinates popped from the queue (render thread only)
+    int numMoved;                 // Number of points in moved_arr (render thread only)
+    int *moved_arr;               // Points popped since the last frame (render thread only)
+    bool *isMoved;                // isMoved[pntNum] is true if pntNum is in moved_arr (render thread only)
+    hsDelta *delta_arr;           // HS_RENDER_DELTA_BATCH deltas popped at once (render thread only)
+    pthread_t thread;             // Render thread
+    atomic_bool stop;             // Set this to true to draw one last frame and end the render thread
+    atomic_bool failed;           // Set to true by the render thread if a frame fails
+} hsRenderLoop, *hsRenderLoop_ptr;
+
+
+/*
+    PURPOSE - Allocate a renderer for a field window
+    INPUT
+        stdWin - Pointer to the main window's winDetails struct
+        fieldWin - Pointer to the field window's winDetails struct
+    OUTPUT
+        On success, pointer to a heap-allocated hsRender struct
+        On failure, NULL
+    NOTES
+        The renderer does not own either window
+        It is the caller's responsibility to free the memory with free_renderer()
+ */
+hsRender_ptr build_renderer(winDetails_ptr stdWin, winDetails_ptr fieldWin);
+
+
+/*
+    PURPOSE - Record a point to draw in the next frame
+    INPUT
+        render_ptr - Pointer to a renderer
+        xCoord - X coordinate in the field window
+        yCoord - Y coordinate in the field window
+        graphic - Character to print there
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+bool record_render_point(hsRender_ptr render_ptr, int xCoord, int yCoord, char graphic);
+
+
+/*
+    PURPOSE - Record a point's move to redraw in the next frame
+    INPUT
+        render_ptr - Pointer to a renderer
+        oldX - X coordinate the point left
+        oldY - Y coordinate the point left
+        newX - X coordinate the point moved to
+        newY - Y coordinate the point moved to
+        graphic - Character to print at the new coordinate
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        A point that didn't move records nothing
+ */
+bool record_render_move(hsRender_ptr render_ptr, int oldX, int oldY, int newX, int newY, char graphic);
+
+
+/*
+    PURPOSE - Write every recorded cell and push both windows to the terminal
+    INPUT
+        render_ptr - Pointer to a renderer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The recorded cells are forgotten whether or not the flush succeeds
+        stdWin is pushed too (below fieldWin) so anything written to it since the last frame appears in the
+            same doupdate()
+ */
+bool flush_renderer(hsRender_ptr render_ptr);
+
+
+/*
+    PURPOSE - Free the heap-allocated memory associated with a renderer
+    INPUT
+        oldRender_ptr - A pointer to a heap-allocated hsRender struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Neither window is freed
+        Call this function as free_renderer(&myRender_ptr);
+ */
+bool free_renderer(hsRender_ptr *oldRender_ptr);
+
+
+/*
+    PURPOSE - Start a thread that draws a swarm's published moves at a fixed frame rate
+    INPUT
+        render_ptr - Pointer to a renderer
+        numPnts - Number of points in the swarm
+        xCoords - numPnts x coordinates already on the screen
+        yCoords - numPnts y coordinates already on the screen
+        graphics - numPnts characters to print at each point
+        frameRate - Number of frames to draw each second, 1 through HS_RENDER_MAX_FPS
+        queueCapacity - Number of moves the queue holds before it starts coalescing them
+            (If 0, HS_QUEUE_DEFAULT_CAPACITY is used)
+    OUTPUT
+        On success, pointer to a heap-allocated hsRenderLoop struct
+        On failure, NULL
+    NOTES
+        The arrays are copied
+        Don't touch the renderer, or either of its windows, until free_render_loop() returns
+        It is the caller's responsibility to stop the thread and free the memory with free_render_loop()
+ */
+hsRenderLoop_ptr start_render_loop(hsRender_ptr render_ptr, int numPnts, int *xCoords, int *yCoords, char *graphics,
+                                   int frameRate, int queueCapacity);
+
+
+/*
+    PURPOSE - Publish one point's move for the render thread to draw
+    INPUT
+        loop_ptr - Pointer to a render loop
+        pntNum - Number of the point that moved, 0 through numPnts - 1
+        oldX - X coordinate of the cell it left
+        oldY - Y coordinate of the cell it left
+        newX - X coordinate of the cell it entered
+        newY - Y coordinate of the cell it entered
+    OUTPUT
+        On success, true
+        On failure (including a failed frame), false
+    NOTES
+        Only call this function from the thread that started the loop
+        Never blocks.  If the render thread falls behind, moves are merged per point until it catches up.
+        A point that didn't move publishes nothing
+ */
+bool commit_render_move(hsRenderLoop_ptr loop_ptr, int pntNum, int oldX, int oldY, int newX, int newY);
+
+
+/*
+    PURPOSE - Draw every published move, stop the render thread and free the heap-allocated memory associated
+        with a render loop
+    INPUT
+        oldLoop_ptr - A pointer to a heap-allocated hsRenderLoop struct pointer
+    OUTPUT
+        On success, true
+        On failure (including any failed frame), false
+    NOTES
+        Only call this function from the thread that started the loop
+        The renderer is not freed
+        Call this function as free_render_loop(&myLoop_ptr);
+ */
+bool free_render_loop(hsRenderLoop_ptr *oldLoop_ptr);
+
+
+#endif  // __HARKLERENDER__
@@ -0,0 +1,703 @@
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harklescan.h"
+#include "Harklestore.h"
+#include "Harkleswarm.h"
+#include <limits.h>             // LLONG_MAX
+#include <math.h>               // sqrt()
+
+#ifdef HS_SCAN_HAVE_AVX2
+#include <immintrin.h>          // AVX2 intrinsics
+#endif  // HS_SCAN_HAVE_AVX2
+
+// Scans of fewer points than this use the scalar kernel: merging the lanes costs more than the blocks save
+#define HS_SCAN_MIN_VECTOR_PNTS (4 * HS_SCAN_LANES)
+
+// Kernel selected by select_scan_kernel()
+static int scanKernel = HS_SCAN_KERNEL_AUTO;
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Determine if the processor supports the AVX2 kernel
+    INPUT - None
+    OUTPUT
+        If so, true
+        Otherwise, false
+ */
+bool is_avx2_supported(void)
+{
+#ifdef HS_SCAN_HAVE_AVX2
+    return __builtin_cpu_supports("avx2") ? true : false;
+#else
+    return false;
+#endif  // HS_SCAN_HAVE_AVX2
+}
+
+
+/*
+    PURPOSE - Keep a candidate if it's the closest found so far on its side of the line
+    INPUT
+        index - Index of the candidate
+        sqDist - Squared distance of the candidate
+        side - 0 for "left"/"up" and 1 for "right"/"down"
+        id_arr - Closest indices found so far (-1 for none)
+        sqDist_arr - Their squared distances
+    OUTPUT
+        None
+    NOTES
+        Ties go to the lower index so the order candidates are considered in never matters
+        This function does not perform input validation
+ */
+void keep_one_dim_candidate(int index, long long sqDist, int side, int *id_arr, long long *sqDist_arr)
+{
+    if (-1 == id_arr[side] || sqDist < sqDist_arr[side] || (sqDist == sqDist_arr[side] && index < id_arr[side]))
+    {
+        id_arr[side] = index;
+        sqDist_arr[side] = sqDist;
+    }
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Keep a candidate if it's one of the closest found so far
+    INPUT
+        index - Index of the candidate
+        sqDist - Squared distance of the candidate
+        numNeighbours - Number of entries in id_arr and sqDist_arr
+        numFound - Number of entries populated so far, closest first
+        id_arr - Closest indices found so far
+        sqDist_arr - Their squared distances
+    OUTPUT
+        Number of entries populated afterwards
+    NOTES
+        Ties go to the lower index so the order candidates are considered in never matters
+        This function does not perform input validation
+ */
+int keep_two_dim_candidate(int index, long long sqDist, int numNeighbours, int numFound, int *id_arr,
+                           long long *sqDist_arr)
+{
+    // LOCAL VARIABLES
+    int slot = numFound;  // Where the candidate belongs
+
+    while (slot > 0 && (sqDist < sqDist_arr[slot - 1] || (sqDist == sqDist_arr[slot - 1] && index < id_arr[slot - 1])))
+    {
+        slot--;
+    }
+
+    if (slot < numNeighbours)
+    {
+        if (numFound < numNeighbours)
+        {
+            numFound++;
+        }
+
+        for (int i = numFound - 1; i > slot; i--)
+        {
+            id_arr[i] = id_arr[i - 1];
+            sqDist_arr[i] = sqDist_arr[i - 1];
+        }
+
+        id_arr[slot] = index;
+        sqDist_arr[slot] = sqDist;
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+/*
+    PURPOSE - Scalar kernel for scan_closest_one_dim(), over indices [first, last)
+    INPUT
+        See: scan_closest_one_dim()
+        first - First index to consider
+        last - One past the last index to consider
+    OUTPUT
+        None (id_arr and sqDist_arr are updated in place)
+    NOTES
+        This function does not perform input validation
+ */
+void scan_one_dim_scalar(int *absX, int *absY, int first, int last, int srcX, int srcY, int skipIndex,
+                         bool vertLine, int *id_arr, long long *sqDist_arr)
+{
+    // LOCAL VARIABLES
+    long long deltaX = 0;  // X distance from the 'origin'
+    long long deltaY = 0;  // Y distance from the 'origin'
+    int side = -1;         // Side of the line the candidate is on (-1 for neither)
+    int i = 0;             // Iterating variable
+
+    for (i = first; i < last; i++)
+    {
+        deltaX = (long long)absX[i] - srcX;
+        deltaY = (long long)absY[i] - srcY;
+
+        if (true == vertLine)
+        {
+            side = (deltaY > 0) ? 0 : ((deltaY < 0) ? 1 : -1);
+        }
+        else
+        {
+            side = (deltaX < 0) ? 0 : ((deltaX > 0) ? 1 : -1);
+        }
+
+        if (-1 != side && i != skipIndex)
+        {
+            keep_one_dim_candidate(i, (deltaX * deltaX) + (deltaY * deltaY), side, id_arr, sqDist_arr);
+        }
+    }
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Scalar kernel for scan_closest_two_dim(), over indices [first, last)
+    INPUT
+        See: scan_closest_two_dim()
+        first - First index to consider
+        last - One past the last index to consider
+        numFound - Number of entries already populated
+    OUTPUT
+        Number of entries populated afterwards
+    NOTES
+        This function does not perform input validation
+ */
+int scan_two_dim_scalar(int *absX, int *absY, int first, int last, int srcX, int srcY, int skipIndex,
+                        int numNeighbours, int numFound, int *id_arr, long long *sqDist_arr)
+{
+    // LOCAL VARIABLES
+    long long deltaX = 0;  // X distance from the 'origin'
+    long long deltaY = 0;  // Y distance from the 'origin'
+    int i = 0;             // Iterating variable
+
+    for (i = first; i < last; i++)
+    {
+        if (i != skipIndex)
+        {
+            deltaX = (long long)absX[i] - srcX;
+            deltaY = (long long)absY[i] - srcY;
+            numFound = keep_two_dim_candidate(i, (deltaX * deltaX) + (deltaY * deltaY), numNeighbours, numFound,
+                                              id_arr, sqDist_arr);
+        }
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+#ifdef HS_SCAN_HAVE_AVX2
+/*
+    PURPOSE - Load a block of HS_SCAN_LANES candidates and measure their distance from the 'origin'
+    INPUT
+        absX - X coordinates
+        absY - Y coordinates
+        first - Index of the first candidate in the block
+        srcXVec - 'Origin' x, in every lane
+        srcYVec - 'Origin' y, in every lane
+        deltaX - [Out] X distance from the 'origin', one candidate per 32-bit lane
+        deltaY - [Out] Y distance from the 'origin', one candidate per 32-bit lane
+        evenDist - [Out] Squared distance of the even lanes, one candidate per 64-bit lane
+        oddDist - [Out] Squared distance of the odd lanes, one candidate per 64-bit lane
+    OUTPUT
+        If every distance fits an int, true
+        Otherwise (the block must be scanned by the scalar kernel), false
+    NOTES
+        Squares are 64-bit (_mm256_mul_epi32() multiplies the even 32-bit lanes) so no coordinate is too far
+        This function does not perform input validation
+ */
+__attribute__((target("avx2")))
+bool measure_scan_block(int *absX, int *absY, int first, __m256i srcXVec, __m256i srcYVec, __m256i *deltaX,
+                        __m256i *deltaY, __m256i *evenDist, __m256i *oddDist)
+{
+    // LOCAL VARIABLES
+    __m256i xVec = _mm256_loadu_si256((__m256i *)(absX + first));  // Candidate x coordinates
+    __m256i yVec = _mm256_loadu_si256((__m256i *)(absY + first));  // Candidate y coordinates
+    __m256i overflow;                                              // Sign bit set where a subtraction overflowed
+    __m256i oddX;                                                  // Odd lanes of deltaX, shifted down
+    __m256i oddY;                                                  // Odd lanes of deltaY, shifted down
+
+    *deltaX = _mm256_sub_epi32(xVec, srcXVec);
+    *deltaY = _mm256_sub_epi32(yVec, srcYVec);
+
+    // a - b overflows when a and b differ in sign and the difference doesn't have the sign of a
+    overflow = _mm256_or_si256(_mm256_and_si256(_mm256_xor_si256(xVec, srcXVec), _mm256_xor_si256(xVec, *deltaX)),
+                               _mm256_and_si256(_mm256_xor_si256(yVec, srcYVec), _mm256_xor_si256(yVec, *deltaY)));
+
+    oddX = _mm256_srli_epi64(*deltaX, 32);
+    oddY = _mm256_srli_epi64(*deltaY, 32);
+    *evenDist = _mm256_add_epi64(_mm256_mul_epi32(*deltaX, *deltaX), _mm256_mul_epi32(*deltaY, *deltaY));
+    *oddDist = _mm256_add_epi64(_mm256_mul_epi32(oddX, oddX), _mm256_mul_epi32(oddY, oddY));
+
+    // DONE
+    return (0 == _mm256_movemask_ps(_mm256_castsi256_ps(overflow))) ? true : false;
+}
+
+
+/*
+    PURPOSE - Keep each lane's candidate if it's strictly closer than the lane's best
+    INPUT
+        sideMask - All ones in the 32-bit lanes whose candidates are on this side
+        evenDist - Squared distance of the even lanes (see: measure_scan_block())
+        oddDist - Squared distance of the odd lanes
+        evenIndex - Index of the even lanes' candidates, one per 64-bit lane
+        oddIndex - Index of the odd lanes' candidates
+        bestDist - Each lane's closest squared distance, [0] for the even lanes and [1] for the odd lanes
+        bestIndex - Each lane's closest index, [0] for the even lanes and [1] for the odd lanes
+    OUTPUT
+        None (bestDist and bestIndex are updated in place)
+    NOTES
+        This function does not perform input validation
+ */
+__attribute__((target("avx2")))
+void keep_scan_lanes(__m256i sideMask, __m256i evenDist, __m256i oddDist, __m256i evenIndex, __m256i oddIndex,
+                     __m256i *bestDist, __m256i *bestIndex)
+{
+    // LOCAL VARIABLES
+    // Widen the 32-bit lane masks to the 64-bit lanes holding the even and odd candidates
+    __m256i evenTake = _mm256_shuffle_epi32(sideMask, _MM_SHUFFLE(2, 2, 0, 0));
+    __m256i oddTake = _mm256_shuffle_epi32(sideMask, _MM_SHUFFLE(3, 3, 1, 1));
+
+    evenTake = _mm256_and_si256(evenTake, _mm256_cmpgt_epi64(bestDist[0], evenDist));
+    oddTake = _mm256_and_si256(oddTake, _mm256_cmpgt_epi64(bestDist[1], oddDist));
+    bestDist[0] = _mm256_blendv_epi8(bestDist[0], evenDist, evenTake);
+    bestIndex[0] = _mm256_blendv_epi8(bestIndex[0], evenIndex, evenTake);
+    bestDist[1] = _mm256_blendv_epi8(bestDist[1], oddDist, oddTake);
+    bestIndex[1] = _mm256_blendv_epi8(bestIndex[1], oddIndex, oddTake);
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - AVX2 kernel for scan_closest_one_dim()
+    INPUT
+        See: scan_closest_one_dim()
+    OUTPUT
+        None (id_arr and sqDist_arr are updated in place)
+    NOTES
+        Every lane keeps its own closest candidate on each side, in vectors, and the lanes are merged once at
+            the end.  A side is one compare per block instead of a branch per candidate.
+        This function does not perform input validation
+ */
+__attribute__((target("avx2")))
+void scan_one_dim_avx2(int *absX, int *absY, int numPnts, int srcX, int srcY, int skipIndex, bool vertLine,
+                       int *id_arr, long long *sqDist_arr)
+{
+    // LOCAL VARIABLES
+    __m256i srcXVec = _mm256_set1_epi32(srcX);                  // 'Origin' x, in every lane
+    __m256i srcYVec = _mm256_set1_epi32(srcY);                  // 'Origin' y, in every lane
+    __m256i skipVec = _mm256_set1_epi32(skipIndex);             // Index to ignore, in every lane
+    __m256i zeroVec = _mm256_setzero_si256();                   // 0, in every lane
+    __m256i indexVec = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);  // Index of each lane's candidate
+    __m256i evenIndex = _mm256_setr_epi64x(0, 2, 4, 6);         // Index of each even lane's candidate
+    __m256i oddIndex = _mm256_setr_epi64x(1, 3, 5, 7);          // Index of each odd lane's candidate
+    __m256i stepVec = _mm256_set1_epi32(HS_SCAN_LANES);         // Lanes per block, in every 32-bit lane
+    __m256i stepWide = _mm256_set1_epi64x(HS_SCAN_LANES);       // Lanes per block, in every 64-bit lane
+    __m256i best0Dist[2];                                       // Each lane's closest "left"/"up" squared distance
+    __m256i best0Index[2];                                      // Each lane's closest "left"/"up" index
+    __m256i best1Dist[2];                                       // Each lane's closest "right"/"down" squared distance
+    __m256i best1Index[2];                                      // Each lane's closest "right"/"down" index
+    __m256i deltaX;                                             // X distance from the 'origin'
+    __m256i deltaY;                                             // Y distance from the 'origin'
+    __m256i evenDist;                                           // Squared distance of the even lanes
+    __m256i oddDist;                                            // Squared distance of the odd lanes
+    __m256i side0;                                              // All ones where the candidate is "left"/"up"
+    __m256i side1;                                              // All ones where the candidate is "right"/"down"
+    __m256i skipMask;                                           // All ones where the candidate is skipIndex
+    long long laneDist[HS_SCAN_LANES / 2];                      // One vector, spilled to merge the lanes
+    long long laneIndex[HS_SCAN_LANES / 2];                     // One vector, spilled to merge the lanes
+    int i = 0;                                                  // Iterating variable
+    int half = 0;                                               // Iterating variable
+    int lane = 0;                                               // Iterating variable
+
+    // SETUP
+    for (half = 0; half < 2; half++)
+    {
+        best0Dist[half] = _mm256_set1_epi64x(LLONG_MAX);
+        best0Index[half] = _mm256_set1_epi64x(-1);
+        best1Dist[half] = _mm256_set1_epi64x(LLONG_MAX);
+        best1Index[half] = _mm256_set1_epi64x(-1);
+    }
+
+    // SCAN
+    for (i = 0; i + HS_SCAN_LANES <= numPnts; i += HS_SCAN_LANES)
+    {
+        if (false == measure_scan_block(absX, absY, i, srcXVec, srcYVec, &deltaX, &deltaY, &evenDist, &oddDist))
+        {
+            scan_one_dim_scalar(absX, absY, i, i + HS_SCAN_LANES, srcX, srcY, skipIndex, vertLine, id_arr,
+                                sqDist_arr);
+        }
+        else
+        {
+            if (true == vertLine)
+            {
+                side0 = _mm256_cmpgt_epi32(deltaY, zeroVec);
+                side1 = _mm256_cmpgt_epi32(zeroVec, deltaY);
+            }
+            else
+            {
+                side0 = _mm256_cmpgt_epi32(zeroVec, deltaX);
+                side1 = _mm256_cmpgt_epi32(deltaX, zeroVec);
+            }
+
+            // Blocks are in index order so a strictly closer candidate is the only one a lane keeps
+            skipMask = _mm256_cmpeq_epi32(indexVec, skipVec);
+            keep_scan_lanes(_mm256_andnot_si256(skipMask, side0), evenDist, oddDist, evenIndex, oddIndex, best0Dist,
+                            best0Index);
+            keep_scan_lanes(_mm256_andnot_si256(skipMask, side1), evenDist, oddDist, evenIndex, oddIndex, best1Dist,
+                            best1Index);
+        }
+
+        indexVec = _mm256_add_epi32(indexVec, stepVec);
+        evenIndex = _mm256_add_epi64(evenIndex, stepWide);
+        oddIndex = _mm256_add_epi64(oddIndex, stepWide);
+    }
+
+    // MERGE THE LANES
+    for (half = 0; half < 2; half++)
+    {
+        _mm256_storeu_si256((__m256i *)laneDist, best0Dist[half]);
+        _mm256_storeu_si256((__m256i *)laneIndex, best0Index[half]);
+
+        for (lane = 0; lane < HS_SCAN_LANES / 2; lane++)
+        {
+            if (-1 != laneIndex[lane])
+            {
+                keep_one_dim_candidate((int)laneIndex[lane], laneDist[lane], 0, id_arr, sqDist_arr);
+            }
+        }
+
+        _mm256_storeu_si256((__m256i *)laneDist, best1Dist[half]);
+        _mm256_storeu_si256((__m256i *)laneIndex, best1Index[half]);
+
+        for (lane = 0; lane < HS_SCAN_LANES / 2; lane++)
+        {
+            if (-1 != laneIndex[lane])
+            {
+                keep_one_dim_candidate((int)laneIndex[lane], laneDist[lane], 1, id_arr, sqDist_arr);
+            }
+        }
+    }
+
+    // LEFTOVERS
+    scan_one_dim_scalar(absX, absY, i, numPnts, srcX, srcY, skipIndex, vertLine, id_arr, sqDist_arr);
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - AVX2 kernel for scan_closest_two_dim()
+    INPUT
+        See: scan_closest_two_dim()
+    OUTPUT
+        Number of entries populated
+    NOTES
+        Each block is compared against the farthest point kept so far in one instruction.  Only the (rare)
+            candidates closer than that are inserted, one at a time.
+        This function does not perform input validation
+ */
+__attribute__((target("avx2")))
+int scan_two_dim_avx2(int *absX, int *absY, int numPnts, int srcX, int srcY, int skipIndex, int numNeighbours,
+                      int *id_arr, long long *sqDist_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = 0;                                           // Number of entries populated
+    __m256i srcXVec = _mm256_set1_epi32(srcX);                  // 'Origin' x, in every lane
+    __m256i srcYVec = _mm256_set1_epi32(srcY);                  // 'Origin' y, in every lane
+    __m256i worstVec = _mm256_set1_epi64x(LLONG_MAX);           // Farthest squared distance worth keeping
+    __m256i deltaX;                                             // X distance from the 'origin'
+    __m256i deltaY;                                             // Y distance from the 'origin'
+    __m256i evenDist;                                           // Squared distance of the even lanes
+    __m256i oddDist;                                            // Squared distance of the odd lanes
+    long long evenLane[HS_SCAN_LANES / 2];                      // evenDist, spilled for the keepers
+    long long oddLane[HS_SCAN_LANES / 2];                       // oddDist, spilled for the keepers
+    unsigned int evenBits = 0;                                  // One bit per even lane worth keeping
+    unsigned int oddBits = 0;                                   // One bit per odd lane worth keeping
+    int i = 0;                                                  // Iterating variable
+    int lane = 0;                                               // Iterating variable
+
+    // SCAN
+    for (i = 0; i + HS_SCAN_LANES <= numPnts; i += HS_SCAN_LANES)
+    {
+        if (false == measure_scan_block(absX, absY, i, srcXVec, srcYVec, &deltaX, &deltaY, &evenDist, &oddDist))
+        {
+            numFound = scan_two_dim_scalar(absX, absY, i, i + HS_SCAN_LANES, srcX, srcY, skipIndex,
+                                           numNeighbours, numFound, id_arr, sqDist_arr);
+        }
+        else
+        {
+            evenBits = (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(worstVec, evenDist)));
+            oddBits = (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(worstVec, oddDist)));
+
+            if (evenBits || oddBits)
+            {
+                _mm256_storeu_si256((__m256i *)evenLane, evenDist);
+                _mm256_storeu_si256((__m256i *)oddLane, oddDist);
+
+                // Candidates are inserted in index order (and skipIndex is skipped) like the scalar kernel
+                for (lane = 0; lane < HS_SCAN_LANES / 2; lane++)
+                {
+                    if ((evenBits & (1U << lane)) && i + (2 * lane) != skipIndex)
+                    {
+                        numFound = keep_two_dim_candidate(i + (2 * lane), evenLane[lane], numNeighbours, numFound,
+                                                          id_arr, sqDist_arr);
+                    }
+                    if ((oddBits & (1U << lane)) && i + (2 * lane) + 1 != skipIndex)
+                    {
+                        numFound = keep_two_dim_candidate(i + (2 * lane) + 1, oddLane[lane], numNeighbours,
+                                                          numFound, id_arr, sqDist_arr);
+                    }
+                }
+            }
+        }
+
+        // Blocks are in index order so only a strictly closer candidate can displace the farthest keeper
+        if (numFound == numNeighbours)
+        {
+            worstVec = _mm256_set1_epi64x(sqDist_arr[numFound - 1]);
+        }
+    }
+
+    // LEFTOVERS
+    numFound = scan_two_dim_scalar(absX, absY, i, numPnts, srcX, srcY, skipIndex, numNeighbours, numFound, id_arr,
+                                   sqDist_arr);
+
+    // DONE
+    return numFound;
+}
+#endif  // HS_SCAN_HAVE_AVX2
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+int select_scan_kernel(int kernel)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;  // Kernel now in use
+
+    // INPUT VALIDATION
+    if (HS_SCAN_KERNEL_AUTO != kernel && HS_SCAN_KERNEL_SCALAR != kernel && HS_SCAN_KERNEL_AVX2 != kernel)
+    {
+        HARKLE_ERROR(Harklescan, select_scan_kernel, Invalid kernel);
+    }
+    else if (HS_SCAN_KERNEL_AVX2 == kernel && false == is_avx2_supported())
+    {
+        HARKLE_ERROR(Harklescan, select_scan_kernel, This processor does not support AVX2);
+    }
+    else
+    {
+        // SELECT
+        scanKernel = kernel;
+        retVal = get_scan_kernel();
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int get_scan_kernel(void)
+{
+    // LOCAL VARIABLES
+    int retVal = scanKernel;  // Kernel to use
+
+    if (HS_SCAN_KERNEL_AUTO == retVal)
+    {
+        retVal = (true == is_avx2_supported()) ? HS_SCAN_KERNEL_AVX2 : HS_SCAN_KERNEL_SCALAR;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int scan_closest_one_dim(int *absX, int *absY, int numPnts, int srcX, int srcY, int skipIndex, bool vertLine,
+                         int *id_arr, long long *sqDist_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = -1;  // Number of sides a point was found on
+
+    // INPUT VALIDATION
+    if (!absX || !absY || 0 > numPnts)
+    {
+        HARKLE_ERROR(Harklescan, scan_closest_one_dim, Invalid coordinate arrays);
+    }
+    else if (!id_arr || !sqDist_arr)
+    {
+        HARKLE_ERROR(Harklescan, scan_closest_one_dim, Invalid out parameters);
+    }
+    else
+    {
+        // SCAN
+        id_arr[0] = -1;
+        id_arr[1] = -1;
+        sqDist_arr[0] = 0;
+        sqDist_arr[1] = 0;
+
+#ifdef HS_SCAN_HAVE_AVX2
+        if (numPnts >= HS_SCAN_MIN_VECTOR_PNTS && HS_SCAN_KERNEL_AVX2 == get_scan_kernel())
+        {
+            scan_one_dim_avx2(absX, absY, numPnts, srcX, srcY, skipIndex, vertLine, id_arr, sqDist_arr);
+        }
+        else
+#endif  // HS_SCAN_HAVE_AVX2
+        {
+            scan_one_dim_scalar(absX, absY, 0, numPnts, srcX, srcY, skipIndex, vertLine, id_arr, sqDist_arr);
+        }
+
+        numFound = ((-1 != id_arr[0]) ? 1 : 0) + ((-1 != id_arr[1]) ? 1 : 0);
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+int scan_closest_two_dim(int *absX, int *absY, int numPnts, int srcX, int srcY, int skipIndex, int numNeighbours,
+                         int *id_arr, long long *sqDist_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = -1;  // Number of points found
+
+    // INPUT VALIDATION
+    if (!absX || !absY || 0 > numPnts)
+    {
+        HARKLE_ERROR(Harklescan, scan_closest_two_dim, Invalid coordinate arrays);
+    }
+    else if (1 > numNeighbours || HS_SCAN_MAX_NEIGHBOURS < numNeighbours)
+    {
+        HARKLE_ERROR(Harklescan, scan_closest_two_dim, Invalid number of neighbours);
+    }
+    else if (!id_arr || !sqDist_arr)
+    {
+        HARKLE_ERROR(Harklescan, scan_closest_two_dim, Invalid out parameters);
+    }
+    else
+    {
+        // SCAN
+#ifdef HS_SCAN_HAVE_AVX2
+        if (numPnts >= HS_SCAN_MIN_VECTOR_PNTS && HS_SCAN_KERNEL_AVX2 == get_scan_kernel())
+        {
+            numFound = scan_two_dim_avx2(absX, absY, numPnts, srcX, srcY, skipIndex, numNeighbours, id_arr,
+                                         sqDist_arr);
+        }
+        else
+#endif  // HS_SCAN_HAVE_AVX2
+        {
+            numFound = scan_two_dim_scalar(absX, absY, 0, numPnts, srcX, srcY, skipIndex, numNeighbours, 0, id_arr,
+                                           sqDist_arr);
+        }
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+int find_closest_store_points(hsSwarm_ptr swarm_ptr, int index, hsLineLen_ptr *coord_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = -1;                            // Number of coord_arr entries populated
+    int numEntries = 0;                           // Number of entries in coord_arr
+    int id_arr[HS_SCAN_MAX_NEIGHBOURS];           // Out parameter for the scans
+    long long sqDist_arr[HS_SCAN_MAX_NEIGHBOURS]; // Out parameter for the scans
+    bool vertLine = false;                        // If true, the line is vertical
+    int tmpFound = 0;                             // Return value from the scans
+    int i = 0;                                    // Iterating variable
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harklescan, find_closest_store_points, Invalid swarm_ptr);
+    }
+    else if (0 > index || index >= swarm_ptr->numPnts)
+    {
+        HARKLE_ERROR(Harklescan, find_closest_store_points, Invalid index);
+    }
+    else if (!coord_arr)
+    {
+        HARKLE_ERROR(Harklescan, find_closest_store_points, Invalid coord_arr);
+    }
+    else
+    {
+        while (numEntries <= HS_SCAN_MAX_NEIGHBOURS && coord_arr[numEntries])
+        {
+            numEntries++;
+        }
+
+        if (2 > numEntries || HS_SCAN_MAX_NEIGHBOURS < numEntries)
+        {
+            HARKLE_ERROR(Harklescan, find_closest_store_points, Unsupported number of dimensions);
+        }
+        else
+        {
+            numFound = 0;
+        }
+    }
+
+    // FIND POINTS
+    // One dimension: the closest point on either side of the line
+    if (2 == numEntries && 0 == numFound)
+    {
+        // 1. Determine line direction (like find_closest_one_dim_points(), from the first other point)
+        if (swarm_ptr->numPnts > 1)
+        {
+            vertLine = (swarm_ptr->absX[(0 == index) ? 1 : 0] == swarm_ptr->absX[index]) ? true : false;
+        }
+
+        // 2. Find nearest points on both sides of the line
+        tmpFound = scan_closest_one_dim(swarm_ptr->absX, swarm_ptr->absY, swarm_ptr->numPnts,
+                                        swarm_ptr->absX[index], swarm_ptr->absY[index], index, vertLine, id_arr,
+                                        sqDist_arr);
+
+        for (i = 0; i < 2 && -1 < tmpFound; i++)
+        {
+            if (-1 != id_arr[i])
+            {
+                coord_arr[i]->xCoord = swarm_ptr->absX[id_arr[i]];
+                coord_arr[i]->yCoord = swarm_ptr->absY[id_arr[i]];
+                coord_arr[i]->dist = sqrt((double)sqDist_arr[i]);
+                numFound++;
+            }
+        }
+    }
+    // Two dimensions: the closest points, closest first
+    else if (0 == numFound)
+    {
+        tmpFound = scan_closest_two_dim(swarm_ptr->absX, swarm_ptr->absY, swarm_ptr->numPnts,
+                                        swarm_ptr->absX[index], swarm_ptr->absY[index], index, numEntries, id_arr,
+                                        sqDist_arr);
+
+        for (i = 0; i < tmpFound; i++)
+        {
+            coord_arr[i]->xCoord = swarm_ptr->absX[id_arr[i]];
+            coord_arr[i]->yCoord = swarm_ptr->absY[id_arr[i]];
+            coord_arr[i]->dist = sqrt((double)sqDist_arr[i]);
+            numFound++;
+        }
+    }
+
+    if (0 > tmpFound)
+    {
+        HARKLE_ERROR(Harklescan, find_closest_store_points, Scan failed);
+        numFound = -1;
+    }
+
+    // DONE
+    return numFound;
+}
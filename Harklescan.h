@@ -0,0 +1,119 @@
+#ifndef __HARKLESCAN__
+#define __HARKLESCAN__
+
+#include "Harklestore.h"        // hsSwarm_ptr
+#include "Harkleswarm.h"        // hsLineLen_ptr
+#include <stdbool.h>            // bool, true, false
+
+// Batched nearest-neighbour scan kernels
+//  These scan the contiguous, parallel coordinate arrays of a swarm store (see: Harklestore.h) a block of
+//  candidates at a time: squared distances for the whole block, then one comparison per block to find the
+//  candidates worth keeping.  Every kernel returns exactly what the scalar kernel returns, ties included.
+//  The AVX2 kernel evaluates HS_SCAN_LANES candidates per instruction and is selected at runtime, if the
+//  processor supports it.  Define HS_SCAN_NO_SIMD (e.g., -DHS_SCAN_NO_SIMD) to build the scalar kernel only.
+
+// Defined if the compiler can build the AVX2 kernels (GCC or Clang targeting x86)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(HS_SCAN_NO_SIMD)
+#define HS_SCAN_HAVE_AVX2
+#endif  // HS_SCAN_HAVE_AVX2
+
+// Scan kernels (see: select_scan_kernel())
+#define HS_SCAN_KERNEL_AUTO 0        // The fastest kernel the processor supports
+#define HS_SCAN_KERNEL_SCALAR 1      // One candidate at a time
+#define HS_SCAN_KERNEL_AVX2 2        // HS_SCAN_LANES candidates at a time
+// Number of candidates the AVX2 kernel evaluates per instruction
+#define HS_SCAN_LANES 8
+// Largest number of neighbours scan_closest_two_dim() will find
+#define HS_SCAN_MAX_NEIGHBOURS 16
+
+
+/*
+    PURPOSE - Choose the kernel every scan uses
+    INPUT
+        kernel - HS_SCAN_KERNEL_* value
+    OUTPUT
+        On success, the HS_SCAN_KERNEL_* value now in use (never HS_SCAN_KERNEL_AUTO)
+        On failure (e.g., the processor doesn't support the kernel), -1 and the kernel in use is unchanged
+    NOTES
+        Scans use HS_SCAN_KERNEL_AUTO until this is called.  Call it before any thread starts scanning.
+ */
+int select_scan_kernel(int kernel);
+
+
+/*
+    PURPOSE - Resolve the kernel the next scan will use
+    INPUT - None
+    OUTPUT
+        HS_SCAN_KERNEL_SCALAR or HS_SCAN_KERNEL_AVX2
+    NOTES
+        HS_SCAN_KERNEL_AUTO is resolved on every call, instead of being cached, so concurrent scans never write.
+            Other batched kernels (e.g., move_shawarma_bulk()) follow this choice too.
+ */
+int get_scan_kernel(void);
+
+
+/*
+    PURPOSE - Find the closest point on each side of a coordinate along a line
+    INPUT
+        absX - numPnts x coordinates
+        absY - numPnts y coordinates
+        numPnts - Number of points in absX and absY
+        srcX - X coordinate of the 'origin'
+        srcY - Y coordinate of the 'origin'
+        skipIndex - Index of a point to ignore (e.g., the point at the 'origin') or -1
+        vertLine - If true, sides are decided by y coordinate instead of x
+        id_arr - [Out] Array of two ints for the indices: the closest "left" (lower x) point, or "up" (higher
+            y) point on a vertical line, in id_arr[0] and the closest "right"/"down" point in id_arr[1].  -1
+            if there is no point on that side.
+        sqDist_arr - [Out] Array of two long longs for the squared distances
+    OUTPUT
+        On success, number of sides a point was found on
+        On failure, -1
+    NOTES
+        This is the kernel equivalent of find_closest_one_dim_points().  Points level with the 'origin' are on
+            neither side.  Ties go to the lower index.
+ */
+int scan_closest_one_dim(int *absX, int *absY, int numPnts, int srcX, int srcY, int skipIndex, bool vertLine,
+                         int *id_arr, long long *sqDist_arr);
+
+
+/*
+    PURPOSE - Find the points closest to a coordinate
+    INPUT
+        absX - numPnts x coordinates
+        absY - numPnts y coordinates
+        numPnts - Number of points in absX and absY
+        srcX - X coordinate of the 'origin'
+        srcY - Y coordinate of the 'origin'
+        skipIndex - Index of a point to ignore (e.g., the point at the 'origin') or -1
+        numNeighbours - Number of points to find (1 through HS_SCAN_MAX_NEIGHBOURS)
+        id_arr - [Out] Array of numNeighbours ints for the indices
+        sqDist_arr - [Out] Array of numNeighbours long longs for the squared distances
+    OUTPUT
+        On success, number of points found, closest first.  Ties go to the lower index.
+        On failure, -1
+    NOTES
+        This is the kernel equivalent of find_closest_two_dim_points()
+ */
+int scan_closest_two_dim(int *absX, int *absY, int numPnts, int srcX, int srcY, int skipIndex, int numNeighbours,
+                         int *id_arr, long long *sqDist_arr);
+
+
+/*
+    PURPOSE - Fill the given array with coordinates and distances representing the closest points to a point
+    INPUT
+        swarm_ptr - Pointer to a swarm store
+        index - Swarm store index of the 'origin' point
+        coord_arr - NULL-terminated array of hsLineLen struct pointers to use as 'out' parameters
+    OUTPUT
+        On success, number of hsLineLen struct pointers populated with points and distances
+        On failure, -1
+    NOTES
+        This is the swarm store equivalent of find_closest_points() and find_closest_tree_points() and follows
+            the same conventions.  Two entries finds the closest point on each side of a line (the direction is
+            decided by the first other point in the store), three or more finds that many points.
+ */
+int find_closest_store_points(hsSwarm_ptr swarm_ptr, int index, hsLineLen_ptr *coord_arr);
+
+
+#endif  // __HARKLESCAN__
@@ -0,0 +1,488 @@
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harkleoccupancy.h"    // build_occupancy_map(), is_coordinate_occupied(), occupy_coordinate()
+#include "Harklesnap.h"
+#include <fcntl.h>              // open()
+#include <limits.h>             // INT_MAX
+#include <stdio.h>              // fclose(), fflush(), fileno(), fopen(), fprintf(), fwrite(), rename(), remove()
+#include <stdlib.h>             // calloc(), free()
+#include <string.h>             // memcmp(), memcpy(), memset(), strlen()
+#include <sys/mman.h>           // mmap(), munmap()
+#include <sys/stat.h>           // fstat()
+#include <unistd.h>             // close(), fsync()
+
+// Coordinates are written straight from int arrays
+#if INT_MAX != INT32_MAX
+#error "Harklesnap requires a 32-bit int"
+#endif
+
+#define HS_SNAP_NUM_ARRAYS (HS_SNAP_MAX_DIMS + 2)  // posNum, one per dimension, graphic
+#define HS_SNAP_TMP_SUFFIX ".tmp"                  // Appended to a snapshot's filename while it's written
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Round a size up to a multiple of HS_SNAP_ALIGN
+    INPUT
+        numBytes - Size to round up
+    OUTPUT
+        numBytes, rounded up
+ */
+uint64_t align_snapshot_size(uint64_t numBytes)
+{
+    return (numBytes + HS_SNAP_ALIGN - 1) / HS_SNAP_ALIGN * HS_SNAP_ALIGN;
+}
+
+
+/*
+    PURPOSE - Calculate where every array of a snapshot starts
+    INPUT
+        numDims - Number of dimensions, 1 through HS_SNAP_MAX_DIMS
+        numPnts - Number of points
+        offset_arr - [Out] HS_SNAP_NUM_ARRAYS offsets, from the start of the file: posNum, x, y, z and graphic
+            (0 for a dimension the snapshot doesn't have)
+    OUTPUT
+        Size of the entire file
+    NOTES
+        This function does not perform input validation
+ */
+uint64_t calc_snapshot_layout(int numDims, int numPnts, uint64_t *offset_arr)
+{
+    // LOCAL VARIABLES
+    uint64_t nextOffset = align_snapshot_size(sizeof(hsSnapHeader));         // Start of the next array
+    uint64_t coordSize = align_snapshot_size((uint64_t)numPnts * sizeof(int32_t));  // Size of an int32 array
+    int i = 0;                                                               // Iterating variable
+
+    // posNum
+    offset_arr[0] = nextOffset;
+    nextOffset += coordSize;
+
+    // Coordinates
+    for (i = 0; i < HS_SNAP_MAX_DIMS; i++)
+    {
+        offset_arr[i + 1] = 0;
+
+        if (i < numDims)
+        {
+            offset_arr[i + 1] = nextOffset;
+            nextOffset += coordSize;
+        }
+    }
+
+    // Graphics
+    offset_arr[HS_SNAP_NUM_ARRAYS - 1] = nextOffset;
+    nextOffset += align_snapshot_size((uint64_t)numPnts);
+
+    // DONE
+    return nextOffset;
+}
+
+
+/*
+    PURPOSE - Write a buffer to a file, followed by enough zeroes to end on a multiple of HS_SNAP_ALIGN bytes
+    INPUT
+        outFile - File to write to
+        buf_ptr - Buffer to write
+        numBytes - Size of buf_ptr
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This function does not perform input validation
+ */
+bool write_snapshot_block(FILE *outFile, void *buf_ptr, size_t numBytes)
+{
+    // LOCAL VARIABLES
+    bool success = true;                        // Set this to false if anything fails
+    static const char padding[HS_SNAP_ALIGN];   // Zeroes
+    size_t padLen = align_snapshot_size(numBytes) - numBytes;  // Number of zeroes to write
+
+    if (numBytes != fwrite(buf_ptr, 1, numBytes, outFile) || padLen != fwrite(padding, 1, padLen, outFile))
+    {
+        success = false;
+    }
+
+    // DONE
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+bool write_swarm_snapshot(char *filename, hsSnapHeader_ptr header_ptr, int *posNum, int *absX, int *absY,
+                          int *absZ, char *graphic)
+{
+    // LOCAL VARIABLES
+    bool success = true;                          // Set this to false if anything fails
+    hsSnapHeader header;                          // Header to write
+    uint64_t offset_arr[HS_SNAP_NUM_ARRAYS];      // Where every array starts
+    int *coord_arr[HS_SNAP_MAX_DIMS];             // absX, absY and absZ
+    char *tmpName = NULL;                         // filename.tmp
+    FILE *outFile = NULL;                         // tmpName, open for writing
+    size_t coordSize = 0;                         // Size of an int array
+    int i = 0;                                    // Iterating variable
+
+    // INPUT VALIDATION
+    if (!filename || !(*filename))
+    {
+        HARKLE_ERROR(Harklesnap, write_swarm_snapshot, Invalid filename);
+        success = false;
+    }
+    else if (!header_ptr || 1 > header_ptr->numDims || HS_SNAP_MAX_DIMS < header_ptr->numDims
+             || 1 > header_ptr->numPnts)
+    {
+        HARKLE_ERROR(Harklesnap, write_swarm_snapshot, Invalid header_ptr);
+        success = false;
+    }
+    else if (!posNum || !absX || (1 < header_ptr->numDims && !absY) || (2 < header_ptr->numDims && !absZ)
+             || !graphic)
+    {
+        HARKLE_ERROR(Harklesnap, write_swarm_snapshot, Invalid swarm arrays);
+        success = false;
+    }
+
+    // HEADER
+    if (true == success)
+    {
+        header = *header_ptr;
+        memset(header.magic, 0x0, sizeof(header.magic));
+        memcpy(header.magic, HS_SNAP_MAGIC, sizeof(HS_SNAP_MAGIC));
+        header.version = HS_SNAP_VERSION;
+        header.headerSize = sizeof(hsSnapHeader);
+        header.byteOrder = HS_SNAP_BYTE_ORDER;
+        if (3 > header.numDims)
+        {
+            header.numDepth = 1;
+        }
+        memset(header.reserved, 0x0, sizeof(header.reserved));
+        header.fileSize = calc_snapshot_layout(header.numDims, header.numPnts, offset_arr);
+        header.arrayOffset = offset_arr[0];
+        coord_arr[0] = absX;
+        coord_arr[1] = absY;
+        coord_arr[2] = absZ;
+        coordSize = (size_t)header.numPnts * sizeof(int);
+
+        tmpName = calloc(strlen(filename) + sizeof(HS_SNAP_TMP_SUFFIX), sizeof(char));
+
+        if (!tmpName)
+        {
+            HARKLE_ERROR(Harklesnap, write_swarm_snapshot, calloc failed);
+            success = false;
+        }
+        else
+        {
+            memcpy(tmpName, filename, strlen(filename));
+            memcpy(tmpName + strlen(filename), HS_SNAP_TMP_SUFFIX, sizeof(HS_SNAP_TMP_SUFFIX));
+        }
+    }
+
+    // WRITE
+    if (true == success)
+    {
+        outFile = fopen(tmpName, "wb");
+
+        if (!outFile)
+        {
+            HARKLE_ERROR(Harklesnap, write_swarm_snapshot, fopen failed);
+            success = false;
+        }
+    }
+    if (true == success)
+    {
+        success = write_snapshot_block(outFile, &header, sizeof(header))
+                  && write_snapshot_block(outFile, posNum, coordSize);
+
+        for (i = 0; true == success && i < header.numDims; i++)
+        {
+            success = write_snapshot_block(outFile, coord_arr[i], coordSize);
+        }
+        if (true == success)
+        {
+            success = write_snapshot_block(outFile, graphic, (size_t)header.numPnts);
+        }
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklesnap, write_swarm_snapshot, fwrite failed);
+        }
+        // Make sure it's on the disk before it replaces the last good snapshot
+        else if (0 != fflush(outFile) || 0 != fsync(fileno(outFile)))
+        {
+            HARKLE_ERROR(Harklesnap, write_swarm_snapshot, Failed to sync the snapshot);
+            success = false;
+        }
+    }
+    if (outFile)
+    {
+        if (0 != fclose(outFile) && true == success)
+        {
+            HARKLE_ERROR(Harklesnap, write_swarm_snapshot, fclose failed);
+            success = false;
+        }
+        outFile = NULL;
+    }
+
+    // REPLACE
+    if (true == success && 0 != rename(tmpName, filename))
+    {
+        HARKLE_ERROR(Harklesnap, write_swarm_snapshot, rename failed);
+        success = false;
+    }
+
+    // CLEAN UP
+    if (tmpName)
+    {
+        if (false == success)
+        {
+            remove(tmpName);
+        }
+        free(tmpName);
+        tmpName = NULL;
+    }
+
+    // DONE
+    return success;
+}
+
+
+hsSnapshot_ptr map_swarm_snapshot(char *filename)
+{
+    // LOCAL VARIABLES
+    hsSnapshot_ptr retVal = NULL;             // Mapped snapshot
+    bool success = true;                      // Set this to false if anything fails
+    int fileDesc = -1;                        // filename, open for reading
+    struct stat fileStat;                     // filename's size
+    hsSnapHeader_ptr header_ptr = NULL;       // Mapped header
+    uint64_t offset_arr[HS_SNAP_NUM_ARRAYS];  // Where every array should start
+    char *base_ptr = NULL;                    // Start of the mapping, in bytes
+
+    // INPUT VALIDATION
+    if (!filename || !(*filename))
+    {
+        HARKLE_ERROR(Harklesnap, map_swarm_snapshot, Invalid filename);
+        success = false;
+    }
+
+    // MAP IT
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsSnapshot));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, calloc failed);
+            success = false;
+        }
+    }
+    if (true == success)
+    {
+        fileDesc = open(filename, O_RDONLY);
+
+        if (-1 == fileDesc)
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, open failed);
+            success = false;
+        }
+        else if (0 != fstat(fileDesc, &fileStat))
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, fstat failed);
+            success = false;
+        }
+        else if ((off_t)sizeof(hsSnapHeader) > fileStat.st_size)
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, File is too small to be a snapshot);
+            success = false;
+        }
+    }
+    if (true == success)
+    {
+        retVal->mapLen = (size_t)fileStat.st_size;
+        retVal->map_ptr = mmap(NULL, retVal->mapLen, PROT_READ, MAP_PRIVATE, fileDesc, 0);
+
+        if (MAP_FAILED == retVal->map_ptr)
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, mmap failed);
+            retVal->map_ptr = NULL;
+            success = false;
+        }
+    }
+    if (-1 != fileDesc)
+    {
+        close(fileDesc);  // The mapping holds its own reference
+        fileDesc = -1;
+    }
+
+    // VALIDATE THE HEADER
+    if (true == success)
+    {
+        header_ptr = (hsSnapHeader_ptr)retVal->map_ptr;
+
+        if (0 != memcmp(header_ptr->magic, HS_SNAP_MAGIC, sizeof(HS_SNAP_MAGIC)))
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, Not a snapshot);
+            success = false;
+        }
+        else if (HS_SNAP_BYTE_ORDER != header_ptr->byteOrder)
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, Snapshot was written with a different byte order);
+            success = false;
+        }
+        else if (HS_SNAP_VERSION != header_ptr->version || sizeof(hsSnapHeader) != header_ptr->headerSize)
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, Unsupported snapshot version);
+            success = false;
+        }
+        else if (1 > header_ptr->numDims || HS_SNAP_MAX_DIMS < header_ptr->numDims || 1 > header_ptr->numPnts)
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, Invalid snapshot header);
+            success = false;
+        }
+        else if (calc_snapshot_layout(header_ptr->numDims, header_ptr->numPnts, offset_arr) != header_ptr->fileSize
+                 || offset_arr[0] != header_ptr->arrayOffset || header_ptr->fileSize != retVal->mapLen)
+        {
+            HARKLE_ERROR(Harklesnap, map_swarm_snapshot, Snapshot is truncated or corrupt);
+            success = false;
+        }
+    }
+
+    // POINT INTO IT
+    if (true == success)
+    {
+        base_ptr = (char *)retVal->map_ptr;
+        retVal->header_ptr = header_ptr;
+        retVal->posNum = (int32_t *)(base_ptr + offset_arr[0]);
+        retVal->absX = (int32_t *)(base_ptr + offset_arr[1]);
+        retVal->absY = offset_arr[2] ? (int32_t *)(base_ptr + offset_arr[2]) : NULL;
+        retVal->absZ = offset_arr[3] ? (int32_t *)(base_ptr + offset_arr[3]) : NULL;
+        retVal->graphic = base_ptr + offset_arr[HS_SNAP_NUM_ARRAYS - 1];
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        unmap_swarm_snapshot(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool unmap_swarm_snapshot(hsSnapshot_ptr *oldSnap_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;            // Set this to true if the snapshot is unmapped
+    hsSnapshot_ptr snap_ptr = NULL;  // Local copy of *oldSnap_ptr
+
+    // INPUT VALIDATION
+    if (!oldSnap_ptr || !(*oldSnap_ptr))
+    {
+        HARKLE_ERROR(Harklesnap, unmap_swarm_snapshot, Invalid oldSnap_ptr);
+    }
+    else
+    {
+        // UNMAP
+        snap_ptr = *oldSnap_ptr;
+        success = true;
+
+        if (snap_ptr->map_ptr && 0 != munmap(snap_ptr->map_ptr, snap_ptr->mapLen))
+        {
+            HARKLE_ERROR(Harklesnap, unmap_swarm_snapshot, munmap failed);
+            success = false;
+        }
+
+        // FREE
+        memset(snap_ptr, 0x0, sizeof(hsSnapshot));
+        free(snap_ptr);
+        *oldSnap_ptr = NULL;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool verify_snapshot_swarm(hsSnapshot_ptr snap_ptr, int maxX, int maxY)
+{
+    // LOCAL VARIABLES
+    bool success = false;               // Set this to true if every point is valid
+    int numPnts = 0;                    // Number of points in the snapshot
+    hsOccupancy_ptr occupy_ptr = NULL;  // Coordinates already claimed
+    bool *seen_arr = NULL;              // seen_arr[posNum] is true once posNum is claimed
+    int i = 0;                          // Iterating variable
+
+    // INPUT VALIDATION
+    if (!snap_ptr || !(snap_ptr->header_ptr) || !(snap_ptr->posNum) || !(snap_ptr->absX) || !(snap_ptr->absY))
+    {
+        HARKLE_ERROR(Harklesnap, verify_snapshot_swarm, Invalid snap_ptr);
+    }
+    else if (1 > maxX || 1 > maxY)
+    {
+        HARKLE_ERROR(Harklesnap, verify_snapshot_swarm, Invalid field);
+    }
+    else
+    {
+        // SETUP
+        numPnts = snap_ptr->header_ptr->numPnts;
+        occupy_ptr = build_occupancy_map(1, maxX, 1, maxY, numPnts);
+        seen_arr = calloc(numPnts + 1, sizeof(bool));
+        success = true;
+
+        if (!occupy_ptr || !seen_arr)
+        {
+            HARKLE_ERROR(Harklesnap, verify_snapshot_swarm, Failed to allocate the bookkeeping);
+            success = false;
+        }
+    }
+
+    // VERIFY
+    for (i = 0; true == success && i < numPnts; i++)
+    {
+        if (1 > snap_ptr->absX[i] || maxX < snap_ptr->absX[i] || 1 > snap_ptr->absY[i] || maxY < snap_ptr->absY[i])
+        {
+            fprintf(stderr, "Snapshot point %d at (%d, %d) is outside the field\n", i, snap_ptr->absX[i],
+                    snap_ptr->absY[i]);
+            success = false;
+        }
+        else if (1 > snap_ptr->posNum[i] || numPnts < snap_ptr->posNum[i] || true == seen_arr[snap_ptr->posNum[i]])
+        {
+            fprintf(stderr, "Snapshot point %d has an invalid or repeated posNum (%d)\n", i, snap_ptr->posNum[i]);
+            success = false;
+        }
+        else if (true == is_coordinate_occupied(occupy_ptr, snap_ptr->absX[i], snap_ptr->absY[i]))
+        {
+            fprintf(stderr, "Snapshot point %d repeats the coordinate (%d, %d)\n", i, snap_ptr->absX[i],
+                    snap_ptr->absY[i]);
+            success = false;
+        }
+        else
+        {
+            seen_arr[snap_ptr->posNum[i]] = true;
+            success = occupy_coordinate(occupy_ptr, snap_ptr->absX[i], snap_ptr->absY[i]);
+
+            if (false == success)
+            {
+                HARKLE_ERROR(Harklesnap, verify_snapshot_swarm, occupy_coordinate failed);
+            }
+        }
+    }
+
+    // CLEAN UP
+    if (occupy_ptr)
+    {
+        free_occupancy_map(&occupy_ptr);
+    }
+    if (seen_arr)
+    {
+        free(seen_arr);
+    }
+
+    // DONE
+    return success;
+}
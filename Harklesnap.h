@@ -0,0 +1,126 @@
+#ifndef __HARKLESNAP__
+#define __HARKLESNAP__
+
+#include <stdbool.h>            // bool, true, false
+#include <stddef.h>             // size_t
+#include <stdint.h>             // int32_t, int64_t, uint32_t, uint64_t
+
+// Identifies a swarm snapshot file (the terminating nul byte is part of the magic)
+#define HS_SNAP_MAGIC "HSWSNAP"
+// Incremented whenever the layout of a snapshot file changes
+#define HS_SNAP_VERSION 1
+// Written as-is so a snapshot from a machine with the other byte order is rejected instead of misread
+#define HS_SNAP_BYTE_ORDER 0x01020304
+// The header, and every array after it, starts on a multiple of this many bytes
+#define HS_SNAP_ALIGN 64
+// Largest number of dimensions a snapshot holds
+#define HS_SNAP_MAX_DIMS 3
+
+// Defines the fixed-layout header at the start of every swarm snapshot file
+//  The header is followed by numPnts posNums, numPnts coordinates per dimension (x, then y, then z) and
+//  numPnts graphics.  Every array is packed, in native byte order, and starts on a multiple of HS_SNAP_ALIGN
+//  bytes so a mapped snapshot can be read in place.
+typedef struct hsSnapshotHeader
+{
+    char magic[8];            // HS_SNAP_MAGIC
+    uint32_t version;         // HS_SNAP_VERSION
+    uint32_t headerSize;      // sizeof(hsSnapHeader)
+    uint32_t byteOrder;       // HS_SNAP_BYTE_ORDER
+    int32_t numDims;          // Number of dimensions the swarm moves in, 1 through HS_SNAP_MAX_DIMS
+    int32_t numRows;          // Number of rows (y) in the field
+    int32_t numCols;          // Number of columns (x) in the field
+    int32_t numDepth;         // Number of layers (z) in the field (1 below three dimensions)
+    int32_t engine;           // Engine that swarmed it (e.g., HEADLESS_ENGINE_*)
+    int32_t intercepts;       // 1 if the engine treated the field's edges as points, 0 if not
+    int32_t numPnts;          // Number of points in the swarm
+    int64_t numSweeps;        // Number of sweeps made before the snapshot was taken
+    int64_t totMoves;         // Number of moves made before the snapshot was taken
+    uint64_t rngSeed;         // srand() seed the swarm was scattered with
+    uint64_t arrayOffset;     // Offset of the first array, from the start of the file
+    uint64_t fileSize;        // Size of the entire file
+    uint8_t reserved[40];     // Zeroed, pads the header to 128 bytes
+} hsSnapHeader, *hsSnapHeader_ptr;
+
+// Defines the struct that describes a snapshot file mapped into memory
+//  Every pointer points into the mapping, which is read-only.  Nothing is copied or parsed per point.
+typedef struct hsSwarmSnapshot
+{
+    void *map_ptr;            // Start of the mapping
+    size_t mapLen;            // Length of the mapping
+    hsSnapHeader_ptr header_ptr;  // The file's header (the start of the mapping)
+    int32_t *posNum;          // numPnts posNums
+    int32_t *absX;            // numPnts x coordinates
+    int32_t *absY;            // numPnts y coordinates (NULL below two dimensions)
+    int32_t *absZ;            // numPnts z coordinates (NULL below three dimensions)
+    char *graphic;            // numPnts characters to print at each point
+} hsSnapshot, *hsSnapshot_ptr;
+
+
+/*
+    PURPOSE - Write a swarm to a snapshot file
+    INPUT
+        filename - Snapshot file to write
+        header_ptr - Pointer to a header describing the run (numDims, the field, engine, intercepts, numPnts,
+            numSweeps, totMoves and rngSeed are used, the rest is filled in)
+        posNum - numPnts posNums
+        absX - numPnts x coordinates
+        absY - numPnts y coordinates (ignored below two dimensions)
+        absZ - numPnts z coordinates (ignored below three dimensions)
+        graphic - numPnts characters to print at each point
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The snapshot is written to filename.tmp, synced to disk and renamed over filename so a crash while
+            checkpointing never leaves a torn snapshot behind
+ */
+bool write_swarm_snapshot(char *filename, hsSnapHeader_ptr header_ptr, int *posNum, int *absX, int *absY,
+                          int *absZ, char *graphic);
+
+
+/*
+    PURPOSE - Map a snapshot file into memory
+    INPUT
+        filename - Snapshot file to map
+    OUTPUT
+        On success, pointer to a heap-allocated hsSnapshot struct
+        On failure, NULL
+    NOTES
+        The header (magic, version, byte order, layout and size) is checked before any array is trusted
+        It is the caller's responsibility to unmap the file and free the memory with unmap_swarm_snapshot()
+ */
+hsSnapshot_ptr map_swarm_snapshot(char *filename);
+
+
+/*
+    PURPOSE - Unmap a snapshot file and free the heap-allocated memory associated with it
+    INPUT
+        oldSnap_ptr - A pointer to a heap-allocated hsSnapshot struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Every pointer into the mapping is invalid once this returns
+        Call this function as unmap_swarm_snapshot(&mySnap_ptr);
+ */
+bool unmap_swarm_snapshot(hsSnapshot_ptr *oldSnap_ptr);
+
+
+/*
+    PURPOSE - Verify that a mapped snapshot's swarm is one the engines can resume
+    INPUT
+        snap_ptr - Pointer to a mapped snapshot of at least two dimensions
+        maxX - Largest x coordinate a point may have (the smallest is 1)
+        maxY - Largest y coordinate a point may have (the smallest is 1)
+    OUTPUT
+        If every point is inside [1, maxX] x [1, maxY], no two points share a coordinate and the posNums are
+            exactly 1 through numPnts, true
+        Otherwise, false (and the first invalid point is printed to stderr)
+    NOTES
+        map_swarm_snapshot() checks the header but the points are only bytes from a file.  The engines assume
+            the swarm they're given is valid so check it with this function before anything is built.
+ */
+bool verify_snapshot_swarm(hsSnapshot_ptr snap_ptr, int maxX, int maxY);
+
+
+#endif  // __HARKLESNAP__
@@ -0,0 +1,729 @@
+#include "Harklecurse.h"
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harklestore.h"
+#include "Harkleswarm.h"
+#include <stdlib.h>             // calloc(), realloc(), free()
+#include <string.h>             // memcpy(), memset()
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Resize one parallel array of a swarm store
+    INPUT
+        array_ptr - Pointer to the array pointer to resize
+        elemSize - Size of one array element
+        oldLen - Number of elements currently allocated
+        newLen - Number of elements to allocate
+    OUTPUT
+        On success, true (and *array_ptr points to the resized array)
+        On failure, false (and *array_ptr is unchanged)
+    NOTES
+        Newly allocated elements are zeroized
+ */
+bool resize_store_array(void **array_ptr, size_t elemSize, int oldLen, int newLen)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the array is resized
+    char *tmp_ptr = NULL;  // Return value from realloc()
+
+    // RESIZE
+    tmp_ptr = realloc(*array_ptr, elemSize * newLen);
+
+    if (!tmp_ptr)
+    {
+        HARKLE_ERROR(Harklestore, resize_store_array, realloc failed);
+    }
+    else
+    {
+        if (newLen > oldLen)
+        {
+            memset(tmp_ptr + (elemSize * oldLen), 0x0, elemSize * (newLen - oldLen));
+        }
+        *array_ptr = tmp_ptr;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Grow every parallel point array of a swarm store
+    INPUT
+        swarm_ptr - Pointer to the swarm store to grow
+        newMax - New capacity of each array
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This function does not perform input validation
+ */
+bool grow_swarm_arrays(hsSwarm_ptr swarm_ptr, int newMax)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    // GROW
+    if (true == success)
+    {
+        success = resize_store_array((void **)&(swarm_ptr->absX), sizeof(int), swarm_ptr->maxPnts, newMax);
+    }
+    if (true == success)
+    {
+        success = resize_store_array((void **)&(swarm_ptr->absY), sizeof(int), swarm_ptr->maxPnts, newMax);
+    }
+    if (true == success)
+    {
+        success = resize_store_array((void **)&(swarm_ptr->posNum), sizeof(int), swarm_ptr->maxPnts, newMax);
+    }
+    if (true == success)
+    {
+        success = resize_store_array((void **)&(swarm_ptr->graphic), sizeof(char), swarm_ptr->maxPnts, newMax);
+    }
+    if (true == success)
+    {
+        success = resize_store_array((void **)&(swarm_ptr->hcFlags), sizeof(unsigned long),
+                                     swarm_ptr->maxPnts, newMax);
+    }
+
+    // DONE
+    if (true == success)
+    {
+        swarm_ptr->maxPnts = newMax;
+    }
+    else
+    {
+        HARKLE_ERROR(Harklestore, grow_swarm_arrays, resize_store_array failed);
+    }
+
+    return success;
+}
+
+
+/*
+    PURPOSE - Grow the posNum-to-index map of a swarm store so that it can map shNum
+    INPUT
+        swarm_ptr - Pointer to the swarm store to grow
+        shNum - posNum value the map must be able to hold
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This function does not perform input validation
+ */
+bool grow_pos_index(hsSwarm_ptr swarm_ptr, int shNum)
+{
+    // LOCAL VARIABLES
+    bool success = true;                       // Set this to false if anything fails
+    int newMax = swarm_ptr->maxPosNum;         // New largest posNum
+    int i = 0;                                 // Iterating variable
+
+    // GROW
+    if (shNum > swarm_ptr->maxPosNum)
+    {
+        if (newMax < HS_STORE_DEFAULT_CAPACITY)
+        {
+            newMax = HS_STORE_DEFAULT_CAPACITY;
+        }
+        while (newMax < shNum)
+        {
+            newMax *= 2;
+        }
+
+        success = resize_store_array((void **)&(swarm_ptr->posIndex), sizeof(int),
+                                     swarm_ptr->maxPosNum + 1, newMax + 1);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklestore, grow_pos_index, resize_store_array failed);
+        }
+        else
+        {
+            for (i = swarm_ptr->maxPosNum + 1; i <= newMax; i++)
+            {
+                swarm_ptr->posIndex[i] = -1;
+            }
+            swarm_ptr->maxPosNum = newMax;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsSwarm_ptr build_swarm_store(int maxPnts)
+{
+    // LOCAL VARIABLES
+    hsSwarm_ptr retVal = NULL;         // Swarm store to return
+    bool success = true;               // Set this to false if anything fails
+    int initMax = maxPnts;             // Initial capacity
+
+    // INPUT VALIDATION
+    if (0 > maxPnts)
+    {
+        HARKLE_ERROR(Harklestore, build_swarm_store, Invalid capacity);
+        success = false;
+    }
+    else if (0 == maxPnts)
+    {
+        initMax = HS_STORE_DEFAULT_CAPACITY;
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsSwarm));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklestore, build_swarm_store, calloc failed);
+            success = false;
+        }
+        else
+        {
+            retVal->maxPosNum = -1;  // Nothing mapped yet
+        }
+    }
+    if (true == success)
+    {
+        success = grow_swarm_arrays(retVal, initMax);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklestore, build_swarm_store, grow_swarm_arrays failed);
+        }
+    }
+    if (true == success)
+    {
+        success = grow_pos_index(retVal, initMax);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklestore, build_swarm_store, grow_pos_index failed);
+        }
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        free_swarm_store(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int add_swarm_point(hsSwarm_ptr swarm_ptr, int xVal, int yVal, int shNum, char shChar, unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;      // Array index of the new point
+    bool success = true;  // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harklestore, add_swarm_point, Invalid swarm_ptr);
+        success = false;
+    }
+    else if (1 > shNum)
+    {
+        HARKLE_ERROR(Harklestore, add_swarm_point, Invalid shNum);
+        success = false;
+    }
+    else if (-1 < get_swarm_index(swarm_ptr, shNum))
+    {
+        HARKLE_ERROR(Harklestore, add_swarm_point, Duplicate shNum);
+        success = false;
+    }
+    else if (swarm_ptr->occupy_ptr && true == is_coordinate_occupied(swarm_ptr->occupy_ptr, xVal, yVal))
+    {
+        HARKLE_ERROR(Harklestore, add_swarm_point, Duplicate coordinates);
+        success = false;
+    }
+
+    // GROW
+    if (true == success && swarm_ptr->numPnts >= swarm_ptr->maxPnts)
+    {
+        success = grow_swarm_arrays(swarm_ptr, 2 * swarm_ptr->maxPnts);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklestore, add_swarm_point, grow_swarm_arrays failed);
+        }
+    }
+    if (true == success)
+    {
+        success = grow_pos_index(swarm_ptr, shNum);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklestore, add_swarm_point, grow_pos_index failed);
+        }
+    }
+
+    if (true == success && swarm_ptr->occupy_ptr)
+    {
+        success = occupy_coordinate(swarm_ptr->occupy_ptr, xVal, yVal);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklestore, add_swarm_point, occupy_coordinate failed);
+        }
+    }
+
+    // ADD
+    if (true == success)
+    {
+        retVal = swarm_ptr->numPnts;
+        swarm_ptr->absX[retVal] = xVal;
+        swarm_ptr->absY[retVal] = yVal;
+        swarm_ptr->posNum[retVal] = shNum;
+        swarm_ptr->graphic[retVal] = shChar;
+        swarm_ptr->hcFlags[retVal] = shStatus;
+        swarm_ptr->posIndex[shNum] = retVal;
+        swarm_ptr->numPnts++;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool remove_swarm_point(hsSwarm_ptr swarm_ptr, int shNum)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the point is removed
+    int index = -1;        // Array index of shNum
+    int last = 0;          // Array index of the last point
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harklestore, remove_swarm_point, Invalid swarm_ptr);
+    }
+    else
+    {
+        index = get_swarm_index(swarm_ptr, shNum);
+
+        if (0 > index)
+        {
+            HARKLE_ERROR(Harklestore, remove_swarm_point, shNum not found);
+        }
+        else if (swarm_ptr->occupy_ptr
+                 && false == vacate_coordinate(swarm_ptr->occupy_ptr, swarm_ptr->absX[index], swarm_ptr->absY[index]))
+        {
+            HARKLE_ERROR(Harklestore, remove_swarm_point, vacate_coordinate failed);
+        }
+        else
+        {
+            // REMOVE
+            last = swarm_ptr->numPnts - 1;
+
+            if (index != last)
+            {
+                swarm_ptr->absX[index] = swarm_ptr->absX[last];
+                swarm_ptr->absY[index] = swarm_ptr->absY[last];
+                swarm_ptr->posNum[index] = swarm_ptr->posNum[last];
+                swarm_ptr->graphic[index] = swarm_ptr->graphic[last];
+                swarm_ptr->hcFlags[index] = swarm_ptr->hcFlags[last];
+                swarm_ptr->posIndex[swarm_ptr->posNum[index]] = index;
+            }
+
+            swarm_ptr->posIndex[shNum] = -1;
+            swarm_ptr->numPnts--;
+            success = true;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool move_swarm_point(hsSwarm_ptr swarm_ptr, int index, int newX, int newY)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the point is moved
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harklestore, move_swarm_point, Invalid swarm_ptr);
+    }
+    else if (0 > index || index >= swarm_ptr->numPnts)
+    {
+        HARKLE_ERROR(Harklestore, move_swarm_point, Invalid index);
+    }
+    else if (swarm_ptr->occupy_ptr && false == move_coordinate_occupant(swarm_ptr->occupy_ptr, swarm_ptr->absX[index],
+                                                                        swarm_ptr->absY[index], newX, newY))
+    {
+        HARKLE_ERROR(Harklestore, move_swarm_point, move_coordinate_occupant failed);
+    }
+    else
+    {
+        // MOVE
+        swarm_ptr->absX[index] = newX;
+        swarm_ptr->absY[index] = newY;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool attach_swarm_occupancy(hsSwarm_ptr swarm_ptr, int xMin, int xMax, int yMin, int yMax)
+{
+    // LOCAL VARIABLES
+    bool success = true;                // Set this to false if anything fails
+    hsOccupancy_ptr occupy_ptr = NULL;  // New occupancy map
+    int i = 0;                          // Iterating variable
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harklestore, attach_swarm_occupancy, Invalid swarm_ptr);
+        success = false;
+    }
+    else
+    {
+        occupy_ptr = build_occupancy_map(xMin, xMax, yMin, yMax, swarm_ptr->maxPnts);
+
+        if (!occupy_ptr)
+        {
+            HARKLE_ERROR(Harklestore, attach_swarm_occupancy, build_occupancy_map failed);
+            success = false;
+        }
+    }
+
+    // OCCUPY
+    if (true == success)
+    {
+        for (i = 0; i < swarm_ptr->numPnts; i++)
+        {
+            if (false == occupy_coordinate(occupy_ptr, swarm_ptr->absX[i], swarm_ptr->absY[i]))
+            {
+                HARKLE_ERROR(Harklestore, attach_swarm_occupancy, occupy_coordinate failed);
+                success = false;
+                break;
+            }
+        }
+    }
+
+    // ATTACH
+    if (true == success)
+    {
+        if (swarm_ptr->occupy_ptr)
+        {
+            free_occupancy_map(&(swarm_ptr->occupy_ptr));
+        }
+        swarm_ptr->occupy_ptr = occupy_ptr;
+    }
+    else if (occupy_ptr)
+    {
+        free_occupancy_map(&occupy_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+int get_swarm_index(hsSwarm_ptr swarm_ptr, int shNum)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;  // Array index of shNum
+
+    // INPUT VALIDATION
+    if (swarm_ptr && shNum > 0 && shNum <= swarm_ptr->maxPosNum)
+    {
+        retVal = swarm_ptr->posIndex[shNum];
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+hsSwarm_ptr swarm_from_shawarma_list(shawarma_ptr headNode_ptr)
+{
+    // LOCAL VARIABLES
+    hsSwarm_ptr retVal = NULL;            // New swarm store
+    shawarma_ptr tmpNode_ptr = NULL;      // Iterating variable
+    int numNodes = 0;                     // Number of nodes in the linked list
+
+    // INPUT VALIDATION
+    if (!headNode_ptr)
+    {
+        HARKLE_ERROR(Harklestore, swarm_from_shawarma_list, Invalid headNode_ptr);
+    }
+    else
+    {
+        numNodes = get_num_cartCoord_nodes(headNode_ptr);
+        retVal = build_swarm_store(numNodes);
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklestore, swarm_from_shawarma_list, build_swarm_store failed);
+        }
+        else
+        {
+            // COPY
+            tmpNode_ptr = headNode_ptr;
+
+            while (tmpNode_ptr)
+            {
+                if (0 > add_swarm_point(retVal, tmpNode_ptr->absX, tmpNode_ptr->absY, tmpNode_ptr->posNum,
+                                        tmpNode_ptr->graphic, tmpNode_ptr->hcFlags))
+                {
+                    HARKLE_ERROR(Harklestore, swarm_from_shawarma_list, add_swarm_point failed);
+                    free_swarm_store(&retVal);
+                    break;
+                }
+
+                tmpNode_ptr = tmpNode_ptr->nextPnt;
+            }
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+hsSwarm_ptr swarm_from_arrays(int numPnts, int *absX, int *absY, int *posNum, char *graphic)
+{
+    // LOCAL VARIABLES
+    hsSwarm_ptr retVal = NULL;  // New swarm store
+    bool success = true;        // Set this to false if anything fails
+    int maxPosNum = 0;          // Largest posNum in posNum
+    int i = 0;                  // Iterating variable
+
+    // INPUT VALIDATION
+    if (1 > numPnts || !absX || !absY || !posNum || !graphic)
+    {
+        HARKLE_ERROR(Harklestore, swarm_from_arrays, Invalid arrays);
+        success = false;
+    }
+    for (i = 0; true == success && i < numPnts; i++)
+    {
+        if (1 > posNum[i])
+        {
+            HARKLE_ERROR(Harklestore, swarm_from_arrays, Invalid posNum);
+            success = false;
+        }
+        else if (posNum[i] > maxPosNum)
+        {
+            maxPosNum = posNum[i];
+        }
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = build_swarm_store(numPnts);
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklestore, swarm_from_arrays, build_swarm_store failed);
+            success = false;
+        }
+        else if (false == grow_pos_index(retVal, maxPosNum))
+        {
+            HARKLE_ERROR(Harklestore, swarm_from_arrays, grow_pos_index failed);
+            success = false;
+        }
+    }
+
+    // COPY
+    if (true == success)
+    {
+        memcpy(retVal->absX, absX, numPnts * sizeof(int));
+        memcpy(retVal->absY, absY, numPnts * sizeof(int));
+        memcpy(retVal->posNum, posNum, numPnts * sizeof(int));
+        memcpy(retVal->graphic, graphic, numPnts * sizeof(char));
+
+        for (i = 0; i < numPnts; i++)
+        {
+            if (-1 != retVal->posIndex[posNum[i]])
+            {
+                HARKLE_ERROR(Harklestore, swarm_from_arrays, Duplicate posNum);
+                success = false;
+                break;
+            }
+
+            retVal->posIndex[posNum[i]] = i;
+        }
+        retVal->numPnts = numPnts;
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        free_swarm_store(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+shawarma_ptr shawarma_list_from_swarm(hsSwarm_ptr swarm_ptr)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;       // Head node of the new linked list
+    shawarma_ptr tailNode_ptr = NULL; // Tail node of the new linked list
+    shawarma_ptr tmpNode_ptr = NULL;  // Newly built node
+    int i = 0;                        // Iterating variable
+
+    // INPUT VALIDATION
+    if (!swarm_ptr || 1 > swarm_ptr->numPnts)
+    {
+        HARKLE_ERROR(Harklestore, shawarma_list_from_swarm, Invalid swarm_ptr);
+    }
+    else
+    {
+        // COPY
+        for (i = 0; i < swarm_ptr->numPnts; i++)
+        {
+            tmpNode_ptr = build_new_shawarma_struct(swarm_ptr->absX[i], swarm_ptr->absY[i], swarm_ptr->posNum[i],
+                                                    swarm_ptr->graphic[i], swarm_ptr->hcFlags[i]);
+
+            if (!tmpNode_ptr)
+            {
+                HARKLE_ERROR(Harklestore, shawarma_list_from_swarm, build_new_shawarma_struct failed);
+                if (retVal)
+                {
+                    free_shawarma_linked_list(&retVal);
+                }
+                break;
+            }
+
+            // Keep a tail pointer instead of walking the list with add_shawarma_node()
+            if (!retVal)
+            {
+                retVal = tmpNode_ptr;
+            }
+            else
+            {
+                tailNode_ptr->nextPnt = tmpNode_ptr;
+            }
+            tailNode_ptr = tmpNode_ptr;
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool sync_shawarma_list(hsSwarm_ptr swarm_ptr, shawarma_ptr headNode_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;             // Set this to false if anything fails
+    shawarma_ptr tmpNode_ptr = NULL;  // Iterating variable
+    int index = 0;                    // Array index of the current node
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harklestore, sync_shawarma_list, Invalid swarm_ptr);
+    }
+    else if (!headNode_ptr)
+    {
+        HARKLE_ERROR(Harklestore, sync_shawarma_list, Invalid headNode_ptr);
+    }
+    else
+    {
+        // SYNC
+        success = true;
+        tmpNode_ptr = headNode_ptr;
+
+        while (tmpNode_ptr)
+        {
+            index = get_swarm_index(swarm_ptr, tmpNode_ptr->posNum);
+
+            if (0 > index)
+            {
+                HARKLE_ERROR(Harklestore, sync_shawarma_list, Node not found in the swarm store);
+                success = false;
+                break;
+            }
+
+            tmpNode_ptr->absX = swarm_ptr->absX[index];
+            tmpNode_ptr->absY = swarm_ptr->absY[index];
+            tmpNode_ptr = tmpNode_ptr->nextPnt;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool free_swarm_store(hsSwarm_ptr *oldSwarm_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;          // Set this to true if the store is freed
+    hsSwarm_ptr swarm_ptr = NULL;  // Local copy of *oldSwarm_ptr
+
+    // INPUT VALIDATION
+    if (!oldSwarm_ptr || !(*oldSwarm_ptr))
+    {
+        HARKLE_ERROR(Harklestore, free_swarm_store, Invalid oldSwarm_ptr);
+    }
+    else
+    {
+        // FREE
+        swarm_ptr = *oldSwarm_ptr;
+
+        if (swarm_ptr->absX)
+        {
+            free(swarm_ptr->absX);
+        }
+        if (swarm_ptr->absY)
+        {
+            free(swarm_ptr->absY);
+        }
+        if (swarm_ptr->posNum)
+        {
+            free(swarm_ptr->posNum);
+        }
+        if (swarm_ptr->graphic)
+        {
+            free(swarm_ptr->graphic);
+        }
+        if (swarm_ptr->hcFlags)
+        {
+            free(swarm_ptr->hcFlags);
+        }
+        if (swarm_ptr->posIndex)
+        {
+            free(swarm_ptr->posIndex);
+        }
+        if (swarm_ptr->occupy_ptr)
+        {
+            free_occupancy_map(&(swarm_ptr->occupy_ptr));
+        }
+
+        memset(swarm_ptr, 0x0, sizeof(hsSwarm));
+        free(swarm_ptr);
+        *oldSwarm_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
@@ -0,0 +1,204 @@
+#ifndef __HARKLESTORE__
+#define __HARKLESTORE__
+
+#include "Harklecurse.h"        // winDetails_ptr, struct hcCartesianCoordinate
+#include "Harkleoccupancy.h"    // hsOccupancy_ptr
+#include "Harkleswarm.h"        // shawarma_ptr
+#include <stdbool.h>            // bool, true, false
+
+// Starting capacity of a swarm store if the caller doesn't have a better guess
+#define HS_STORE_DEFAULT_CAPACITY 64
+
+// Defines the struct that holds a swarm in contiguous, parallel arrays (structure-of-arrays)
+//  Index i of every array describes the same point.  The arrays are dense: [0, numPnts) is in use.
+//  posIndex maps a posNum to its array index so lookup by posNum is O(1).
+//  If occupy_ptr is attached (see: attach_swarm_occupancy()), every add, move and remove keeps it in sync
+//  so coordinate uniqueness and collision checks are O(1) too.
+typedef struct hsSwarmStore
+{
+    int numPnts;              // Number of points currently stored
+    int maxPnts;              // Capacity of each parallel array
+    int *absX;                // X coordinate starting at window's top left
+    int *absY;                // Y coordinate starting at window's top left
+    int *posNum;              // Uniquely number the points with this member
+    char *graphic;            // Character to print at this coordinate
+    unsigned long *hcFlags;   // Implementation-defined coordinate details
+    int maxPosNum;            // Largest posNum posIndex can currently map
+    int *posIndex;            // posIndex[posNum] is the array index of posNum (-1 if unused)
+    hsOccupancy_ptr occupy_ptr;  // Coordinates currently occupied by the swarm (NULL if not attached)
+} hsSwarm, *hsSwarm_ptr;
+
+
+/*
+    PURPOSE - Allocate and initialize an empty swarm store on the heap
+    INPUT
+        maxPnts - Initial capacity of the parallel arrays (If 0, HS_STORE_DEFAULT_CAPACITY is used)
+    OUTPUT
+        On success, pointer to an empty hsSwarm struct on the heap
+        On failure, NULL
+    NOTES
+        The store grows on demand so maxPnts is only a hint
+        It is the caller's responsibility to free the memory with free_swarm_store()
+ */
+hsSwarm_ptr build_swarm_store(int maxPnts);
+
+
+/*
+    PURPOSE - Append a point to a swarm store
+    INPUT
+        swarm_ptr - Pointer to the swarm store to add the point to
+        xVal - Absolute, from the ncurse window's top left, x coordinate of this point
+        yVal - Absolute, from the ncurse window's top left, y coordinate of this point
+        shNum - Identifying number of this point (must be unique and greater than 0)
+        shChar - The character to print at coordinate (xVal, yVal)
+        shStatus - Initial value of the implementation-defined flags available for this point
+    OUTPUT
+        On success, the array index of the new point
+        On failure, -1
+    NOTES
+        If shNum already exists in swarm_ptr, function will fail
+        If swarm_ptr has an occupancy map and (xVal, yVal) is occupied, function will fail
+ */
+int add_swarm_point(hsSwarm_ptr swarm_ptr, int xVal, int yVal, int shNum, char shChar, unsigned long shStatus);
+
+
+/*
+    PURPOSE - Remove a point from a swarm store
+    INPUT
+        swarm_ptr - Pointer to the swarm store to remove the point from
+        shNum - Identifying number of the point to remove
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The last point in the arrays is moved into the removed point's index to keep the arrays dense.
+            Array indices are therefore not stable across removals but posNum values are.
+ */
+bool remove_swarm_point(hsSwarm_ptr swarm_ptr, int shNum);
+
+
+/*
+    PURPOSE - Move a point in a swarm store to new coordinates
+    INPUT
+        swarm_ptr - Pointer to the swarm store holding the point
+        index - Array index of the point to move
+        newX - New absolute x coordinate
+        newY - New absolute y coordinate
+    OUTPUT
+        On success, true
+        On failure, false (and the point has not moved)
+    NOTES
+        If swarm_ptr has an occupancy map, moving onto an occupied coordinate fails.  Engines should move
+            points with this function instead of writing absX and absY directly.
+ */
+bool move_swarm_point(hsSwarm_ptr swarm_ptr, int index, int newX, int newY);
+
+
+/*
+    PURPOSE - Give a swarm store an occupancy map of a field and occupy it with the current swarm
+    INPUT
+        swarm_ptr - Pointer to the swarm store
+        xMin - Smallest x coordinate in the field
+        xMax - Largest x coordinate in the field
+        yMin - Smallest y coordinate in the field
+        yMax - Largest y coordinate in the field
+    OUTPUT
+        On success, true
+        On failure, false (e.g., two points share a coordinate or a point is outside the field)
+    NOTES
+        The store owns the map (see: free_swarm_store()).  Any previously attached map is replaced.
+ */
+bool attach_swarm_occupancy(hsSwarm_ptr swarm_ptr, int xMin, int xMax, int yMin, int yMax);
+
+
+/*
+    PURPOSE - Translate a posNum into its array index within a swarm store
+    INPUT
+        swarm_ptr - Pointer to the swarm store to search
+        shNum - Identifying number of the point
+    OUTPUT
+        On success, the array index of shNum
+        On failure, -1
+    NOTES
+        This is the O(1) replacement for get_pos_num()
+ */
+int get_swarm_index(hsSwarm_ptr swarm_ptr, int shNum);
+
+
+/*
+    PURPOSE - Build a swarm store from an existing linked list of shawarma nodes
+    INPUT
+        headNode_ptr - Pointer to the head node of a linked list of shawarma nodes
+    OUTPUT
+        On success, pointer to a new hsSwarm struct holding a copy of every node, in list order
+        On failure, NULL
+    NOTES
+        headNode_ptr's linked list is not modified
+        It is the caller's responsibility to free the memory with free_swarm_store()
+ */
+hsSwarm_ptr swarm_from_shawarma_list(shawarma_ptr headNode_ptr);
+
+
+/*
+    PURPOSE - Build a swarm store from parallel coordinate arrays (e.g., a mapped snapshot)
+    INPUT
+        numPnts - Number of points
+        absX - numPnts x coordinates
+        absY - numPnts y coordinates
+        posNum - numPnts posNums (each unique and greater than 0)
+        graphic - numPnts characters to print at each point
+    OUTPUT
+        On success, pointer to a new hsSwarm struct holding a copy of every point, in array order
+        On failure, NULL
+    NOTES
+        Each array is copied in one block instead of one add_swarm_point() per point
+        Every point's hcFlags start at 0
+        It is the caller's responsibility to free the memory with free_swarm_store()
+ */
+hsSwarm_ptr swarm_from_arrays(int numPnts, int *absX, int *absY, int *posNum, char *graphic);
+
+
+/*
+    PURPOSE - Build a linked list of shawarma nodes from a swarm store (e.g., for print_plot_list())
+    INPUT
+        swarm_ptr - Pointer to the swarm store to copy
+    OUTPUT
+        On success, pointer to the head node of a new linked list holding a copy of every point, in array order
+        On failure, NULL
+    NOTES
+        It is the caller's responsibility to free the memory with free_shawarma_linked_list()
+ */
+shawarma_ptr shawarma_list_from_swarm(hsSwarm_ptr swarm_ptr);
+
+
+/*
+    PURPOSE - Copy the current coordinates from a swarm store into an existing linked list of shawarma nodes
+    INPUT
+        swarm_ptr - Pointer to the swarm store to copy from
+        headNode_ptr - Pointer to the head node of a linked list of shawarma nodes to update
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Nodes are matched by posNum.  Every node in headNode_ptr's linked list must exist in swarm_ptr.
+        Use this to refresh a rendering list once per cycle without reallocating it.
+ */
+bool sync_shawarma_list(hsSwarm_ptr swarm_ptr, shawarma_ptr headNode_ptr);
+
+
+/*
+    PURPOSE - Free the heap-allocated memory associated with a swarm store
+    INPUT
+        oldSwarm_ptr - A pointer to a heap-allocated hsSwarm struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This function will attempt to zeroize and free the memory at *oldSwarm_ptr, and every array
+            (and occupancy map) it owns.  It will also set the original pointer to NULL.  Call this function as
+            free_swarm_store(&mySwarm_ptr);
+ */
+bool free_swarm_store(hsSwarm_ptr *oldSwarm_ptr);
+
+
+#endif  // __HARKLESTORE__
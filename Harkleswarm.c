@@ -1,14 +1,22 @@
 #include "Harklecurse.h"
 #include "Harklemath.h"         // dble_greater_than()
 #include "Harklerror.h"         // HARKLE_ERROR
+#include "Harklegeom.h"         // are_int_points_collinear(), calc_int_gcd(), project_int_lattice()
+#include "Harkleoccupancy.h"    // build_occupancy_map(), is_coordinate_occupied(), occupy_coordinate()
 #include "Harkleswarm.h"
 #include "Randoroad.h"          // rando_me()
-#include <stdlib.h>             // abs()
+#include <math.h>               // sqrt()
+#include <stdlib.h>             // abs(), calloc(), free()
+#include <string.h>             // memset()
 
-#ifndef HARKLESWARM_MAX_TRIES
-// MACRO to limit repeated search attempts
-#define HARKLESWARM_MAX_TRIES 30
-#endif  // HARKLESWARM_MAX_TRIES
+// rando_me() covers [0, HS_RANDO_INDEX_SPAN) in one call (see: rando_cell_index())
+#define HS_RANDO_INDEX_SPAN 0x40000000LL
+
+// Local functions used before they're defined
+int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr extraHead_ptr,
+                                shawarma_ptr sourceNode_ptr, hsLineLen_ptr* coord_arr);
+int find_closest_two_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr extraHead_ptr,
+                                shawarma_ptr sourceNode_ptr, hsLineLen_ptr* coord_arr);
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +242,149 @@ bool find_longest_entry(hsLineLen_ptr* coord_arr, hsLineLen_ptr outNode_ptr, int
 }
 
 
+/*
+    PURPOSE - Calculate the line intercepts of headNode_ptr's linked list into two caller-provided nodes
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine window border points)
+        headNode_ptr - Pointer to the head node of a linked list of at least two shawarma nodes forming a line
+        intNode_arr - Array of two shawarma structs to store the intercepts in
+    OUTPUT
+        On success, true (and intNode_arr[0] is the head node of a two-node linked list of intercepts)
+        On failure, false
+    NOTES
+        This function neither allocates nor frees anything so the intercepts may live on the caller's stack
+        The nodes will be 'zeroized' before use.  Specifically, posNum and graphic will both be 0x0.
+        This function does not verify the line.  It is assumed that the calling function already did.
+ */
+bool calc_one_dim_intercept_nodes(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma intNode_arr[2])
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Indicates function success
+
+    // SETUP
+    memset(intNode_arr, 0x0, 2 * sizeof(shawarma));
+    intNode_arr[0].nextPnt = &(intNode_arr[1]);
+
+    // CALCULATE LINE INTERCEPTS
+    // Vertical line
+    if (headNode_ptr->absX == headNode_ptr->nextPnt->absX)
+    {
+        // Top intercept
+        intNode_arr[0].absX = headNode_ptr->absX;
+        intNode_arr[0].absY = curWindow->upperR;
+        // Bottom intercept
+        intNode_arr[1].absX = headNode_ptr->absX;
+        intNode_arr[1].absY = curWindow->upperR + curWindow->nRows - 1;
+    }
+    else
+    {
+        success = calculate_line_intercepts(curWindow, headNode_ptr, intNode_arr,
+                                            headNode_ptr->nextPnt->absX - headNode_ptr->absX,
+                                            headNode_ptr->nextPnt->absY - headNode_ptr->absY);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkleswarm, calc_one_dim_intercept_nodes, calculate_line_intercepts failed);
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Update the coordinates of node_ptr so that it is 'maxMoves' closer to dstCoord_ptr's coordinates
+        without leaving the line headNode_ptr's linked list lies on
+    INPUT
+        headNode_ptr - Pointer to the head node of a linked list of at least two shawarma nodes forming a line
+        node_ptr - The coordinates to update (must lie on the line)
+        dstCoord_ptr - The destination coordinates (need not lie on the line)
+        maxMoves - Maximum number of moves to make
+    OUTPUT
+        On success, number of moves made (0 counts as success)
+        On failure, -1
+    NOTES
+        This replaces move_shawarma() in one dimension.  move_shawarma() steps x and y independently, which
+            can leave the line on anything but horizontal, vertical and diagonal lines.  This function snaps
+            the destination to the line's integer lattice and only steps between lattice points.
+        A step costs abs(stepX) + abs(stepY) moves but at least one step is always allowed (see:
+            calc_line_step())
+ */
+int move_shawarma_on_line(shawarma_ptr headNode_ptr, shawarma_ptr node_ptr, hsLineLen_ptr dstCoord_ptr, int maxMoves)
+{
+    // LOCAL VARIABLES
+    int numMoves = -1;    // Number of moves made
+    int stepX = 0;        // X component of the line's smallest integer step
+    int stepY = 0;        // Y component of the line's smallest integer step
+    int stepGcd = 0;      // Greatest common divisor of the step's components
+    int stepCost = 0;     // Moves per step along the line
+    int curT = 0;         // Current lattice step
+    int numSteps = 0;     // Lattice steps to take
+    int maxSteps = 0;     // Lattice steps allowed
+
+    // INPUT VALIDATION
+    if (!headNode_ptr || !(headNode_ptr->nextPnt))
+    {
+        HARKLE_ERROR(Harkleswarm, move_shawarma_on_line, Too few points to determine direction);
+    }
+    else if (!node_ptr)
+    {
+        HARKLE_ERROR(Harkleswarm, move_shawarma_on_line, Invalid node_ptr);
+    }
+    else if (!dstCoord_ptr)
+    {
+        HARKLE_ERROR(Harkleswarm, move_shawarma_on_line, Invalid dstCoord_ptr);
+    }
+    else if (1 > maxMoves)
+    {
+        HARKLE_ERROR(Harkleswarm, move_shawarma_on_line, Invalid number of moves);
+    }
+    else if (headNode_ptr->absX == headNode_ptr->nextPnt->absX && headNode_ptr->absY == headNode_ptr->nextPnt->absY)
+    {
+        HARKLE_ERROR(Harkleswarm, move_shawarma_on_line, The first two points share a coordinate);
+    }
+    else
+    {
+        // DETERMINE STEP
+        stepX = headNode_ptr->nextPnt->absX - headNode_ptr->absX;
+        stepY = headNode_ptr->nextPnt->absY - headNode_ptr->absY;
+        stepGcd = calc_int_gcd(stepX, stepY);
+        stepX /= stepGcd;
+        stepY /= stepGcd;
+        stepCost = abs(stepX) + abs(stepY);
+
+        // MOVE IT
+        curT = project_int_lattice(headNode_ptr->absX, headNode_ptr->absY, stepX, stepY,
+                                   node_ptr->absX, node_ptr->absY);
+        numSteps = project_int_lattice(headNode_ptr->absX, headNode_ptr->absY, stepX, stepY,
+                                       dstCoord_ptr->xCoord, dstCoord_ptr->yCoord) - curT;
+        maxSteps = (maxMoves / stepCost > 0) ? maxMoves / stepCost : 1;
+
+        if (numSteps > maxSteps)
+        {
+            numSteps = maxSteps;
+        }
+        else if (numSteps < -maxSteps)
+        {
+            numSteps = -maxSteps;
+        }
+
+        node_ptr->absX = headNode_ptr->absX + ((curT + numSteps) * stepX);
+        node_ptr->absY = headNode_ptr->absY + ((curT + numSteps) * stepY);
+        numMoves = abs(numSteps) * stepCost;
+
+        if (numMoves > maxMoves)
+        {
+            numMoves = maxMoves;
+        }
+    }
+
+    // DONE
+    return numMoves;
+}
+
+
 /*
     PURPOSE - Update the coordiantes of shawarma node sourceNode_ptr by moving it 'maxMoves' toward equilibrium in
         one (1) dimension
@@ -255,37 +406,30 @@ int shwarm_one_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma
     // LOCAL VARIABLES
     int numMoves = -1;     // Number of moves made
     bool success = true;   // Prove this wrong
-    double slope = 0.0;    // Store slope here
     int numClosePnts = 0;  // Number of points that find_closest_points() found
-    shawarma_ptr intNode_ptr = NULL;   // Head node for the intercept head node pointer
-    shawarma_ptr tmpNode_ptr = NULL;   // Iterating variable
+    shawarma_ptr intNode_ptr = NULL;   // Head node of the intercept 'linked list' (if any)
+    shawarma intNode_arr[2];           // Stack storage for the two line intercepts
     hsLineLen point1 = { 0, 0, 0.0 };  // Out parameter for find_closest_points()
     hsLineLen point2 = { 0, 0, 0.0 };  // Out parameter for find_closest_points()
     hsLineLen midPnt = { 0, 0, 0.0 };  // Out parameter for determine_mid_point()
     hsLineLen_ptr coord_arr[] = { &point1, &point2, NULL };
 
     // SWARM
-    // 1. Verify minimum number of points (need two to get a slope)
+    // 1. Verify minimum number of points (need two to get a direction)
     if (true == success)
     {
-        if (2 > get_num_cartCoord_nodes(headNode_ptr))
+        if (!(headNode_ptr->nextPnt))
         {
-            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, Too few points to determine slope);
+            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, Too few points to determine direction);
             success = false;
         }
     }
 
-    // 2. Calculate slope
-    if (true == success)
-    {
-        slope = calc_int_point_slope(headNode_ptr->absX, headNode_ptr->absY,
-                                     headNode_ptr->nextPnt->absX, headNode_ptr->nextPnt->absY);
-    }
-
-    // 3. Verify line
+#ifdef HS_DEBUG_VERIFY_LINE
+    // 2. Verify line (O(n) per call so this is a debug-only check.  See: HS_DEBUG_VERIFY_LINE.)
     if (true == success)
     {
-        success = verify_line(headNode_ptr, slope, HS_MAX_SLOPE_PRECISION);
+        success = verify_line(headNode_ptr);
 
         if (false == success)
         {
@@ -293,36 +437,34 @@ int shwarm_one_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma
             print_debug_info(NULL, curWindow, headNode_ptr);  // DEBUGGING
         }
     }
+#endif  // HS_DEBUG_VERIFY_LINE
 
-    // 4. Consider intercepts
+    // 3. Consider intercepts
     if (true == success && true == intercepts)
     {
-        success = calculate_intercepts(curWindow, headNode_ptr, sourceNode_ptr, &intNode_ptr, 1);
+        // The intercepts live on the stack and are searched alongside, not spliced into, the caller's list
+        success = calc_one_dim_intercept_nodes(curWindow, headNode_ptr, intNode_arr);
 
         if (false == success)
         {
-            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, calculate_intercepts failed);
-        }
-        else if (headNode_ptr != add_cartCoord_node(headNode_ptr, intNode_ptr, 0))
-        {
-            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, Failed to add intercept nodes to the tail node);
-            success = false;
+            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, calc_one_dim_intercept_nodes failed);
         }
         else
         {
+            intNode_ptr = intNode_arr;
             // fprintf(stderr, "In shwarm_one_dim()\n");  // DEBUGGING
             // print_debug_info(curWindow, curWindow, intNode_ptr);  // DEBUGGING
         }
     }
 
-    // 5. Find closest points
+    // 4. Find closest points
     if (true == success)
     {
         // printf("BEFORE\n");  // DEBUGGING
         // printf("Source_ptr (x, y) == (%d, %d)\n", sourceNode_ptr->absX, sourceNode_ptr->absY); // DEBUGGING
         // printf("Point 1 (x, y) == (%d, %d)\n", point1.xCoord, point1.yCoord);  // DEBUGGING
         // printf("Point 2 (x, y) == (%d, %d)\n", point2.xCoord, point2.yCoord);  // DEBUGGING
-        numClosePnts = find_closest_points(curWindow, headNode_ptr, sourceNode_ptr, coord_arr);
+        numClosePnts = find_closest_one_dim_points(curWindow, headNode_ptr, intNode_ptr, sourceNode_ptr, coord_arr);
         // printf("AFTER\n");  // DEBUGGING
         // printf("Source_ptr (x, y) == (%d, %d)\n", sourceNode_ptr->absX, sourceNode_ptr->absY); // DEBUGGING
         // printf("Point 1 (x, y) == (%d, %d)\n", point1.xCoord, point1.yCoord);  // DEBUGGING
@@ -331,17 +473,17 @@ int shwarm_one_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma
         // One dimension should find two points (dim + 1)
         if (-1 == numClosePnts)
         {
-            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, find_closest_points encountered an error);
+            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, find_closest_one_dim_points encountered an error);
             success = false;
         }
         else if (2 < numClosePnts)
         {
-            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, find_closest_points found an invalid number of points);
+            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, find_closest_one_dim_points found an invalid number of points);
             success = false;
         }
     }
 
-    // 6. Calculate center (as long as we're not on the end)
+    // 5. Calculate center (as long as we're not on the end)
     if (true == success && 1 < numClosePnts)
     {
         success = determine_mid_point(&point1, &point2, &midPnt, 0);
@@ -352,8 +494,8 @@ int shwarm_one_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma
         }
     }
 
-    // 7. Clear the old point before the move (as long as we're not on the end)
-    if (true == success && 1 < numClosePnts)
+    // 6. Clear the old point before the move (as long as we're not on the end and there's a window to clear)
+    if (true == success && 1 < numClosePnts && curWindow->win_ptr)
     {
         // Clear the old point
         success = clear_this_coord(curWindow, sourceNode_ptr);
@@ -364,14 +506,14 @@ int shwarm_one_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma
         }
     }
 
-    // 8. Move the point closer (as long as we're not on the end)
+    // 7. Move the point closer along the line (as long as we're not on the end)
     if (true == success && 1 < numClosePnts)
     {
-        numMoves = move_shawarma(sourceNode_ptr, &midPnt, maxMoves);
+        numMoves = move_shawarma_on_line(headNode_ptr, sourceNode_ptr, &midPnt, maxMoves);
 
         if (0 > numMoves)
         {
-            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, move_shawarma failed);
+            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, move_shawarma_on_line failed);
             success = false;
         }
     }
@@ -383,36 +525,6 @@ int shwarm_one_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma
         // Found the end of the line and didn't move it
         numMoves = 0;
     }
-    // Remove intercept nodes (if applicable)
-    if (intNode_ptr)
-    {
-        tmpNode_ptr = headNode_ptr;
-
-        while (tmpNode_ptr)
-        {
-            if (tmpNode_ptr->nextPnt == intNode_ptr)
-            {
-                if (false == free_shawarma_linked_list(&(tmpNode_ptr->nextPnt)))
-                {
-                    HARKLE_ERROR(Harkleswarm, shwarm_one_dim, free_shawarma_linked_list failed);
-                    success = false;
-                }
-                else
-                {
-                    intNode_ptr = NULL;
-                    break;
-                }
-            }
-
-            tmpNode_ptr = tmpNode_ptr->nextPnt;
-        }
-
-        if (intNode_ptr)
-        {
-            HARKLE_ERROR(Harkleswarm, shwarm_one_dim, Failed to free the intercept linked list);
-            success = false;
-        }
-    }
 
     return numMoves;
 }
@@ -424,6 +536,8 @@ int shwarm_one_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma
     INPUT
         curWindow - Pointer to a winDetails struct (used to determine window border points)
         headNode_ptr - Pointer to the head node of a linked list of shawarma pointers containing available points
+        extraHead_ptr - [Optional] Pointer to the head node of a second linked list of available points
+            (e.g., line intercepts) to search after headNode_ptr's linked list
         sourceNode_ptr - shawarma struct pointer to use as the 'origin' point to calculate distances
         coord_arr - NULL-terminated array of two hsLineLen struct pointers to use as 'out' parameters
     OUTPUT
@@ -440,7 +554,8 @@ int shwarm_one_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma
         ONCE THIS FUNCTION IS OPERATING, STRONGLY CONSIDER REFACTORING TO REDUCT DUPLICATE CODE BLOCKS.  FOR INSTANCE, CONSIDER
             MAKING A hsLineLen_ptr* curLen_arr THAT MIRRORS coord_arr TO SAVE SOME SPECIAL-CASE BRANCHING WITHIN if(true == saveIt).
  */
-int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr sourceNode_ptr, hsLineLen_ptr* coord_arr)
+int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr extraHead_ptr,
+                                shawarma_ptr sourceNode_ptr, hsLineLen_ptr* coord_arr)
 {
     // LOCAL VARIABLES
     int numPoints = -1;                // Should wind up to be 2 unless sourceNode_ptr is an end point
@@ -450,20 +565,18 @@ int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_
     bool emptyIndex1 = true;           // Indicates coord_arr[1] is empty
     bool saveIt = false;               // Avoiding "save this point" duplicate code
     int index = 0;                     // coord_arr index to "saveIt"
+    bool inExtra = false;              // Set to true once tmpNode_ptr has moved on to extraHead_ptr's list
     shawarma_ptr tmpNode_ptr = NULL;   // Iterating variable for the 'in' linked list
     int tmpVertDist = 0;               // Use this to calculate distance for the special-cased vertical line
     int vertIndex0Dist = 0;            // Holds the absolute vertical distance of coord_arr[0] for the special-cased vertical line
     int vertIndex1Dist = 0;            // Holds the absolute vertical distance of coord_arr[1] for the special-cased vertical line
-    // Use this as a temp 'out' parameter for calc_hsLineLen_contents()
-    hsLineLen localLineLen = { 0, 0, 0.0 };
-    // Use this to store the current value of the point in coord_arr[0]
-    hsLineLen bigIndex0LineLen = { 0, 0, 0.0 };
-    // Use this to store the current value of the point in coord_arr[1]
-    hsLineLen bigIndex1LineLen = { 0, 0, 0.0 };
+    long long tmpSqDist = 0;           // Squared distance from sourceNode_ptr to tmpNode_ptr
+    long long index0SqDist = 0;        // Squared distance of the point in coord_arr[0]
+    long long index1SqDist = 0;        // Squared distance of the point in coord_arr[1]
 
     // FIND POINTS
     // Verify minimum number of nodes exist
-    if (2 > (get_num_cartCoord_nodes(headNode_ptr) - 1))
+    if (2 > (get_num_cartCoord_nodes(headNode_ptr) + get_num_cartCoord_nodes(extraHead_ptr) - 1))
     {
         HARKLE_ERROR(Harkleswarm, find_closest_one_dim_points, Not enough coord_arr entries);
     }
@@ -516,15 +629,11 @@ int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_
                         }
                         else
                         {
-                            // Determine if this is closer than index 0
-                            success = calc_hsLineLen_contents(sourceNode_ptr, tmpNode_ptr, &localLineLen);
+                            // Determine if this is closer than index 0 (squared distances compare the same way)
+                            tmpSqDist = calc_int_point_sq_dist(sourceNode_ptr->absX, sourceNode_ptr->absY,
+                                                               tmpNode_ptr->absX, tmpNode_ptr->absY);
 
-                            if (false == success)
-                            {
-                                HARKLE_ERROR(Harkleswarm, find_closest_one_dim_points, calc_hsLineLen_contents failed);
-                                numPoints = -1;
-                            }
-                            else if (true == dble_less_than(localLineLen.dist, bigIndex0LineLen.dist, DBL_PRECISION))
+                            if (tmpSqDist < index0SqDist)
                             {
                                 saveIt = true;  // Save tmpNode_ptr to coord_arr
                                 index = 0;  // Store it in coord_arr[0]
@@ -543,22 +652,19 @@ int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_
                         }
                         else
                         {
-                            // Determine if this is closer than index 0
-                            success = calc_hsLineLen_contents(sourceNode_ptr, tmpNode_ptr, &localLineLen);
+                            // Determine if this is closer than index 1 (squared distances compare the same way)
+                            tmpSqDist = calc_int_point_sq_dist(sourceNode_ptr->absX, sourceNode_ptr->absY,
+                                                               tmpNode_ptr->absX, tmpNode_ptr->absY);
 
-                            if (false == success)
-                            {
-                                HARKLE_ERROR(Harkleswarm, find_closest_one_dim_points, calc_hsLineLen_contents failed);
-                                numPoints = -1;
-                            }
-                            else if (true == dble_less_than(localLineLen.dist, bigIndex1LineLen.dist, DBL_PRECISION))
+                            if (tmpSqDist < index1SqDist)
                             {
                                 saveIt = true;  // Save tmpNode_ptr to coord_arr
                                 index = 1;  // Store it in coord_arr[1]
                             }
                         }
                     }
-                    else
+                    // A point sitting on a line intercept ignores that intercept
+                    else if (false == inExtra)
                     {
                         HARKLE_ERROR(Harkleswarm, find_closest_one_dim_points, Line is non-vertical but found duplicate x coordinates);
                         fprintf(stderr, "Source (x, y) == (%d, %d) and tmpNode (x, y) == (%d, %d)\n", sourceNode_ptr->absX, sourceNode_ptr->absY, tmpNode_ptr->absX, tmpNode_ptr->absY);  // DEBUGGING
@@ -611,7 +717,8 @@ int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_
                             }
                         }
                     }
-                    else
+                    // A point sitting on a line intercept ignores that intercept
+                    else if (false == inExtra)
                     {
                         HARKLE_ERROR(Harkleswarm, find_closest_one_dim_points, Line is vertical but found duplicate y coordinates);
                         // fprintf(stderr, "Source (x, y) == (%d, %d) and tmpNode (x, y) == (%d, %d)\n", sourceNode_ptr->absX, sourceNode_ptr->absY, tmpNode_ptr->absX, tmpNode_ptr->absY);  // DEBUGGING
@@ -631,20 +738,25 @@ int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_
                     }
                     else if (true == srchHoriz && 0 == index)
                     {
-                        bigIndex0LineLen.xCoord = coord_arr[index]->xCoord;
-                        bigIndex0LineLen.yCoord = coord_arr[index]->yCoord;
-                        bigIndex0LineLen.dist = coord_arr[index]->dist;
+                        index0SqDist = calc_int_point_sq_dist(sourceNode_ptr->absX, sourceNode_ptr->absY,
+                                                              tmpNode_ptr->absX, tmpNode_ptr->absY);
                     }
                     else if (true == srchHoriz && 1 == index)
                     {
-                        bigIndex1LineLen.xCoord = coord_arr[index]->xCoord;
-                        bigIndex1LineLen.yCoord = coord_arr[index]->yCoord;
-                        bigIndex1LineLen.dist = coord_arr[index]->dist;
+                        index1SqDist = calc_int_point_sq_dist(sourceNode_ptr->absX, sourceNode_ptr->absY,
+                                                              tmpNode_ptr->absX, tmpNode_ptr->absY);
                     }
                 }
             }
 
             tmpNode_ptr = tmpNode_ptr->nextPnt;  // Next node
+
+            // Continue into the extra list
+            if (!tmpNode_ptr && extraHead_ptr && false == inExtra)
+            {
+                tmpNode_ptr = extraHead_ptr;
+                inExtra = true;
+            }
         }
     }
 
@@ -670,9 +782,9 @@ bool calculate_intercepts_one_dim(winDetails_ptr curWindow, shawarma_ptr headNod
 {
     // LOCAL VARIABLES
     bool success = true;  // Indicates function success
-    double slope = 0.0;   // Calculated slope of the line formed by the linked list at headNode_ptr
     shawarma_ptr intHeadNode_ptr = NULL;  // Allocate the new 'intercepts' head node pointer here
     shawarma_ptr tmpNode_ptr = NULL;      // Temporary shawarma pointer variable
+    shawarma intNode_arr[2];              // Intercepts calculated by calc_one_dim_intercept_nodes()
 
     // INPUT VALIDATION
     if (2 > get_num_cartCoord_nodes(headNode_ptr))
@@ -684,12 +796,8 @@ bool calculate_intercepts_one_dim(winDetails_ptr curWindow, shawarma_ptr headNod
     // CALCULATE INTERCEPTS
     if (true == success)
     {
-        // 1. Calcualte the slope
-        slope = calc_int_point_slope(headNode_ptr->absX, headNode_ptr->absY,
-                                     headNode_ptr->nextPnt->absX, headNode_ptr->nextPnt->absY);
-
-        // 2. Verify line
-        success = verify_line(headNode_ptr, slope, DBL_PRECISION);
+        // 1. Verify line
+        success = verify_line(headNode_ptr);
 
         if (false == success)
         {
@@ -697,7 +805,7 @@ bool calculate_intercepts_one_dim(winDetails_ptr curWindow, shawarma_ptr headNod
         }
     }
 
-    // 3. Allocate nodes
+    // 2. Allocate nodes
     if (true == success)
     {
         // Head node
@@ -739,28 +847,22 @@ bool calculate_intercepts_one_dim(winDetails_ptr curWindow, shawarma_ptr headNod
         }
     }
 
-    // 4. Calculate line intercepts
+    // 3. Calculate line intercepts
     if (true == success)
     {
-        // Vertical line
-        if (headNode_ptr->absX == headNode_ptr->nextPnt->absX)
+        success = calc_one_dim_intercept_nodes(curWindow, headNode_ptr, intNode_arr);
+
+        if (false == success)
         {
-            // Top intercept
-            intHeadNode_ptr->absX = headNode_ptr->absX;
-            intHeadNode_ptr->absY = curWindow->upperR;
-            // Bottom intercept
-            intHeadNode_ptr->nextPnt->absX = headNode_ptr->absX;
-            intHeadNode_ptr->nextPnt->absY = curWindow ->upperR + curWindow->nRows - 1;
-            // print_debug_info(curWindow, curWindow, intHeadNode_ptr);  // DEBUGGING
+            HARKLE_ERROR(Harkleswarm, calculate_intercepts_one_dim, calc_one_dim_intercept_nodes failed);
         }
         else
         {
-            success = calculate_line_intercepts(curWindow, headNode_ptr, intHeadNode_ptr, slope);
-
-            if (false == success)
-            {
-                HARKLE_ERROR(Harkleswarm, calculate_intercepts_one_dim, calculate_line_intercepts failed);
-            }
+            intHeadNode_ptr->absX = intNode_arr[0].absX;
+            intHeadNode_ptr->absY = intNode_arr[0].absY;
+            intHeadNode_ptr->nextPnt->absX = intNode_arr[1].absX;
+            intHeadNode_ptr->nextPnt->absY = intNode_arr[1].absY;
+            // print_debug_info(curWindow, curWindow, intHeadNode_ptr);  // DEBUGGING
         }
     }
 
@@ -786,173 +888,683 @@ bool calculate_intercepts_one_dim(winDetails_ptr curWindow, shawarma_ptr headNod
 }
 
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////////
+/*
+    PURPOSE - Find the three points closest to sourceNode_ptr, counting the field's walls if asked to
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine the field's walls)
+        headNode_ptr - Pointer to the head node of a linked list of shawarma pointers containing available points
+        sourceNode_ptr - shawarma struct pointer to use as the 'origin' point to calculate distances
+        intercepts - If true, the field's walls will be treated as points
+        coord_arr - NULL-terminated array of three hsLineLen struct pointers to use as 'out' parameters
+    OUTPUT
+        On success, number of hsLineLen struct pointers populated, closest first
+        On error, -1
+    NOTES
+        This function does not perform input validation
+ */
+int find_two_dim_neighbours(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr sourceNode_ptr,
+                            bool intercepts, hsLineLen_ptr* coord_arr)
+{
+    // LOCAL VARIABLES
+    int numPoints = -1;                // Number of points found
+    bool success = true;               // Set this to false if anything fails
+    int i = 0;                         // Iterating variable
+    shawarma_ptr wallNode_ptr = NULL;  // Head node of the wall 'linked list' (if any)
+    shawarma wallNode_arr[4];          // Stack storage for the four wall points
+    hsLineLen wall_arr[4];             // Out parameter for calc_two_dim_wall_points()
 
+    // 1. Consider the walls
+    if (true == intercepts)
+    {
+        // The walls live on the stack and are searched alongside, not spliced into, the caller's list
+        success = calc_two_dim_wall_points(curWindow, sourceNode_ptr->absX, sourceNode_ptr->absY, wall_arr);
 
-shawarma_ptr alloc_shawarma_struct(void)
-{
-    return allocate_cartCoord_struct();
-}
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkleswarm, find_two_dim_neighbours, calc_two_dim_wall_points failed);
+        }
+        else
+        {
+            memset(wallNode_arr, 0x0, sizeof(wallNode_arr));
 
+            for (i = 0; i < 4; i++)
+            {
+                wallNode_arr[i].absX = wall_arr[i].xCoord;
+                wallNode_arr[i].absY = wall_arr[i].yCoord;
+                wallNode_arr[i].nextPnt = (i < 3) ? &(wallNode_arr[i + 1]) : NULL;
+            }
 
-shawarma_ptr build_new_shawarma_struct(int xVal, int yVal, int shNum, char shChar, unsigned long shStatus)
-{
-    // LOCAL VARIABLES
-    shawarma_ptr retVal = NULL;
-    
-    // ALLOCATE & BUILD
-    retVal = build_new_cartCoord_struct(xVal, yVal, shChar, shStatus);
-    
-    // UPDATE
-    if (retVal)
-    {
-        retVal->posNum = shNum;
+            wallNode_ptr = wallNode_arr;
+        }
     }
-    else
+
+    // 2. Find closest points
+    if (true == success)
     {
-        HARKLE_ERROR(Harkleswarm, build_new_shawarma_struct, build_new_cartCoord_struct failed);
+        numPoints = find_closest_two_dim_points(curWindow, headNode_ptr, wallNode_ptr, sourceNode_ptr, coord_arr);
+
+        if (-1 == numPoints)
+        {
+            HARKLE_ERROR(Harkleswarm, find_two_dim_neighbours, find_closest_two_dim_points encountered an error);
+        }
     }
-    
+
     // DONE
-    return retVal;
+    return numPoints;
 }
 
 
-shawarma_ptr add_shawarma_node(shawarma_ptr headShawarma, shawarma_ptr newShawarma, int newPos)
+/*
+    PURPOSE - Move sourceNode_ptr 'maxMoves' toward equilibrium with its three closest points
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to determine the field's walls)
+        headNode_ptr - Pointer to the head node of a linked list of shawarma pointers containing available points
+        sourceNode_ptr - shawarma struct pointer to move
+        maxMoves - Number of one-dimensional moves the node may move to pursue equilibrium
+        intercepts - If true, the field's walls will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, number of moves made (not to exceed maxMoves).  0 indicates success (and also equilibrium).
+        On failure, -1
+    NOTES
+        The point moves toward the point equidistant from its three closest points (see:
+            determine_triangulation_point()) one move_shawarma() step at a time and stops short of any
+            occupied coordinate.  The move is only kept if is_triangulation_improved() agrees.
+        This function does not perform input validation.  It assumes the calling function has already validated
+            the parameter being passed in.
+ */
+int shwarm_two_dim(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr sourceNode_ptr, int maxMoves, bool intercepts)
 {
-    return add_cartCoord_node(headShawarma, newShawarma, newPos);
-}
+    // LOCAL VARIABLES
+    int numMoves = -1;                 // Number of moves made
+    bool success = true;               // Prove this wrong
+    int numClosePnts = 0;              // Number of points that find_two_dim_neighbours() found
+    int newClosePnts = 0;              // Number of points that find_two_dim_neighbours() found after the move
+    shawarma oldNode;                  // The point before its move
+    shawarma stepNode;                 // The point after its last unblocked step
+    shawarma tmpNode;                  // The point after its next step
+    hsLineLen point1 = { 0, 0, 0.0 };  // Out parameter for find_two_dim_neighbours()
+    hsLineLen point2 = { 0, 0, 0.0 };  // Out parameter for find_two_dim_neighbours()
+    hsLineLen point3 = { 0, 0, 0.0 };  // Out parameter for find_two_dim_neighbours()
+    hsLineLen newPoint1 = { 0, 0, 0.0 };  // Out parameter for find_two_dim_neighbours() after the move
+    hsLineLen newPoint2 = { 0, 0, 0.0 };  // Out parameter for find_two_dim_neighbours() after the move
+    hsLineLen newPoint3 = { 0, 0, 0.0 };  // Out parameter for find_two_dim_neighbours() after the move
+    hsLineLen target = { 0, 0, 0.0 };  // Out parameter for determine_triangulation_point()
+    hsLineLen_ptr coord_arr[] = { &point1, &point2, &point3, NULL };
+    hsLineLen_ptr newCoord_arr[] = { &newPoint1, &newPoint2, &newPoint3, NULL };
 
+    // SWARM
+    // 1. Find closest points
+    numClosePnts = find_two_dim_neighbours(curWindow, headNode_ptr, sourceNode_ptr, intercepts, coord_arr);
 
-shawarma_ptr create_shawarma_list(int xMin, int xMax, int yMin, int yMax, int listLen, char shChar, unsigned long shStatus)
-{
-    // LOCAL VARIABLES
-    shawarma_ptr retVal = NULL;       // Store the head node to the new linked list here
-    shawarma_ptr tmp_ptr = NULL;      // Temp storage for newly built child nodes
-    shawarma_ptr tmpHead_ptr = NULL;  // Temp storage for newly built child nodes
-    bool success = true;              // Set this to false if anything fails
-    char localShChar = shChar;        // Level of indirection for the struct graphic member
-    int i = 0;                        // Iterating variable
-    hsLineLen newCoord = {0, 0, 0};   // Temp struct to use as 'out' parameter for rando_unique_coordinates() 
-    
-    // INPUT VALIDATION
-    if (xMin > xMax)
-    {
-        HARKLE_ERROR(Harkleswarm, create_shawarma_list, Invalid x coordinate min and max);
-        success = false;
-    }
-    else if (yMin > yMax)
+    if (-1 == numClosePnts)
     {
-        HARKLE_ERROR(Harkleswarm, create_shawarma_list, Invalid y coordinate min and max);
+        HARKLE_ERROR(Harkleswarm, shwarm_two_dim, find_two_dim_neighbours encountered an error);
         success = false;
     }
-    else if (listLen < 1)
+
+    // 2. Calculate the target (as long as the point is pinned by three others)
+    if (true == success && 3 == numClosePnts)
     {
-        HARKLE_ERROR(Harkleswarm, create_shawarma_list, Invalid list length);
-        success = false;
+        success = determine_triangulation_point(curWindow, coord_arr, &target);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkleswarm, shwarm_two_dim, determine_triangulation_point failed);
+        }
     }
-    
-    // ALLOCATE NODES
+
+    // 3. Step toward the target until it's reached, or blocked
     if (true == success)
     {
-        for (i = 1; i <= listLen; i++)
+        numMoves = 0;
+        oldNode = *sourceNode_ptr;
+        stepNode = *sourceNode_ptr;
+
+        while (3 == numClosePnts && numMoves < maxMoves)
         {
-            // Determine character value
-            if (0 == shChar)
-            {
-                localShChar = i + 48;
-            }
-            
-            // First node
-            if (!retVal)
-            {
-                // puts("Making head node");  // DEBUGGING
-                newCoord.xCoord = rando_me(xMin, xMax);
-                newCoord.yCoord = rando_me(yMin, yMax);
-                retVal = build_new_shawarma_struct(newCoord.xCoord, newCoord.yCoord, i, localShChar, shStatus);
-                if (!retVal)
-                {
-                    HARKLE_ERROR(Harkleswarm, create_shawarma_list, build_new_shawarma_struct failed);
-                    success = false;
-                }
-            }
-            // Additional node
-            else
-            {
-                // puts("Making child node");  // DEBUGGING
-                // 1. Randomize some coordinates
-                success = rando_unique_coordinates(xMin, xMax, yMin, yMax, retVal, &newCoord, HARKLESWARM_MAX_TRIES);
-                // puts("Got unique coordinates");  // DEBUGGING
-                if (false == success)
-                {
-                    HARKLE_ERROR(Harkleswarm, create_shawarma_list, rando_unique_coordinates failed);
-                }
-                else
-                {
-                    // 2. Create a node
-                    tmp_ptr = build_new_shawarma_struct(newCoord.xCoord, newCoord.yCoord, i, localShChar, shStatus);
-                    if (!tmp_ptr)
-                    {
-                        HARKLE_ERROR(Harkleswarm, create_shawarma_list, build_new_shawarma_struct failed);
-                        success = false;
-                    }
-                    else
-                    {
-                        // 3. Add the node to the list
-                        tmpHead_ptr = add_shawarma_node(retVal, tmp_ptr, listLen + 1);
+            tmpNode = stepNode;
 
-                        if (tmpHead_ptr != retVal && retVal)
-                        {
-                            HARKLE_ERROR(Harkleswarm, create_shawarma_list, add_shawarma_node failed);
-                            success = false;
-                        }
-                    }
-                }
-            }
-            
-            if (true == success)
+            if (1 != move_shawarma(&tmpNode, &target, 1)
+                || false == verify_unique_coordinates(tmpNode.absX, tmpNode.absY, headNode_ptr))
             {
-                // Reset temp variables because everything succeeded
-                localShChar = shChar;
-                newCoord.xCoord = 0;
-                newCoord.yCoord = 0;
-                tmp_ptr = NULL;  // Not a memory leak because it's in the linked list
-                tmpHead_ptr = NULL;  // Not a memory leak because the head node pointer is also in retVal
+                break;  // On target or blocked
             }
+
+            stepNode = tmpNode;
+            numMoves++;
         }
     }
-    
-    // CLEAN UP
-    if (false == success)
+
+    // 4. Only keep a move that leaves the point closer to equidistant from its (new) closest points
+    if (true == success && 0 < numMoves)
     {
-        if (retVal)
+        sourceNode_ptr->absX = stepNode.absX;
+        sourceNode_ptr->absY = stepNode.absY;
+        newClosePnts = find_two_dim_neighbours(curWindow, headNode_ptr, sourceNode_ptr, intercepts, newCoord_arr);
+
+        if (-1 == newClosePnts)
         {
-            // tmpHead_ptr
-            if (tmpHead_ptr == retVal)
-            {
-                tmpHead_ptr = NULL;
-            }
-            // retVal
-            if (false == free_shawarma_linked_list(&retVal))
-            {
-                HARKLE_ERROR(Harkleswarm, create_shawarma_list, free_shawarma_linked_list failed);
-            }
-            // tmp_ptr
-            if (tmp_ptr)
-            {
-                if (false == free_shawarma_struct(&tmp_ptr))
-                {
-                    HARKLE_ERROR(Harkleswarm, create_shawarma_list, free_shawarma_struct failed);
-                }
-            }
+            HARKLE_ERROR(Harkleswarm, shwarm_two_dim, find_two_dim_neighbours encountered an error);
+            numMoves = -1;
         }
-    }
-    
-    // DONE
-    return retVal;
-}
+        else if (3 == newClosePnts && false == is_triangulation_improved(coord_arr, newCoord_arr))
+        {
+            numMoves = 0;  // No better off
+        }
+
+        if (0 >= numMoves)
+        {
+            sourceNode_ptr->absX = oldNode.absX;
+            sourceNode_ptr->absY = oldNode.absY;
+        }
+        // 5. Clear the old point (as long as there's a window to clear)
+        else if (curWindow->win_ptr && false == clear_this_coord(curWindow, &oldNode))
+        {
+            HARKLE_ERROR(Harkleswarm, shwarm_two_dim, clear_this_coord failed);
+            numMoves = -1;
+        }
+    }
+
+    // DONE
+    return numMoves;
+}
+
+
+/*
+    PURPOSE - Finds the three points closest to sourceNode_ptr within headNode_ptr's linked list (and
+        extraHead_ptr's) and stores them in coord_arr, closest first
+    INPUT
+        curWindow - Pointer to a winDetails struct (unused but kept for parity with find_closest_one_dim_points())
+        headNode_ptr - Pointer to the head node of a linked list of shawarma pointers containing available points
+        extraHead_ptr - [Optional] Pointer to the head node of a second linked list of available points
+            (e.g., walls) to search after headNode_ptr's linked list
+        sourceNode_ptr - shawarma struct pointer to use as the 'origin' point to calculate distances
+        coord_arr - NULL-terminated array of three hsLineLen struct pointers to use as 'out' parameters
+    OUTPUT
+        On success, number of hsLineLen struct pointers populated (fewer than three if the swarm is tiny)
+        On error, -1
+    NOTES
+        Equal distances go to the lower posNum and extraHead_ptr's nodes rank after every point, in list order
+            (see: keep_closest_coordinate()), so the result doesn't depend on the order of the linked list
+        Points are ranked by squared distance (see: calc_int_point_sq_dist()), which a double holds exactly, and
+            only the three kept get a square root
+        This is a linear scan.  Use a plane engine (see: Harkleplane.h) to swarm more than a handful of points.
+        This function assumes that all input validation was accomplished in find_closest_points() and does not
+            perform additional input validation.
+ */
+int find_closest_two_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr extraHead_ptr,
+                                shawarma_ptr sourceNode_ptr, hsLineLen_ptr* coord_arr)
+{
+    // LOCAL VARIABLES
+    int numPoints = 0;                 // Number of points stored in coord_arr
+    bool inExtra = false;              // Set to true once tmpNode_ptr has moved on to extraHead_ptr's list
+    shawarma_ptr tmpNode_ptr = NULL;   // Iterating variable for the 'in' linked list
+    long long tmpSqDist = 0;           // Squared distance from sourceNode_ptr to tmpNode_ptr
+    long long tieKey_arr[3];           // Tie keys of the coord_arr entries (see: keep_closest_coordinate())
+    int extraNum = 0;                  // Number of extraHead_ptr nodes searched so far
+    int i = 0;                         // Iterating variable
+
+    // FIND POINTS
+    tmpNode_ptr = headNode_ptr;
+
+    while (tmpNode_ptr && -1 < numPoints)
+    {
+        if (tmpNode_ptr != sourceNode_ptr)
+        {
+            tmpSqDist = calc_int_point_sq_dist(sourceNode_ptr->absX, sourceNode_ptr->absY,
+                                               tmpNode_ptr->absX, tmpNode_ptr->absY);
+            numPoints = keep_closest_coordinate(coord_arr, tieKey_arr, 3, numPoints, tmpNode_ptr->absX,
+                                                tmpNode_ptr->absY, (double)tmpSqDist,
+                                                (true == inExtra) ? HS_WALL_TIE_KEY(extraNum++) : tmpNode_ptr->posNum);
+
+            if (0 > numPoints)
+            {
+                HARKLE_ERROR(Harkleswarm, find_closest_two_dim_points, keep_closest_coordinate failed);
+            }
+        }
+
+        // Next node
+        tmpNode_ptr = tmpNode_ptr->nextPnt;
+        if (!tmpNode_ptr && false == inExtra)
+        {
+            tmpNode_ptr = extraHead_ptr;
+            inExtra = true;
+        }
+    }
+
+    // MEASURE THE KEEPERS
+    for (i = 0; i < numPoints; i++)
+    {
+        coord_arr[i]->dist = sqrt(coord_arr[i]->dist);
+    }
+
+    // DONE
+    return numPoints;
+}
+
+
+/*
+    PURPOSE - Randomize distinct coordinates within a field without rejection sampling
+    INPUT
+        xMin - Lowest appropriate value for the x coordinate
+        xMax - Largest appropriate value for the x coordinate
+        yMin - Lowest appropriate value for the y coordinate
+        yMax - Largest appropriate value for the y coordinate
+        numCoords - Number of distinct coordinates to randomize
+        coord_arr - Out parameter array, of at least numCoords entries, for the coordinates
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This is Robert Floyd's sampling algorithm over the field's row major cell indices.  Every draw
+            selects a new cell so it makes exactly numCoords draws, even on a full field.  The occupancy
+            map holds the cells already selected.
+        This function does not perform input validation
+ */
+bool sample_distinct_cells(int xMin, int xMax, int yMin, int yMax, int numCoords, hsLineLen_ptr coord_arr)
+{
+    // LOCAL VARIABLES
+    bool success = true;                                   // Set this to false if anything fails
+    hsOccupancy_ptr occupy_ptr = NULL;                     // Cells already selected
+    long long width = (long long)xMax - xMin + 1;          // Number of cells per row
+    long long numCells = width * ((long long)yMax - yMin + 1);  // Number of cells in the field
+    long long cellIndex = 0;                               // Randomized row major cell index
+    long long j = 0;                                       // Floyd's upper bound
+    int i = 0;                                             // Iterating variable
+
+    // SETUP
+    occupy_ptr = build_occupancy_map(xMin, xMax, yMin, yMax, numCoords);
+
+    if (!occupy_ptr)
+    {
+        HARKLE_ERROR(Harkleswarm, sample_distinct_cells, build_occupancy_map failed);
+        success = false;
+    }
+
+    // SAMPLE
+    for (i = 0, j = numCells - numCoords; true == success && i < numCoords; i++, j++)
+    {
+        // Pick from [0, j].  If that cell is taken, j itself never has been.
+        cellIndex = rando_cell_index(j);
+        coord_arr[i].xCoord = xMin + (int)(cellIndex % width);
+        coord_arr[i].yCoord = yMin + (int)(cellIndex / width);
+
+        if (true == is_coordinate_occupied(occupy_ptr, coord_arr[i].xCoord, coord_arr[i].yCoord))
+        {
+            coord_arr[i].xCoord = xMin + (int)(j % width);
+            coord_arr[i].yCoord = yMin + (int)(j / width);
+        }
+
+        success = occupy_coordinate(occupy_ptr, coord_arr[i].xCoord, coord_arr[i].yCoord);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkleswarm, sample_distinct_cells, occupy_coordinate failed);
+        }
+    }
+
+    // CLEAN UP
+    if (occupy_ptr)
+    {
+        free_occupancy_map(&occupy_ptr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Build a linked list of shawarma nodes from an array of coordinates
+    INPUT
+        coord_arr - Array of listLen coordinates
+        listLen - Number of nodes to build
+        shChar - The character to print for each node (If 0, will use the node's posNum member value)
+        shStatus - shStatus member value for each node
+    OUTPUT
+        On success, pointer to the head node of a linked list of listLen nodes numbered 1 through listLen
+        On failure, NULL
+    NOTES
+        Nodes are appended with a tail pointer so this is linear in listLen
+        This function does not perform input validation
+ */
+shawarma_ptr build_shawarma_list_from_coords(hsLineLen_ptr coord_arr, int listLen, char shChar, unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;       // Store the head node to the new linked list here
+    shawarma_ptr tmp_ptr = NULL;      // Temp storage for newly built child nodes
+    shawarma_ptr tmpTail_ptr = NULL;  // Last node in the linked list
+    char localShChar = shChar;        // Level of indirection for the struct graphic member
+    int i = 0;                        // Iterating variable
+
+    // ALLOCATE NODES
+    for (i = 1; i <= listLen; i++)
+    {
+        // Determine character value
+        localShChar = (0 == shChar) ? i + 48 : shChar;
+
+        tmp_ptr = build_new_shawarma_struct(coord_arr[i - 1].xCoord, coord_arr[i - 1].yCoord, i, localShChar,
+                                            shStatus);
+
+        if (!tmp_ptr)
+        {
+            HARKLE_ERROR(Harkleswarm, build_shawarma_list_from_coords, build_new_shawarma_struct failed);
+
+            if (retVal && false == free_shawarma_linked_list(&retVal))
+            {
+                HARKLE_ERROR(Harkleswarm, build_shawarma_list_from_coords, free_shawarma_linked_list failed);
+            }
+            retVal = NULL;
+            break;
+        }
+        else if (!retVal)
+        {
+            retVal = tmp_ptr;  // First node
+        }
+        else
+        {
+            tmpTail_ptr->nextPnt = tmp_ptr;  // Additional node
+        }
+        tmpTail_ptr = tmp_ptr;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+shawarma_ptr alloc_shawarma_struct(void)
+{
+    return allocate_cartCoord_struct();
+}
+
+
+shawarma_ptr build_new_shawarma_struct(int xVal, int yVal, int shNum, char shChar, unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;
+    
+    // ALLOCATE & BUILD
+    retVal = build_new_cartCoord_struct(xVal, yVal, shChar, shStatus);
+    
+    // UPDATE
+    if (retVal)
+    {
+        retVal->posNum = shNum;
+    }
+    else
+    {
+        HARKLE_ERROR(Harkleswarm, build_new_shawarma_struct, build_new_cartCoord_struct failed);
+    }
+    
+    // DONE
+    return retVal;
+}
+
+
+shawarma_ptr add_shawarma_node(shawarma_ptr headShawarma, shawarma_ptr newShawarma, int newPos)
+{
+    return add_cartCoord_node(headShawarma, newShawarma, newPos);
+}
+
+
+shawarma_ptr create_shawarma_list(int xMin, int xMax, int yMin, int yMax, int listLen, char shChar, unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;        // Store the head node to the new linked list here
+    bool success = true;               // Set this to false if anything fails
+    hsLineLen_ptr coord_arr = NULL;    // Distinct coordinates for every node
+
+    // INPUT VALIDATION
+    if (xMin > xMax)
+    {
+        HARKLE_ERROR(Harkleswarm, create_shawarma_list, Invalid x coordinate min and max);
+        success = false;
+    }
+    else if (yMin > yMax)
+    {
+        HARKLE_ERROR(Harkleswarm, create_shawarma_list, Invalid y coordinate min and max);
+        success = false;
+    }
+    else if (listLen < 1)
+    {
+        HARKLE_ERROR(Harkleswarm, create_shawarma_list, Invalid list length);
+        success = false;
+    }
+
+    // RANDOMIZE COORDINATES
+    if (true == success)
+    {
+        coord_arr = calloc(listLen, sizeof(hsLineLen));
+
+        if (!coord_arr)
+        {
+            HARKLE_ERROR(Harkleswarm, create_shawarma_list, calloc failed);
+            success = false;
+        }
+        else if (false == rando_distinct_coordinates(xMin, xMax, yMin, yMax, listLen, coord_arr))
+        {
+            HARKLE_ERROR(Harkleswarm, create_shawarma_list, rando_distinct_coordinates failed);
+            success = false;
+        }
+    }
+
+    // ALLOCATE NODES
+    if (true == success)
+    {
+        retVal = build_shawarma_list_from_coords(coord_arr, listLen, shChar, shStatus);
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harkleswarm, create_shawarma_list, build_shawarma_list_from_coords failed);
+        }
+    }
+
+    // CLEAN UP
+    if (coord_arr)
+    {
+        free(coord_arr);
+        coord_arr = NULL;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+shawarma_ptr create_shawarma_line(int x0, int y0, int x1, int y1, int listLen, char shChar, unsigned long shStatus)
+{
+    // LOCAL VARIABLES
+    shawarma_ptr retVal = NULL;        // Store the head node to the new linked list here
+    bool success = true;               // Set this to false if anything fails
+    hsLineLen_ptr coord_arr = NULL;    // Distinct coordinates for every node
+
+    // INPUT VALIDATION
+    if (listLen < 1)
+    {
+        HARKLE_ERROR(Harkleswarm, create_shawarma_line, Invalid list length);
+        success = false;
+    }
+
+    // RANDOMIZE COORDINATES
+    if (true == success)
+    {
+        coord_arr = calloc(listLen, sizeof(hsLineLen));
+
+        if (!coord_arr)
+        {
+            HARKLE_ERROR(Harkleswarm, create_shawarma_line, calloc failed);
+            success = false;
+        }
+        else if (false == rando_line_coordinates(x0, y0, x1, y1, listLen, coord_arr))
+        {
+            HARKLE_ERROR(Harkleswarm, create_shawarma_line, rando_line_coordinates failed);
+            success = false;
+        }
+    }
+
+    // ALLOCATE NODES
+    if (true == success)
+    {
+        retVal = build_shawarma_list_from_coords(coord_arr, listLen, shChar, shStatus);
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harkleswarm, create_shawarma_line, build_shawarma_list_from_coords failed);
+        }
+    }
+
+    // CLEAN UP
+    if (coord_arr)
+    {
+        free(coord_arr);
+        coord_arr = NULL;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+long long rando_cell_index(long long maxIndex)
+{
+    // LOCAL VARIABLES
+    long long retVal = 0;  // Random cell index
+
+    if (maxIndex < HS_RANDO_INDEX_SPAN)
+    {
+        retVal = rando_me(0, (int)maxIndex);
+    }
+    else
+    {
+        do
+        {
+            retVal = ((long long)rando_me(0, (int)(maxIndex / HS_RANDO_INDEX_SPAN)) * HS_RANDO_INDEX_SPAN)
+                     + rando_me(0, HS_RANDO_INDEX_SPAN - 1);
+        } while (retVal > maxIndex);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool rando_distinct_coordinates(int xMin, int xMax, int yMin, int yMax, int numCoords, hsLineLen_ptr coord_arr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (xMin > xMax)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_distinct_coordinates, Invalid x coordinate min and max);
+        success = false;
+    }
+    else if (yMin > yMax)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_distinct_coordinates, Invalid y coordinate min and max);
+        success = false;
+    }
+    else if (numCoords < 1)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_distinct_coordinates, Invalid numCoords);
+        success = false;
+    }
+    else if (!coord_arr)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_distinct_coordinates, Invalid coord_arr);
+        success = false;
+    }
+    else if ((long long)numCoords > ((long long)xMax - xMin + 1) * ((long long)yMax - yMin + 1))
+    {
+        HARKLE_ERROR(Harkleswarm, rando_distinct_coordinates, No room for that many unique coordinates);
+        success = false;
+    }
+
+    // SAMPLE
+    if (true == success)
+    {
+        success = sample_distinct_cells(xMin, xMax, yMin, yMax, numCoords, coord_arr);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkleswarm, rando_distinct_coordinates, sample_distinct_cells failed);
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool rando_line_coordinates(int x0, int y0, int x1, int y1, int numCoords, hsLineLen_ptr coord_arr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    int stepX = x1 - x0;  // X component of the smallest step between two integer points on the line
+    int stepY = y1 - y0;  // Y component of the smallest step between two integer points on the line
+    int numSteps = 0;     // Number of steps from (x0, y0) to (x1, y1)
+    int tmpNum = 0;       // Step number of the coordinate being converted
+    int i = 0;            // Iterating variable
+
+    // INPUT VALIDATION
+    if (numCoords < 1)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_line_coordinates, Invalid numCoords);
+        success = false;
+    }
+    else if (!coord_arr)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_line_coordinates, Invalid coord_arr);
+        success = false;
+    }
+    else
+    {
+        // The line holds gcd(|dx|, |dy|) + 1 integer points
+        numSteps = calc_int_gcd(stepX, stepY);
+
+        if (numCoords > numSteps + 1)
+        {
+            HARKLE_ERROR(Harkleswarm, rando_line_coordinates, No room for that many unique coordinates);
+            success = false;
+        }
+        else if (numSteps > 0)
+        {
+            stepX /= numSteps;
+            stepY /= numSteps;
+        }
+    }
+
+    // SAMPLE STEPS
+    if (true == success)
+    {
+        success = sample_distinct_cells(0, numSteps, 0, 0, numCoords, coord_arr);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkleswarm, rando_line_coordinates, sample_distinct_cells failed);
+        }
+    }
+
+    // CONVERT STEPS TO COORDINATES
+    if (true == success)
+    {
+        for (i = 0; i < numCoords; i++)
+        {
+            tmpNum = coord_arr[i].xCoord;  // Step number
+            coord_arr[i].xCoord = x0 + (tmpNum * stepX);
+            coord_arr[i].yCoord = y0 + (tmpNum * stepY);
+        }
+    }
+
+    // DONE
+    return success;
+}
 
 
 bool rando_unique_coordinates(int xMin, int xMax, int yMin, int yMax, shawarma_ptr headNode_ptr, \
@@ -1043,6 +1655,78 @@ bool rando_unique_coordinates(int xMin, int xMax, int yMin, int yMax, shawarma_p
 }
 
 
+bool rando_unoccupied_coordinates(int xMin, int xMax, int yMin, int yMax, hsOccupancy_ptr occupy_ptr,
+                                  hsLineLen_ptr cartCoord_ptr, int maxSearch)
+{
+    // LOCAL VARIABLES
+    bool success = true;   // Set this to false if anything fails
+    int searchNum = 0;     // Current search number
+    int randoX = 0;        // Store randomized x coordinates here
+    int randoY = 0;        // Store randomized y coordinates here
+
+    // INPUT VALIDATION
+    if (xMin > xMax)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_unoccupied_coordinates, Invalid x coordinate min and max);
+        success = false;
+    }
+    else if (yMin > yMax)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_unoccupied_coordinates, Invalid y coordinate min and max);
+        success = false;
+    }
+    else if (!occupy_ptr)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_unoccupied_coordinates, Invalid occupy_ptr);
+        success = false;
+    }
+    else if (!cartCoord_ptr)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_unoccupied_coordinates, Invalid cartCoord_ptr);
+        success = false;
+    }
+    else if (0 > maxSearch)
+    {
+        HARKLE_ERROR(Harkleswarm, rando_unoccupied_coordinates, Invalid maxSearch value);
+        success = false;
+    }
+    else if (occupy_ptr->numOccupied >= ((long long)xMax - xMin + 1) * ((long long)yMax - yMin + 1))
+    {
+        HARKLE_ERROR(Harkleswarm, rando_unoccupied_coordinates, No room for more coordinates);
+        success = false;
+    }
+
+    // RANDOMIZE COORDINATES
+    while (true == success)
+    {
+        // 1. Randomize coordinates
+        randoX = rando_me(xMin, xMax);
+        randoY = rando_me(yMin, yMax);
+
+        // 2. Verify they're unoccupied
+        if (false == is_coordinate_occupied(occupy_ptr, randoX, randoY))
+        {
+            cartCoord_ptr->xCoord = randoX;
+            cartCoord_ptr->yCoord = randoY;
+            break;  // Found one.  Stop looking.
+        }
+        else
+        {
+            searchNum++;
+        }
+
+        // 3. Check search count
+        if (maxSearch > 0 && searchNum >= maxSearch)
+        {
+            success = false;  // Didn't find one but we've hit the maximum search iterations
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
 bool verify_unique_coordinates(int xCoord, int yCoord, shawarma_ptr headNode_ptr)
 {
     // LOCAL VARIABLES
@@ -1126,8 +1810,8 @@ int find_closest_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, sha
         switch (numDims)
         {
             case (1):
-                // int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr sourceNode_ptr, hsLineLen_ptr* coord_arr)
-                numPoints = find_closest_one_dim_points(curWindow, headNode_ptr, sourceNode_ptr, coord_arr);
+                // int find_closest_one_dim_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr extraHead_ptr, shawarma_ptr sourceNode_ptr, hsLineLen_ptr* coord_arr)
+                numPoints = find_closest_one_dim_points(curWindow, headNode_ptr, NULL, sourceNode_ptr, coord_arr);
 
                 if (0 > numPoints)
                 {
@@ -1140,6 +1824,15 @@ int find_closest_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, sha
                     success = false;
                 }
                 break;
+            case (2):
+                numPoints = find_closest_two_dim_points(curWindow, headNode_ptr, NULL, sourceNode_ptr, coord_arr);
+
+                if (0 > numPoints)
+                {
+                    HARKLE_ERROR(Harkleswarm, find_closest_points, find_closest_two_dim_points failed);
+                    success = false;
+                }
+                break;
             default:
                 HARKLE_ERROR(Harkleswarm, find_closest_points, Unsupported number of dimensions);
                 success = false;
@@ -1202,6 +1895,13 @@ int shwarm_it(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, int maxMoves,
                         HARKLE_ERROR(Harkleswarm, shwarm_it, shwarm_one_dim failed);
                     }
                     break;
+                case 2:
+                    numMoves = shwarm_two_dim(curWindow, headNode_ptr, sourceNode_ptr, maxMoves, intercepts);
+                    if (0 > numMoves)
+                    {
+                        HARKLE_ERROR(Harkleswarm, shwarm_it, shwarm_two_dim failed);
+                    }
+                    break;
                 default:
                     HARKLE_ERROR(Harkleswarm, shwarm_it, Unsupported dimension);
                     break;
@@ -1214,40 +1914,38 @@ int shwarm_it(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, int maxMoves,
 }
 
 
-bool verify_line(shawarma_ptr headNode_ptr, double slope, int maxPrec)
+bool verify_line(shawarma_ptr headNode_ptr)
 {
     // LOCAL VARIABLES
     bool straightLine = false;                // Set this to true if everything checks out
-    shawarma_ptr tmpNode_ptr = headNode_ptr;  // Iterating node pointer
-    double tmpSlope = 0.0;                    // Store calls to slope functions here
+    shawarma_ptr tmpNode_ptr = NULL;          // Iterating node pointer
 
     // INPUT VALIDATION
     if (!headNode_ptr)
     {
         HARKLE_ERROR(Harkleswarm, verify_line, Invalid headNode_ptr);
     }
-    else if (maxPrec < 1)
+    else if (2 > get_num_cartCoord_nodes(headNode_ptr))
     {
-        HARKLE_ERROR(Harkleswarm, verify_line, Invalid level of floating point precision);
+        HARKLE_ERROR(Harkleswarm, verify_line, Too few points to determine direction);
     }
-    else if (2 > get_num_cartCoord_nodes(headNode_ptr))
+    else if (headNode_ptr->absX == headNode_ptr->nextPnt->absX && headNode_ptr->absY == headNode_ptr->nextPnt->absY)
     {
-        HARKLE_ERROR(Harkleswarm, verify_line, Too few points to determine slope);
+        HARKLE_ERROR(Harkleswarm, verify_line, The first two points share a coordinate);
     }
     else
     {
         // ITERATE POINTS
         straightLine = true;  // Prove this wrong
+        tmpNode_ptr = headNode_ptr->nextPnt;
 
         while (tmpNode_ptr->nextPnt)
         {
-            tmpSlope = calc_int_point_slope(tmpNode_ptr->absX, tmpNode_ptr->absY,
-                                            tmpNode_ptr->nextPnt->absX, tmpNode_ptr->nextPnt->absY);
-
-            if (false == dble_equal_to(tmpSlope, slope, maxPrec))
+            if (false == are_int_points_collinear(headNode_ptr->absX, headNode_ptr->absY,
+                                                  headNode_ptr->nextPnt->absX, headNode_ptr->nextPnt->absY,
+                                                  tmpNode_ptr->nextPnt->absX, tmpNode_ptr->nextPnt->absY))
             {
-                fprintf(stderr, "verify_line() ERROR tmpSlope %f != slope %f\n", tmpSlope, slope);  // DEBUGGING
-                fprintf(stderr, "tmpNode (x, y) == (%d, %d) and tmpNode->nextPnt (x, y) == (%d, %d)\n", tmpNode_ptr->absX, tmpNode_ptr->absY, tmpNode_ptr->nextPnt->absX, tmpNode_ptr->nextPnt->absY);  // DEBUGGING
+                fprintf(stderr, "verify_line() ERROR (%d, %d) is not on the line through (%d, %d) and (%d, %d)\n", tmpNode_ptr->nextPnt->absX, tmpNode_ptr->nextPnt->absY, headNode_ptr->absX, headNode_ptr->absY, headNode_ptr->nextPnt->absX, headNode_ptr->nextPnt->absY);  // DEBUGGING
                 straightLine = false;
                 break;
             }
@@ -1482,10 +2180,11 @@ bool calculate_intercepts(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, s
 
 
 bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode_ptr,
-                               shawarma_ptr outHeadNode_ptr, double slope)
+                               shawarma_ptr outHeadNode_ptr, int runX, int riseY)
 {
     // LOCAL VARIABLES
     bool success = false;  // Indicates success or failure of the function
+    bool validArr[4] = { false, false, false, false };  // Set these to true if point1-4 were solved
     int lowerX = 0;                   // curWindow->leftC
     int upperX = 0;                   // curWindow->leftC + curWindow->nCols - 1
     int lowerY = 0;                   // curWindow->upperR
@@ -1513,6 +2212,10 @@ bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode
     {
         HARKLE_ERROR(Harkleswarm, calculate_line_intercepts, Not enough nodes);
     }
+    else if (0 == runX && 0 == riseY)
+    {
+        HARKLE_ERROR(Harkleswarm, calculate_line_intercepts, Invalid direction);
+    }
     else
     {
         success = true;
@@ -1535,19 +2238,25 @@ bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode
         point3.yCoord = lowerY;
         point4.yCoord = upperY;
 
-        // Calculate unknowns
-        point1.yCoord = solve_point_slope_y(sourceNode_ptr->absX, sourceNode_ptr->absY,
-                                            point1.xCoord, slope, HM_RND);
-        point2.yCoord = solve_point_slope_y(sourceNode_ptr->absX, sourceNode_ptr->absY,
-                                            point2.xCoord, slope, HM_RND);
-        point3.xCoord = solve_point_slope_x(sourceNode_ptr->absX, sourceNode_ptr->absY,
-                                            point3.yCoord, slope, HM_RND);
-        point4.xCoord = solve_point_slope_x(sourceNode_ptr->absX, sourceNode_ptr->absY,
-                                            point4.yCoord, slope, HM_RND);
+        // Calculate unknowns (vertical lines never cross the side columns, horizontal lines the top/bottom rows)
+        if (0 != runX)
+        {
+            validArr[0] = solve_int_line_y(sourceNode_ptr->absX, sourceNode_ptr->absY, runX, riseY,
+                                           point1.xCoord, HM_RND, &(point1.yCoord));
+            validArr[1] = solve_int_line_y(sourceNode_ptr->absX, sourceNode_ptr->absY, runX, riseY,
+                                           point2.xCoord, HM_RND, &(point2.yCoord));
+        }
+        if (0 != riseY)
+        {
+            validArr[2] = solve_int_line_x(sourceNode_ptr->absX, sourceNode_ptr->absY, runX, riseY,
+                                           point3.yCoord, HM_RND, &(point3.xCoord));
+            validArr[3] = solve_int_line_x(sourceNode_ptr->absX, sourceNode_ptr->absY, runX, riseY,
+                                           point4.yCoord, HM_RND, &(point4.xCoord));
+        }
 
         //DEBUGGING
         // fprintf(stderr, "Window Dimensions: (%d, %d) to (%d, %d)\n", lowerX, lowerY, upperX, upperY);  // DEBUGGING
-        // fprintf(stderr, "Slope passing through (%d, %d) is %lf\n", sourceNode_ptr->absX, sourceNode_ptr->absY, slope);  // DEBUGGING
+        // fprintf(stderr, "Direction through (%d, %d) is (%d, %d)\n", sourceNode_ptr->absX, sourceNode_ptr->absY, runX, riseY);  // DEBUGGING
         // fprintf(stderr, "Point1 (x, y) == (%d, %d)\n", point1.xCoord, point1.yCoord);  // DEBUGGING
         // fprintf(stderr, "Point2 (x, y) == (%d, %d)\n", point2.xCoord, point2.yCoord);  // DEBUGGING
         // fprintf(stderr, "Point3 (x, y) == (%d, %d)\n", point3.xCoord, point3.yCoord);  // DEBUGGING
@@ -1555,7 +2264,7 @@ bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode
 
         // Find the points
         // Point 1
-        if (true == success && point1.yCoord >= lowerY && point1.yCoord <= upperY)
+        if (true == success && true == validArr[0] && point1.yCoord >= lowerY && point1.yCoord <= upperY)
         {
             if (!tmpNode_ptr)
             {
@@ -1572,7 +2281,7 @@ bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode
             }
         }
         // Point 2
-        if (true == success && point2.yCoord >= lowerY && point2.yCoord <= upperY)
+        if (true == success && true == validArr[1] && point2.yCoord >= lowerY && point2.yCoord <= upperY)
         {
             if (!tmpNode_ptr)
             {
@@ -1589,7 +2298,7 @@ bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode
             }
         }
         // Point 3
-        if (true == success && point3.xCoord >= lowerX && point3.xCoord <= upperX)
+        if (true == success && true == validArr[2] && point3.xCoord >= lowerX && point3.xCoord <= upperX)
         {
             if (!tmpNode_ptr)
             {
@@ -1609,7 +2318,7 @@ bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode
             }
         }
         // Point 4
-        if (true == success && point4.xCoord >= lowerX && point4.xCoord <= upperX)
+        if (true == success && true == validArr[3] && point4.xCoord >= lowerX && point4.xCoord <= upperX)
         {
             if (!tmpNode_ptr)
             {
@@ -1643,6 +2352,237 @@ bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode
 }
 
 
+int keep_closest_coordinate(hsLineLen_ptr *coord_arr, long long *tieKey_arr, int numSlots, int numFound, int xCoord,
+                            int yCoord, double dist, long long tieKey)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;  // Number of coord_arr entries in use
+    int i = 0;        // Iterating variable
+
+    // INPUT VALIDATION
+    if (!coord_arr || !tieKey_arr)
+    {
+        HARKLE_ERROR(Harkleswarm, keep_closest_coordinate, Invalid coord_arr);
+    }
+    else if (1 > numSlots || 0 > numFound || numFound > numSlots)
+    {
+        HARKLE_ERROR(Harkleswarm, keep_closest_coordinate, Invalid number of entries);
+    }
+    else
+    {
+        retVal = numFound;
+
+        if (numFound < numSlots || dist < coord_arr[numSlots - 1]->dist
+            || (dist == coord_arr[numSlots - 1]->dist && tieKey < tieKey_arr[numSlots - 1]))
+        {
+            // Shift every farther entry down one slot (dropping the farthest if the array is full)
+            i = (numFound < numSlots) ? numFound : numSlots - 1;
+
+            while (i > 0 && (dist < coord_arr[i - 1]->dist
+                             || (dist == coord_arr[i - 1]->dist && tieKey < tieKey_arr[i - 1])))
+            {
+                *(coord_arr[i]) = *(coord_arr[i - 1]);
+                tieKey_arr[i] = tieKey_arr[i - 1];
+                i--;
+            }
+
+            coord_arr[i]->xCoord = xCoord;
+            coord_arr[i]->yCoord = yCoord;
+            coord_arr[i]->dist = dist;
+            tieKey_arr[i] = tieKey;
+
+            if (numFound < numSlots)
+            {
+                retVal++;
+            }
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool calc_two_dim_wall_points(winDetails_ptr curWindow, int xCoord, int yCoord, hsLineLen_ptr wall_arr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the walls are calculated
+    int upperX = 0;        // curWindow->nCols - 1
+    int upperY = 0;        // curWindow->nRows - 1
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleswarm, calc_two_dim_wall_points, Invalid curWindow pointer);
+    }
+    else if (!wall_arr)
+    {
+        HARKLE_ERROR(Harkleswarm, calc_two_dim_wall_points, Invalid wall_arr pointer);
+    }
+    else
+    {
+        upperX = curWindow->nCols - 1;
+        upperY = curWindow->nRows - 1;
+
+        // Left, right, top, bottom
+        wall_arr[0].xCoord = 0;
+        wall_arr[0].yCoord = yCoord;
+        wall_arr[0].dist = abs(xCoord);
+        wall_arr[1].xCoord = upperX;
+        wall_arr[1].yCoord = yCoord;
+        wall_arr[1].dist = abs(upperX - xCoord);
+        wall_arr[2].xCoord = xCoord;
+        wall_arr[2].yCoord = 0;
+        wall_arr[2].dist = abs(yCoord);
+        wall_arr[3].xCoord = xCoord;
+        wall_arr[3].yCoord = upperY;
+        wall_arr[3].dist = abs(upperY - yCoord);
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool determine_triangulation_point(winDetails_ptr curWindow, hsLineLen_ptr *coord_arr, hsLineLen_ptr target_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if the target is calculated
+    long long bX = 0;      // coord_arr[1]->xCoord, relative to coord_arr[0]
+    long long bY = 0;      // coord_arr[1]->yCoord, relative to coord_arr[0]
+    long long cX = 0;      // coord_arr[2]->xCoord, relative to coord_arr[0]
+    long long cY = 0;      // coord_arr[2]->yCoord, relative to coord_arr[0]
+    long long bSq = 0;     // Squared magnitude of b
+    long long cSq = 0;     // Squared magnitude of c
+    long long denom = 0;   // Twice the signed area of the triangle, doubled (0 if the points are collinear)
+    long long abLen = 0;   // Squared distance from a to b
+    long long bcLen = 0;   // Squared distance from b to c
+    long long caLen = 0;   // Squared distance from c to a
+    hsLineLen_ptr end1_ptr = NULL;  // One end of the longest side
+    hsLineLen_ptr end2_ptr = NULL;  // The other end of the longest side
+
+    // INPUT VALIDATION
+    if (!curWindow)
+    {
+        HARKLE_ERROR(Harkleswarm, determine_triangulation_point, Invalid curWindow pointer);
+    }
+    else if (!coord_arr || !(coord_arr[0]) || !(coord_arr[1]) || !(coord_arr[2]))
+    {
+        HARKLE_ERROR(Harkleswarm, determine_triangulation_point, Invalid coord_arr);
+    }
+    else if (!target_ptr)
+    {
+        HARKLE_ERROR(Harkleswarm, determine_triangulation_point, Invalid target_ptr);
+    }
+    else
+    {
+        // Relative to a, so every product stays well inside a long long
+        bX = (long long)coord_arr[1]->xCoord - coord_arr[0]->xCoord;
+        bY = (long long)coord_arr[1]->yCoord - coord_arr[0]->yCoord;
+        cX = (long long)coord_arr[2]->xCoord - coord_arr[0]->xCoord;
+        cY = (long long)coord_arr[2]->yCoord - coord_arr[0]->yCoord;
+        denom = 2 * calc_int_cross_product(coord_arr[0]->xCoord, coord_arr[0]->yCoord, coord_arr[1]->xCoord,
+                                           coord_arr[1]->yCoord, coord_arr[2]->xCoord, coord_arr[2]->yCoord);
+
+        // 1. Circumcenter (exact rationals, rounded once)
+        if (0 != denom)
+        {
+            bSq = (bX * bX) + (bY * bY);
+            cSq = (cX * cX) + (cY * cY);
+            target_ptr->xCoord = (int)divide_int_ratio((coord_arr[0]->xCoord * denom) + (cY * bSq) - (bY * cSq),
+                                                       denom, HM_RND);
+            target_ptr->yCoord = (int)divide_int_ratio((coord_arr[0]->yCoord * denom) + (bX * cSq) - (cX * bSq),
+                                                       denom, HM_RND);
+            success = true;
+        }
+        // 2. Collinear points have no circumcenter so split the difference of the outermost two
+        else
+        {
+            abLen = calc_int_point_sq_dist(coord_arr[0]->xCoord, coord_arr[0]->yCoord,
+                                           coord_arr[1]->xCoord, coord_arr[1]->yCoord);
+            bcLen = calc_int_point_sq_dist(coord_arr[1]->xCoord, coord_arr[1]->yCoord,
+                                           coord_arr[2]->xCoord, coord_arr[2]->yCoord);
+            caLen = calc_int_point_sq_dist(coord_arr[2]->xCoord, coord_arr[2]->yCoord,
+                                           coord_arr[0]->xCoord, coord_arr[0]->yCoord);
+
+            if (abLen >= bcLen && abLen >= caLen)
+            {
+                end1_ptr = coord_arr[0];
+                end2_ptr = coord_arr[1];
+            }
+            else if (bcLen >= caLen)
+            {
+                end1_ptr = coord_arr[1];
+                end2_ptr = coord_arr[2];
+            }
+            else
+            {
+                end1_ptr = coord_arr[2];
+                end2_ptr = coord_arr[0];
+            }
+
+            success = determine_mid_point(end1_ptr, end2_ptr, target_ptr, 0);
+
+            if (false == success)
+            {
+                HARKLE_ERROR(Harkleswarm, determine_triangulation_point, determine_mid_point failed);
+            }
+        }
+
+        // 3. Keep it off the walls
+        if (true == success)
+        {
+            if (target_ptr->xCoord < 1)
+            {
+                target_ptr->xCoord = 1;
+            }
+            else if (target_ptr->xCoord > curWindow->nCols - 2)
+            {
+                target_ptr->xCoord = curWindow->nCols - 2;
+            }
+            if (target_ptr->yCoord < 1)
+            {
+                target_ptr->yCoord = 1;
+            }
+            else if (target_ptr->yCoord > curWindow->nRows - 2)
+            {
+                target_ptr->yCoord = curWindow->nRows - 2;
+            }
+            target_ptr->dist = 0.0;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool is_triangulation_improved(hsLineLen_ptr *oldCoord_arr, hsLineLen_ptr *newCoord_arr)
+{
+    // LOCAL VARIABLES
+    bool retVal = false;  // Set this to true if the move is an improvement
+
+    // INPUT VALIDATION
+    if (!oldCoord_arr || !(oldCoord_arr[0]) || !(oldCoord_arr[1]) || !(oldCoord_arr[2]))
+    {
+        HARKLE_ERROR(Harkleswarm, is_triangulation_improved, Invalid oldCoord_arr);
+    }
+    else if (!newCoord_arr || !(newCoord_arr[0]) || !(newCoord_arr[1]) || !(newCoord_arr[2]))
+    {
+        HARKLE_ERROR(Harkleswarm, is_triangulation_improved, Invalid newCoord_arr);
+    }
+    // Each array is sorted closest first so the spread is the last distance minus the first
+    else if ((newCoord_arr[2]->dist - newCoord_arr[0]->dist) <= (oldCoord_arr[2]->dist - oldCoord_arr[0]->dist) - 1.0)
+    {
+        retVal = true;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
 bool free_shawarma_struct(shawarma_ptr* oldStruct_ptr)
 {
     return free_cartCoord_struct(oldStruct_ptr);
@@ -2,10 +2,16 @@
 #define __HARKLESWARM__
 
 #include "Harklemath.h"
+#include "Harkleoccupancy.h"    // hsOccupancy_ptr
+#include <limits.h>             // INT_MAX
 
 // Maximum moves made by one point in one iteration
 #define HS_MAX_SWARM_MOVES 2
-#define HS_MAX_SLOPE_PRECISION 5
+// Tie key for the field's wall number wallNum (0 through 3) so walls rank after every point at equal distances
+//  (see: keep_closest_coordinate())
+#define HS_WALL_TIE_KEY(wallNum) ((long long)INT_MAX + 1 + (wallNum))
+// Define HS_DEBUG_VERIFY_LINE (e.g., -DHS_DEBUG_VERIFY_LINE) to verify the entire line on every 1D move.
+//  Otherwise, the line is verified once and every mover keeps the points on it (see: move_shawarma_on_line()).
 // NCURSES Windows Border Specifications
 #define HS_OUTER_BORDER_WIDTH_H 4
 #define HS_OUTER_BORDER_WIDTH_V 2
@@ -93,11 +99,86 @@ shawarma_ptr add_shawarma_node(shawarma_ptr headShawarma, shawarma_ptr newShawar
         On failure, NULL
     NOTES
         This function calls build_new_shawarma_struct() to allocate and define the struct
+        Coordinates are drawn with rando_distinct_coordinates() and nodes are appended with a tail pointer
+            so building the list is linear in listLen, at any density up to a full field
         It is the caller's responsibility to free the memory allocated by this function call
  */
 shawarma_ptr create_shawarma_list(int xMin, int xMax, int yMin, int yMax, int listLen, char shChar, unsigned long shStatus);
 
 
+/*
+    PURPOSE - Allocate a linked list of shawarma nodes randomly placed on the integer points of a line segment
+    INPUT
+        x0 - X coordinate of one end of the line segment
+        y0 - Y coordinate of one end of the line segment
+        x1 - X coordinate of the other end of the line segment
+        y1 - Y coordinate of the other end of the line segment
+        listLen - Number of nodes to add to the linked list
+        shChar - The character to print for each node (If 0, will use the node's posNum member value)
+        shStatus - shStatus member value for each node
+    OUTPUT
+        On success, pointer to the head node of a linked list containing 'listLen' number of shawarma nodes
+        On failure, NULL
+    NOTES
+        Every node lies exactly on the line so the list is ready for the one dimensional engines
+            (e.g., shwarm_it(..., 1, ...) or build_line_engine())
+        It is the caller's responsibility to free the memory allocated by this function call
+ */
+shawarma_ptr create_shawarma_line(int x0, int y0, int x1, int y1, int listLen, char shChar, unsigned long shStatus);
+
+
+/*
+    PURPOSE - Randomize a cell index
+    INPUT
+        maxIndex - Largest appropriate cell index
+    OUTPUT
+        A random number from 0 to maxIndex, inclusive
+    NOTES
+        rando_me() only covers int ranges.  Larger ranges are stitched together from two calls (and redrawn
+            if they overshoot maxIndex, which happens less than half the time).
+        This function does not perform input validation
+ */
+long long rando_cell_index(long long maxIndex);
+
+
+/*
+    PURPOSE - Randomize distinct coordinates within a field
+    INPUT
+        xMin - Lowest appropriate value for the x coordinate
+        xMax - Largest appropriate value for the x coordinate
+        yMin - Lowest appropriate value for the y coordinate
+        yMax - Largest appropriate value for the y coordinate
+        numCoords - Number of distinct coordinates to randomize
+        coord_arr - Out parameter array, of at least numCoords entries, in which to store the coordinates
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Samples without replacement (no retries) so it always finishes in O(numCoords), even if numCoords
+            fills the field.  Only the xCoord and yCoord members of coord_arr are used.
+ */
+bool rando_distinct_coordinates(int xMin, int xMax, int yMin, int yMax, int numCoords, hsLineLen_ptr coord_arr);
+
+
+/*
+    PURPOSE - Randomize distinct integer coordinates on a line segment
+    INPUT
+        x0 - X coordinate of one end of the line segment
+        y0 - Y coordinate of one end of the line segment
+        x1 - X coordinate of the other end of the line segment
+        y1 - Y coordinate of the other end of the line segment
+        numCoords - Number of distinct coordinates to randomize
+        coord_arr - Out parameter array, of at least numCoords entries, in which to store the coordinates
+    OUTPUT
+        On success, true
+        On failure, false (e.g., the segment holds fewer than numCoords integer points)
+    NOTES
+        A segment holds gcd(abs(x1 - x0), abs(y1 - y0)) + 1 integer points
+        Samples without replacement, like rando_distinct_coordinates()
+ */
+bool rando_line_coordinates(int x0, int y0, int x1, int y1, int numCoords, hsLineLen_ptr coord_arr);
+
+
 /*
     PURPOSE - Randomize a unique set of coordinates compared to the linked list provided
     INPUT
@@ -119,6 +200,29 @@ bool rando_unique_coordinates(int xMin, int xMax, int yMin, int yMax, shawarma_p
                               hsLineLen_ptr cartCoord_ptr, int maxSearch);
 
 
+/*
+    PURPOSE - Randomize a set of coordinates that are not yet occupied
+    INPUT
+        xMin - Lowest appropriate value for the x coordinate
+        xMax - Largest appropriate value for the x coordinate
+        yMin - Lowest appropriate value for the y coordinate
+        yMax - Largest appropriate value for the y coordinate
+        occupy_ptr - Pointer to an occupancy map of the coordinates already in use
+        cartCoord_ptr - Out parameter in which to store the randomized coordinates
+        maxSearch - Maximum number of time to randomize coordinates (If 0, will search forever)
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This is rando_unique_coordinates() with an O(1) uniqueness check instead of a scan of the list
+        It still retries so prefer rando_distinct_coordinates() for more than a few coordinates
+        The coordinates are not marked as occupied.  That's up to the caller.
+        Do not trust the contents of cartCoord_ptr if this function returns false
+ */
+bool rando_unoccupied_coordinates(int xMin, int xMax, int yMin, int yMax, hsOccupancy_ptr occupy_ptr,
+                                  hsLineLen_ptr cartCoord_ptr, int maxSearch);
+
+
 /*
     PURPOSE - Verify a set of coordinates are unique within a linked list of shawarma nodes
     INPUT
@@ -147,6 +251,7 @@ bool verify_unique_coordinates(int xCoord, int yCoord, shawarma_ptr headNode_ptr
         The return value of this function should equal the number of hsLineLen pointers provided in the array.
         The number of available pointers in the array will be used to determine the desired dimension.  Arranging
             a point in one dimension requires two points, two dimensions requires three points (see: triangulation), etc.            
+        In two dimensions, coord_arr is sorted closest first and may hold fewer than three points if the swarm is tiny
  */
 int find_closest_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, shawarma_ptr sourceNode_ptr, hsLineLen_ptr* coord_arr);
 
@@ -166,22 +271,28 @@ int find_closest_points(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, sha
         On failure, -1
     NOTES
         This function is really a 'wrapper' around dimensionally-specific helper functions
+        In one dimension, the caller is responsible for providing points that form a line.  The line is
+            only verified on every call if HS_DEBUG_VERIFY_LINE is defined (see: verify_line()).
+        In two dimensions, the node moves toward the point equidistant from its three closest points (see:
+            determine_triangulation_point()) and the field's walls are the intercepts.  Every neighbour search
+            is a scan of the linked list so use a plane engine (see: Harkleplane.h) for large swarms.
  */
 int shwarm_it(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, int maxMoves, int srcNum, int numDim, bool intercepts);
 
 
 /*
-    PURPOSE - Verify that all points represented in the given link list conform to the given slope
+    PURPOSE - Verify that all points represented in the given link list lie on one line
     INPUT
         headNode_ptr - Pointer to the head node of a linked list of shawarma pointers containing available points
-        slope - Verify that all points in headNode_ptr's linked list form this slope
-        maxPrec - Maximum floating point precision when checking calculated slope against 'slope'
     OUTPUT
-        If all nodes conform to the given slope, true
+        If all nodes lie on the line through the first two nodes, true
         Otherwise, false
         On error, false
+    NOTES
+        Every node is checked against the first two with an exact integer cross product (see:
+            are_int_points_collinear()) so there is no slope, and no floating point precision, to get wrong
  */
-bool verify_line(shawarma_ptr headNode_ptr, double slope, int maxPrec);
+bool verify_line(shawarma_ptr headNode_ptr);
 
 
 /*
@@ -218,6 +329,79 @@ bool calc_hsLineLen_contents(shawarma_ptr sourceNode_ptr, shawarma_ptr destNode_
 int move_shawarma(shawarma_ptr node_ptr, hsLineLen_ptr dstCoord_ptr, int maxMoves);
 
 
+/*
+    PURPOSE - Insert a coordinate into an array of the closest coordinates found so far, if it's close enough
+    INPUT
+        coord_arr - Array of numSlots hsLineLen struct pointers, sorted closest first
+        tieKey_arr - Array of numSlots tie keys, one per coord_arr entry, maintained by this function
+        numSlots - Number of entries in coord_arr
+        numFound - Number of coord_arr entries already in use
+        xCoord - X coordinate of the candidate
+        yCoord - Y coordinate of the candidate
+        dist - Distance from the 'origin' point to the candidate
+        tieKey - Tie key of the candidate: its posNum, or HS_WALL_TIE_KEY() for a wall
+    OUTPUT
+        On success, the number of coord_arr entries in use
+        On failure, -1
+    NOTES
+        Candidates are ranked by (dist, tieKey) so equal distances go to the lower posNum and walls rank after
+            every point.  Every neighbour search that uses this function agrees on the result no matter what
+            order candidates arrive in.
+ */
+int keep_closest_coordinate(hsLineLen_ptr *coord_arr, long long *tieKey_arr, int numSlots, int numFound, int xCoord,
+                            int yCoord, double dist, long long tieKey);
+
+
+/*
+    PURPOSE - Calculate the closest point on each of the field's four walls to a coordinate
+    INPUT
+        curWindow - Pointer to a winDetails struct (the walls are its border, in its own coordinates)
+        xCoord - X coordinate inside the field
+        yCoord - Y coordinate inside the field
+        wall_arr - Out parameter array of four hsLineLen structs: left, right, top and bottom
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        These are the two dimensional equivalent of line intercepts
+ */
+bool calc_two_dim_wall_points(winDetails_ptr curWindow, int xCoord, int yCoord, hsLineLen_ptr wall_arr);
+
+
+/*
+    PURPOSE - Determine the point equidistant from three points, the two dimensional equivalent of a midpoint
+    INPUT
+        curWindow - Pointer to a winDetails struct (used to keep the target inside the field)
+        coord_arr - Array of three hsLineLen struct pointers
+        target_ptr - Out parameter in which to store the target
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The target is the circumcenter of the triangle, rounded to the nearest integer coordinate.  Collinear
+            points have no circumcenter so the target is the midpoint of the two points farthest apart.
+        The target is clamped to the inside of curWindow's border
+ */
+bool determine_triangulation_point(winDetails_ptr curWindow, hsLineLen_ptr *coord_arr, hsLineLen_ptr target_ptr);
+
+
+/*
+    PURPOSE - Decide if moving a point improved its equilibrium with its three closest points
+    INPUT
+        oldCoord_arr - Array of the three points closest to the point before the move, closest first
+        newCoord_arr - Array of the three points closest to the point after the move, closest first
+    OUTPUT
+        If the spread of the three distances (farthest minus closest) shrank by at least one, true
+        Otherwise, false
+        On error, false
+    NOTES
+        Targets are rounded to the lattice and neighbours change as points move so, without a threshold, points
+            can trade places forever.  Demanding a whole step of improvement is the two dimensional equivalent
+            of the one dimensional engines settling within a step of the midpoint.
+ */
+bool is_triangulation_improved(hsLineLen_ptr *oldCoord_arr, hsLineLen_ptr *newCoord_arr);
+
+
 /*
     PURPOSE - Create a linked list of shawarma nodes holding the graph intercepts for sourceNode_ptr, a node
         in headNode_ptr's linked list, within curWindow given the desired dimensions in numDim.
@@ -250,17 +434,20 @@ bool calculate_intercepts(winDetails_ptr curWindow, shawarma_ptr headNode_ptr, s
         curWindow - Pointer to a winDetails struct (used to determine window border points)
         sourceNode_ptr - shawarma struct pointer to use as the 'origin' point to calculate intercepts
         outHeadNode_ptr - Linked list of 'out' parameter nodes in which to store the line intercepts
-        slope - Slope used to determine the intercepts from sourceNode_ptr
+        runX - X component of the line's direction from sourceNode_ptr
+        riseY - Y component of the line's direction from sourceNode_ptr
     OUTPUT
         On success, true
         On failure, false
     NOTES
         On success, outHeadNode_ptr's linked list will be popuplated with the intersections of the
-            line defined by sourceNode_ptr (and it's slope) and curWindow
+            line defined by sourceNode_ptr (and it's direction) and curWindow
+        The direction is the difference between any two points on the line (e.g., the first two nodes).  The
+            intercepts are exact rationals, rounded once (see: solve_int_line_y()), instead of slope math.
 
  */
 bool calculate_line_intercepts(winDetails_ptr curWindow, shawarma_ptr sourceNode_ptr,
-                               shawarma_ptr outHeadNode_ptr, double slope);
+                               shawarma_ptr outHeadNode_ptr, int runX, int riseY);
 
 
 /*
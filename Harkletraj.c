@@ -0,0 +1,834 @@
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harkletraj.h"
+#include <stdlib.h>             // calloc(), free()
+#include <string.h>             // memcmp(), memcpy(), memset()
+
+// Largest encoding of one moved point: index gap, dx and dy
+#define HS_TRAJ_MAX_ENTRY (3 * HS_TRAJ_MAX_VARINT)
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Map a signed value onto an unsigned one so small magnitudes, of either sign, stay small
+        (0, -1, 1, -2, 2, ... become 0, 1, 2, 3, 4, ...)
+    INPUT
+        value - Value to map
+    OUTPUT
+        The zigzag encoded value
+ */
+uint32_t zigzag_traj_value(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+
+/*
+    PURPOSE - Undo zigzag_traj_value()
+    INPUT
+        value - Zigzag encoded value
+    OUTPUT
+        The signed value
+ */
+int32_t unzigzag_traj_value(uint32_t value)
+{
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+
+/*
+    PURPOSE - Encode one varint
+    INPUT
+        buf_ptr - [Out] Buffer with room for at least HS_TRAJ_MAX_VARINT bytes
+        value - Value to encode
+    OUTPUT
+        Number of bytes encoded
+    NOTES
+        This function does not perform input validation
+ */
+size_t encode_traj_varint(unsigned char *buf_ptr, uint32_t value)
+{
+    // LOCAL VARIABLES
+    size_t numBytes = 0;  // Number of bytes encoded
+
+    while (0x80 <= value)
+    {
+        buf_ptr[numBytes] = (unsigned char)(value | 0x80);
+        value >>= 7;
+        numBytes++;
+    }
+    buf_ptr[numBytes] = (unsigned char)value;
+    numBytes++;
+
+    // DONE
+    return numBytes;
+}
+
+
+/*
+    PURPOSE - Read one varint from a trajectory log
+    INPUT
+        inFile - Trajectory log
+        value_ptr - [Out] The decoded value
+        eof_ptr - [Out] Set to true if the log ended before the varint's first byte, false otherwise
+    OUTPUT
+        On success, true
+        If the log ends, or the varint is longer than HS_TRAJ_MAX_VARINT bytes, false
+    NOTES
+        This function does not perform input validation
+ */
+bool read_traj_varint(FILE *inFile, uint32_t *value_ptr, bool *eof_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true once the last byte is read
+    int nextByte = 0;      // Return value from getc()
+    int i = 0;             // Iterating variable
+
+    *value_ptr = 0;
+    *eof_ptr = false;
+
+    for (i = 0; i < HS_TRAJ_MAX_VARINT; i++)
+    {
+        nextByte = getc(inFile);
+
+        if (EOF == nextByte)
+        {
+            *eof_ptr = 0 == i ? true : false;
+            break;
+        }
+
+        *value_ptr |= (uint32_t)(nextByte & 0x7F) << (7 * i);
+
+        if (0 == (nextByte & 0x80))
+        {
+            success = true;
+            break;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Hand the buffer the sweep loop is filling to the writer thread and take a free one
+    INPUT
+        log_ptr - Pointer to a trajectory log
+        takeFree - Set this to false to hand the buffer off without taking another one (e.g., when closing)
+    OUTPUT
+        On success, true
+        If the writer thread failed a write, false
+    NOTES
+        Only waits if every other buffer is waiting to be written
+        This function does not perform input validation
+ */
+bool hand_off_traj_buffer(hsTrajLog_ptr log_ptr, bool takeFree)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if the writer thread failed
+    bool stalled = false; // Set this to true if we had to wait for a free buffer
+
+    pthread_mutex_lock(&(log_ptr->logLock));
+
+    log_ptr->fullQueue[(log_ptr->firstFull + log_ptr->numFull) % HS_TRAJ_NUM_BUFFERS] = log_ptr->fillBuf;
+    log_ptr->numFull++;
+    log_ptr->fillBuf = -1;
+    pthread_cond_signal(&(log_ptr->fullCond));
+
+    while (true == takeFree && 0 == log_ptr->numFree && false == log_ptr->failed)
+    {
+        stalled = true;
+        pthread_cond_wait(&(log_ptr->freeCond), &(log_ptr->logLock));
+    }
+
+    if (true == log_ptr->failed)
+    {
+        success = false;
+    }
+    if (true == takeFree && 0 < log_ptr->numFree)
+    {
+        log_ptr->numFree--;
+        log_ptr->fillBuf = log_ptr->freeStack[log_ptr->numFree];
+        log_ptr->bufUsed[log_ptr->fillBuf] = 0;
+    }
+
+    pthread_mutex_unlock(&(log_ptr->logLock));
+
+    if (true == stalled)
+    {
+        log_ptr->numStalls++;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Make sure the buffer the sweep loop is filling has room to encode numBytes more bytes
+    INPUT
+        log_ptr - Pointer to a trajectory log
+        numBytes - Number of bytes about to be encoded
+    OUTPUT
+        On success, true
+        If the writer thread failed a write, false
+    NOTES
+        This function does not perform input validation
+ */
+bool reserve_traj_space(hsTrajLog_ptr log_ptr, size_t numBytes)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if the buffer couldn't be handed off
+
+    if (HS_TRAJ_BUFFER_SIZE - log_ptr->bufUsed[log_ptr->fillBuf] < numBytes)
+    {
+        success = hand_off_traj_buffer(log_ptr, true);
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Encode one varint into the buffer the sweep loop is filling
+    INPUT
+        log_ptr - Pointer to a trajectory log
+        value - Value to encode
+    OUTPUT
+        None
+    NOTES
+        The caller must have reserved room for it with reserve_traj_space()
+        This function does not perform input validation
+ */
+void append_traj_varint(hsTrajLog_ptr log_ptr, uint32_t value)
+{
+    log_ptr->bufUsed[log_ptr->fillBuf] += encode_traj_varint(log_ptr->buf_arr[log_ptr->fillBuf]
+                                                             + log_ptr->bufUsed[log_ptr->fillBuf], value);
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Write a trajectory log's full buffers, oldest first, until it closes
+    INPUT
+        log_arg - Pointer to the hsTrajLog struct
+    OUTPUT
+        NULL
+    NOTES
+        Every buffer is handed back, even after a failed write, so the sweep loop never waits forever
+ */
+void *write_traj_buffers(void *log_arg)
+{
+    // LOCAL VARIABLES
+    hsTrajLog_ptr log_ptr = (hsTrajLog_ptr)log_arg;  // The log to write
+    int bufNum = 0;                                  // Buffer being written
+    bool failed = false;                             // Local copy of log_ptr->failed
+    bool wrote = false;                              // Set this to true if the buffer was written
+
+    pthread_mutex_lock(&(log_ptr->logLock));
+
+    while (true)
+    {
+        while (0 == log_ptr->numFull && false == log_ptr->shutdown)
+        {
+            pthread_cond_wait(&(log_ptr->fullCond), &(log_ptr->logLock));
+        }
+        if (0 == log_ptr->numFull)
+        {
+            break;  // Closed, and everything has been written
+        }
+
+        bufNum = log_ptr->fullQueue[log_ptr->firstFull];
+        log_ptr->firstFull = (log_ptr->firstFull + 1) % HS_TRAJ_NUM_BUFFERS;
+        log_ptr->numFull--;
+        failed = log_ptr->failed;
+
+        // The sweep loop keeps filling another buffer while this one is written
+        pthread_mutex_unlock(&(log_ptr->logLock));
+        wrote = false;
+        if (false == failed && log_ptr->bufUsed[bufNum] == fwrite(log_ptr->buf_arr[bufNum], 1,
+                                                                  log_ptr->bufUsed[bufNum], log_ptr->outFile))
+        {
+            wrote = true;
+        }
+        pthread_mutex_lock(&(log_ptr->logLock));
+
+        if (true == wrote)
+        {
+            log_ptr->numBytes += (long)log_ptr->bufUsed[bufNum];
+        }
+        else if (false == failed)
+        {
+            HARKLE_ERROR(Harkletraj, write_traj_buffers, fwrite failed);
+            log_ptr->failed = true;
+        }
+        log_ptr->freeStack[log_ptr->numFree] = bufNum;
+        log_ptr->numFree++;
+        pthread_cond_signal(&(log_ptr->freeCond));
+    }
+
+    pthread_mutex_unlock(&(log_ptr->logLock));
+
+    // DONE
+    return NULL;
+}
+
+
+/*
+    PURPOSE - Close a trajectory log's file and free its memory
+    INPUT
+        log_ptr - Pointer to a heap-allocated hsTrajLog struct
+    OUTPUT
+        On success, true
+        If closing the file failed, false
+    NOTES
+        The writer thread must not be running
+        This function does not perform input validation
+ */
+bool free_traj_log_memory(hsTrajLog_ptr log_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if the file didn't close cleanly
+    int i = 0;            // Iterating variable
+
+    if (log_ptr->outFile && 0 != fclose(log_ptr->outFile))
+    {
+        HARKLE_ERROR(Harkletraj, free_traj_log_memory, fclose failed);
+        success = false;
+    }
+    if (log_ptr->prevX)
+    {
+        free(log_ptr->prevX);
+    }
+    if (log_ptr->prevY)
+    {
+        free(log_ptr->prevY);
+    }
+    for (i = 0; i < HS_TRAJ_NUM_BUFFERS; i++)
+    {
+        if (log_ptr->buf_arr[i])
+        {
+            free(log_ptr->buf_arr[i]);
+        }
+    }
+    pthread_cond_destroy(&(log_ptr->freeCond));
+    pthread_cond_destroy(&(log_ptr->fullCond));
+    pthread_mutex_destroy(&(log_ptr->logLock));
+
+    memset(log_ptr, 0x0, sizeof(hsTrajLog));
+    free(log_ptr);
+
+    // DONE
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsTrajLog_ptr open_trajectory_log(char *filename, hsTrajHeader_ptr header_ptr, int *posNum, int *absX, int *absY)
+{
+    // LOCAL VARIABLES
+    hsTrajLog_ptr retVal = NULL;  // Heap-allocated trajectory log
+    bool success = true;          // Set this to false if anything fails
+    hsTrajHeader header;          // Header to write
+    int prevX = 0;                // Previous point's x coordinate
+    int prevY = 0;                // Previous point's y coordinate
+    int i = 0;                    // Iterating variable
+
+    // INPUT VALIDATION
+    if (!filename || !(*filename))
+    {
+        HARKLE_ERROR(Harkletraj, open_trajectory_log, Invalid filename);
+        success = false;
+    }
+    else if (!header_ptr || 1 > header_ptr->numPnts || 0 > header_ptr->firstSweep)
+    {
+        HARKLE_ERROR(Harkletraj, open_trajectory_log, Invalid header_ptr);
+        success = false;
+    }
+    else if (!posNum || !absX || !absY)
+    {
+        HARKLE_ERROR(Harkletraj, open_trajectory_log, Invalid swarm arrays);
+        success = false;
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsTrajLog));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_log, calloc failed);
+            success = false;
+        }
+        else
+        {
+            pthread_mutex_init(&(retVal->logLock), NULL);
+            pthread_cond_init(&(retVal->fullCond), NULL);
+            pthread_cond_init(&(retVal->freeCond), NULL);
+        }
+    }
+    if (true == success)
+    {
+        retVal->numPnts = header_ptr->numPnts;
+        retVal->prevX = calloc(retVal->numPnts, sizeof(int));
+        retVal->prevY = calloc(retVal->numPnts, sizeof(int));
+
+        for (i = 0; i < HS_TRAJ_NUM_BUFFERS; i++)
+        {
+            retVal->buf_arr[i] = calloc(HS_TRAJ_BUFFER_SIZE, sizeof(unsigned char));
+
+            if (!(retVal->buf_arr[i]))
+            {
+                break;
+            }
+        }
+
+        if (!(retVal->prevX) || !(retVal->prevY) || HS_TRAJ_NUM_BUFFERS != i)
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_log, calloc failed);
+            success = false;
+        }
+        else
+        {
+            memcpy(retVal->prevX, absX, retVal->numPnts * sizeof(int));
+            memcpy(retVal->prevY, absY, retVal->numPnts * sizeof(int));
+
+            // The sweep loop starts with the first buffer, the rest are free
+            retVal->fillBuf = 0;
+            for (i = 1; i < HS_TRAJ_NUM_BUFFERS; i++)
+            {
+                retVal->freeStack[retVal->numFree] = i;
+                retVal->numFree++;
+            }
+        }
+    }
+
+    // HEADER
+    if (true == success)
+    {
+        header = *header_ptr;
+        memset(header.magic, 0x0, sizeof(header.magic));
+        memcpy(header.magic, HS_TRAJ_MAGIC, sizeof(HS_TRAJ_MAGIC));
+        header.version = HS_TRAJ_VERSION;
+        header.headerSize = sizeof(hsTrajHeader);
+        header.byteOrder = HS_TRAJ_BYTE_ORDER;
+
+        retVal->outFile = fopen(filename, "wb");
+
+        if (!(retVal->outFile))
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_log, fopen failed);
+            success = false;
+        }
+        else if (1 != fwrite(&header, sizeof(header), 1, retVal->outFile))
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_log, fwrite failed);
+            success = false;
+        }
+        else
+        {
+            retVal->numBytes = sizeof(header);
+        }
+    }
+
+    // START
+    if (true == success)
+    {
+        if (0 != pthread_create(&(retVal->thread), NULL, write_traj_buffers, retVal))
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_log, pthread_create failed);
+            success = false;
+        }
+        else
+        {
+            retVal->started = true;
+        }
+    }
+
+    // KEYFRAME
+    for (i = 0; true == success && i < retVal->numPnts; i++)
+    {
+        success = reserve_traj_space(retVal, HS_TRAJ_MAX_ENTRY);
+
+        if (true == success)
+        {
+            append_traj_varint(retVal, (uint32_t)posNum[i]);
+            append_traj_varint(retVal, zigzag_traj_value(absX[i] - prevX));
+            append_traj_varint(retVal, zigzag_traj_value(absY[i] - prevY));
+            prevX = absX[i];
+            prevY = absY[i];
+        }
+        else
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_log, Failed to log the keyframe);
+        }
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        if (true == retVal->started)
+        {
+            close_trajectory_log(&retVal);
+        }
+        else
+        {
+            free_traj_log_memory(retVal);
+        }
+        retVal = NULL;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool log_trajectory_sweep(hsTrajLog_ptr log_ptr, int *absX, int *absY)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    int lastIndex = -1;   // Index of the last point logged this sweep
+    int i = 0;            // Iterating variable
+
+    // INPUT VALIDATION
+    if (!log_ptr || -1 == log_ptr->fillBuf)
+    {
+        HARKLE_ERROR(Harkletraj, log_trajectory_sweep, Invalid log_ptr);
+        success = false;
+    }
+    else if (!absX || !absY)
+    {
+        HARKLE_ERROR(Harkletraj, log_trajectory_sweep, Invalid swarm arrays);
+        success = false;
+    }
+
+    // LOG IT
+    for (i = 0; true == success && i < log_ptr->numPnts; i++)
+    {
+        if (absX[i] != log_ptr->prevX[i] || absY[i] != log_ptr->prevY[i])
+        {
+            success = reserve_traj_space(log_ptr, HS_TRAJ_MAX_ENTRY);
+
+            if (true == success)
+            {
+                append_traj_varint(log_ptr, (uint32_t)(i - lastIndex));
+                append_traj_varint(log_ptr, zigzag_traj_value(absX[i] - log_ptr->prevX[i]));
+                append_traj_varint(log_ptr, zigzag_traj_value(absY[i] - log_ptr->prevY[i]));
+                log_ptr->prevX[i] = absX[i];
+                log_ptr->prevY[i] = absY[i];
+                log_ptr->numEntries++;
+                lastIndex = i;
+            }
+        }
+    }
+
+    // END THE RECORD
+    if (true == success)
+    {
+        success = reserve_traj_space(log_ptr, 1);
+
+        if (true == success)
+        {
+            append_traj_varint(log_ptr, 0);
+            log_ptr->numSweeps++;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool close_trajectory_log(hsTrajLog_ptr *oldLog_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;           // Set this to true if everything logged was written
+    hsTrajLog_ptr log_ptr = NULL;   // Local copy of *oldLog_ptr
+
+    // INPUT VALIDATION
+    if (!oldLog_ptr || !(*oldLog_ptr))
+    {
+        HARKLE_ERROR(Harkletraj, close_trajectory_log, Invalid oldLog_ptr);
+    }
+    else
+    {
+        log_ptr = *oldLog_ptr;
+
+        // STOP
+        if (true == log_ptr->started)
+        {
+            if (-1 != log_ptr->fillBuf && 0 < log_ptr->bufUsed[log_ptr->fillBuf])
+            {
+                hand_off_traj_buffer(log_ptr, false);
+            }
+
+            pthread_mutex_lock(&(log_ptr->logLock));
+            log_ptr->shutdown = true;
+            pthread_cond_signal(&(log_ptr->fullCond));
+            pthread_mutex_unlock(&(log_ptr->logLock));
+
+            pthread_join(log_ptr->thread, NULL);
+            log_ptr->started = false;
+        }
+        success = !(log_ptr->failed);
+
+        // FREE
+        if (false == free_traj_log_memory(log_ptr))
+        {
+            success = false;
+        }
+        *oldLog_ptr = NULL;
+    }
+
+    // DONE
+    return success;
+}
+
+
+hsTrajReader_ptr open_trajectory_reader(char *filename)
+{
+    // LOCAL VARIABLES
+    hsTrajReader_ptr retVal = NULL;  // Heap-allocated trajectory reader
+    bool success = true;             // Set this to false if anything fails
+    uint32_t value_arr[3];           // One keyframe entry: posNum, x delta and y delta
+    bool atEof = false;              // Set to true by read_traj_varint() if the log ended
+    int prevX = 0;                   // Previous point's x coordinate
+    int prevY = 0;                   // Previous point's y coordinate
+    int i = 0;                       // Iterating variable
+    int j = 0;                       // Iterating variable
+
+    // INPUT VALIDATION
+    if (!filename || !(*filename))
+    {
+        HARKLE_ERROR(Harkletraj, open_trajectory_reader, Invalid filename);
+        success = false;
+    }
+
+    // OPEN IT
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsTrajReader));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, calloc failed);
+            success = false;
+        }
+    }
+    if (true == success)
+    {
+        retVal->inFile = fopen(filename, "rb");
+
+        if (!(retVal->inFile))
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, fopen failed);
+            success = false;
+        }
+        else if (1 != fread(&(retVal->header), sizeof(hsTrajHeader), 1, retVal->inFile))
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, File is too small to be a trajectory log);
+            success = false;
+        }
+    }
+
+    // VALIDATE THE HEADER
+    if (true == success)
+    {
+        if (0 != memcmp(retVal->header.magic, HS_TRAJ_MAGIC, sizeof(HS_TRAJ_MAGIC)))
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, Not a trajectory log);
+            success = false;
+        }
+        else if (HS_TRAJ_BYTE_ORDER != retVal->header.byteOrder)
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, Trajectory log was written with a different byte order);
+            success = false;
+        }
+        else if (HS_TRAJ_VERSION != retVal->header.version || sizeof(hsTrajHeader) != retVal->header.headerSize)
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, Unsupported trajectory log version);
+            success = false;
+        }
+        else if (1 > retVal->header.numPnts || 0 > retVal->header.firstSweep)
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, Invalid trajectory log header);
+            success = false;
+        }
+    }
+
+    // READ THE KEYFRAME
+    if (true == success)
+    {
+        retVal->posNum = calloc(retVal->header.numPnts, sizeof(int));
+        retVal->absX = calloc(retVal->header.numPnts, sizeof(int));
+        retVal->absY = calloc(retVal->header.numPnts, sizeof(int));
+
+        if (!(retVal->posNum) || !(retVal->absX) || !(retVal->absY))
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, calloc failed);
+            success = false;
+        }
+    }
+    for (i = 0; true == success && i < retVal->header.numPnts; i++)
+    {
+        for (j = 0; true == success && j < 3; j++)
+        {
+            success = read_traj_varint(retVal->inFile, &(value_arr[j]), &atEof);
+        }
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkletraj, open_trajectory_reader, Trajectory log is truncated or corrupt);
+        }
+        else
+        {
+            retVal->posNum[i] = (int)value_arr[0];
+            prevX += unzigzag_traj_value(value_arr[1]);
+            prevY += unzigzag_traj_value(value_arr[2]);
+            retVal->absX[i] = prevX;
+            retVal->absY[i] = prevY;
+        }
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        close_trajectory_reader(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int replay_trajectory_sweep(hsTrajReader_ptr reader_ptr)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;           // Number of points that moved
+    bool success = true;       // Set this to false if anything fails
+    uint32_t gap = 0;          // Distance, in indices, to the next moved point (0 ends the record)
+    uint32_t value_arr[2];     // dx and dy, zigzag encoded
+    int index = -1;            // Index of the moved point
+    int deltaX = 0;            // How far it moved along x
+    int deltaY = 0;            // How far it moved along y
+    int numMoved = 0;          // Number of points that moved
+    bool atEof = false;        // Set to true by read_traj_varint() if the log ended
+
+    // INPUT VALIDATION
+    if (!reader_ptr || !(reader_ptr->inFile))
+    {
+        HARKLE_ERROR(Harkletraj, replay_trajectory_sweep, Invalid reader_ptr);
+        success = false;
+    }
+    else if (true == reader_ptr->atEnd)
+    {
+        success = false;  // Nothing left to replay
+    }
+
+    // REPLAY
+    if (true == success)
+    {
+        success = read_traj_varint(reader_ptr->inFile, &gap, &atEof);
+
+        if (false == success && true == atEof)
+        {
+            reader_ptr->atEnd = true;  // A clean end only falls between records
+        }
+    }
+    while (true == success && 0 != gap)
+    {
+        if ((uint32_t)(reader_ptr->header.numPnts - 1 - index) < gap)
+        {
+            success = false;
+            break;
+        }
+
+        index += (int)gap;
+        success = read_traj_varint(reader_ptr->inFile, &(value_arr[0]), &atEof)
+                  && read_traj_varint(reader_ptr->inFile, &(value_arr[1]), &atEof);
+
+        if (true == success)
+        {
+            deltaX = unzigzag_traj_value(value_arr[0]);
+            deltaY = unzigzag_traj_value(value_arr[1]);
+            reader_ptr->absX[index] += deltaX;
+            reader_ptr->absY[index] += deltaY;
+            reader_ptr->displacement += (0 > deltaX ? -deltaX : deltaX) + (0 > deltaY ? -deltaY : deltaY);
+            numMoved++;
+            success = read_traj_varint(reader_ptr->inFile, &gap, &atEof);
+        }
+    }
+
+    if (true == success)
+    {
+        reader_ptr->numSweeps++;
+        reader_ptr->numEntries += numMoved;
+        retVal = numMoved;
+    }
+    else if (reader_ptr && false == reader_ptr->atEnd)
+    {
+        HARKLE_ERROR(Harkletraj, replay_trajectory_sweep, Trajectory log is truncated or corrupt);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool close_trajectory_reader(hsTrajReader_ptr *oldReader_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;                // Set this to true if the reader is closed
+    hsTrajReader_ptr reader_ptr = NULL;  // Local copy of *oldReader_ptr
+
+    // INPUT VALIDATION
+    if (!oldReader_ptr || !(*oldReader_ptr))
+    {
+        HARKLE_ERROR(Harkletraj, close_trajectory_reader, Invalid oldReader_ptr);
+    }
+    else
+    {
+        // CLOSE
+        reader_ptr = *oldReader_ptr;
+        success = true;
+
+        if (reader_ptr->inFile && 0 != fclose(reader_ptr->inFile))
+        {
+            HARKLE_ERROR(Harkletraj, close_trajectory_reader, fclose failed);
+            success = false;
+        }
+
+        // FREE
+        if (reader_ptr->posNum)
+        {
+            free(reader_ptr->posNum);
+        }
+        if (reader_ptr->absX)
+        {
+            free(reader_ptr->absX);
+        }
+        if (reader_ptr->absY)
+        {
+            free(reader_ptr->absY);
+        }
+
+        memset(reader_ptr, 0x0, sizeof(hsTrajReader));
+        free(reader_ptr);
+        *oldReader_ptr = NULL;
+    }
+
+    // DONE
+    return success;
+}
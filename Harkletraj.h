@@ -0,0 +1,176 @@
+#ifndef __HARKLETRAJ__
+#define __HARKLETRAJ__
+
+#include <pthread.h>            // pthread_t, pthread_mutex_t, pthread_cond_t
+#include <stdbool.h>            // bool, true, false
+#include <stdint.h>             // int32_t, uint32_t
+#include <stdio.h>              // FILE
+
+// Identifies a trajectory log (the terminating nul byte is part of the magic)
+#define HS_TRAJ_MAGIC "HSWTRAJ"
+// Incremented whenever the encoding of a trajectory log changes
+#define HS_TRAJ_VERSION 1
+// Written as-is so a log from a machine with the other byte order is rejected instead of misread
+#define HS_TRAJ_BYTE_ORDER 0x01020304
+// Size of each of a trajectory log's buffers
+#define HS_TRAJ_BUFFER_SIZE (1 << 20)
+// Number of buffers the sweep loop and the writer thread pass back and forth
+#define HS_TRAJ_NUM_BUFFERS 4
+// Largest encoding of one varint
+#define HS_TRAJ_MAX_VARINT 5
+
+// Defines the fixed-layout header at the start of every trajectory log
+//  The header is followed by a keyframe and then one record per sweep, all varint encoded (7 bits per byte,
+//  least significant group first, high bit set on every byte but the last).  Signed values are zigzag
+//  encoded first so small negative numbers stay small.
+//      Keyframe - For every point, in array order: posNum, then x and y as the difference from the previous
+//          point's x and y (the first point's from 0)
+//      Sweep record - For every point that moved, in ascending index order: the difference between its
+//          index and the previous moved point's index (the first from -1, so always at least 1), then dx and
+//          dy.  A 0 ends the record so a sweep where nothing moved is a single byte.
+typedef struct hsTrajectoryHeader
+{
+    char magic[8];            // HS_TRAJ_MAGIC
+    uint32_t version;         // HS_TRAJ_VERSION
+    uint32_t headerSize;      // sizeof(hsTrajHeader)
+    uint32_t byteOrder;       // HS_TRAJ_BYTE_ORDER
+    int32_t numRows;          // Number of rows (y) in the field
+    int32_t numCols;          // Number of columns (x) in the field
+    int32_t engine;           // Engine that swarmed it (e.g., HEADLESS_ENGINE_*)
+    int32_t numPnts;          // Number of points in the swarm
+    int32_t firstSweep;       // Number of sweeps made before the keyframe (e.g., by a resumed run)
+} hsTrajHeader, *hsTrajHeader_ptr;
+
+// Defines the struct that streams a swarm's moves to a trajectory log without stalling the sweep loop
+//  The sweep loop encodes each sweep into the buffer it's filling and, once that buffer can't hold another
+//  move, hands it to a writer thread and takes a free one.  The writer thread does every write to the file.
+//  The sweep loop only waits if the writer falls HS_TRAJ_NUM_BUFFERS buffers behind (see: numStalls).
+typedef struct hsTrajectoryLog
+{
+    FILE *outFile;                // Trajectory log (written by the writer thread once it starts)
+    int numPnts;                  // Number of points in the swarm
+    int *prevX;                   // numPnts x coordinates as of the last sweep logged (sweep loop only)
+    int *prevY;                   // numPnts y coordinates as of the last sweep logged (sweep loop only)
+    unsigned char *buf_arr[HS_TRAJ_NUM_BUFFERS];  // HS_TRAJ_NUM_BUFFERS buffers of HS_TRAJ_BUFFER_SIZE bytes
+    size_t bufUsed[HS_TRAJ_NUM_BUFFERS];          // Number of bytes encoded into each buffer
+    int fillBuf;                  // Buffer the sweep loop is filling (sweep loop only)
+    long numSweeps;               // Number of sweeps logged (sweep loop only)
+    long numEntries;              // Number of moved points logged, across every sweep (sweep loop only)
+    long numStalls;               // Number of times the sweep loop waited for a free buffer (sweep loop only)
+    pthread_t thread;             // Writer thread
+    bool started;                 // Set to true once the writer thread is running
+    pthread_mutex_t logLock;      // Protects every member below
+    pthread_cond_t fullCond;      // Signalled when a buffer is handed to the writer (or the log closes)
+    pthread_cond_t freeCond;      // Signalled when the writer finishes with a buffer
+    int fullQueue[HS_TRAJ_NUM_BUFFERS];  // Buffers waiting to be written, a circular FIFO
+    int firstFull;                // Index, in fullQueue, of the oldest full buffer
+    int numFull;                  // Number of buffers in fullQueue
+    int freeStack[HS_TRAJ_NUM_BUFFERS];  // Buffers ready to be filled
+    int numFree;                  // Number of buffers in freeStack
+    long numBytes;                // Number of bytes written to the file, header included
+    bool shutdown;                // Set this to true to write the remaining buffers and end the writer thread
+    bool failed;                  // Set to true by the writer thread if a write fails
+} hsTrajLog, *hsTrajLog_ptr;
+
+// Defines the struct that replays a trajectory log
+typedef struct hsTrajectoryReader
+{
+    FILE *inFile;             // Trajectory log
+    hsTrajHeader header;      // The log's header
+    int *posNum;              // header.numPnts posNums, from the keyframe
+    int *absX;                // header.numPnts x coordinates as of the last sweep replayed
+    int *absY;                // header.numPnts y coordinates as of the last sweep replayed
+    long numSweeps;           // Number of sweeps replayed
+    long numEntries;          // Number of moved points replayed, across every sweep
+    long long displacement;   // Sum of |dx| + |dy| across every moved point replayed
+    bool atEnd;               // Set to true once the last sweep has been replayed
+} hsTrajReader, *hsTrajReader_ptr;
+
+
+/*
+    PURPOSE - Create a trajectory log and start its writer thread
+    INPUT
+        filename - Trajectory log to write
+        header_ptr - Pointer to a header describing the run (numRows, numCols, engine, numPnts and firstSweep are
+            used, the rest is filled in)
+        posNum - numPnts posNums
+        absX - numPnts x coordinates at the start of the run
+        absY - numPnts y coordinates at the start of the run
+    OUTPUT
+        On success, pointer to a heap-allocated hsTrajLog struct
+        On failure, NULL
+    NOTES
+        The header is written, and the keyframe logged, before this function returns
+        It is the caller's responsibility to stop the thread and free the memory with close_trajectory_log()
+ */
+hsTrajLog_ptr open_trajectory_log(char *filename, hsTrajHeader_ptr header_ptr, int *posNum, int *absX, int *absY);
+
+
+/*
+    PURPOSE - Log every point that moved since the last sweep logged
+    INPUT
+        log_ptr - Pointer to a trajectory log
+        absX - numPnts x coordinates after the sweep
+        absY - numPnts y coordinates after the sweep
+    OUTPUT
+        On success, true
+        On failure (including a failed write), false
+    NOTES
+        Points must stay at the same array index for the whole run
+        Only call this function from the thread that opened the log
+ */
+bool log_trajectory_sweep(hsTrajLog_ptr log_ptr, int *absX, int *absY);
+
+
+/*
+    PURPOSE - Write everything logged, stop the writer thread and free the heap-allocated memory associated
+        with a trajectory log
+    INPUT
+        oldLog_ptr - A pointer to a heap-allocated hsTrajLog struct pointer
+    OUTPUT
+        On success, true
+        On failure (including any failed write), false
+    NOTES
+        Call this function as close_trajectory_log(&myLog_ptr);
+ */
+bool close_trajectory_log(hsTrajLog_ptr *oldLog_ptr);
+
+
+/*
+    PURPOSE - Open a trajectory log and read its header and keyframe
+    INPUT
+        filename - Trajectory log to read
+    OUTPUT
+        On success, pointer to a heap-allocated hsTrajReader struct (absX and absY hold the keyframe)
+        On failure, NULL
+    NOTES
+        It is the caller's responsibility to close the file and free the memory with close_trajectory_reader()
+ */
+hsTrajReader_ptr open_trajectory_reader(char *filename);
+
+
+/*
+    PURPOSE - Apply the next sweep of a trajectory log to a reader's coordinates
+    INPUT
+        reader_ptr - Pointer to a trajectory reader
+    OUTPUT
+        On success, the number of points that moved in the sweep
+        On failure, or once every sweep has been replayed, -1 (check reader_ptr->atEnd to tell which)
+ */
+int replay_trajectory_sweep(hsTrajReader_ptr reader_ptr);
+
+
+/*
+    PURPOSE - Close a trajectory log and free the heap-allocated memory associated with a reader
+    INPUT
+        oldReader_ptr - A pointer to a heap-allocated hsTrajReader struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Call this function as close_trajectory_reader(&myReader_ptr);
+ */
+bool close_trajectory_reader(hsTrajReader_ptr *oldReader_ptr);
+
+
+#endif  // __HARKLETRAJ__
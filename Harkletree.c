@@ -0,0 +1,1407 @@
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harklestore.h"
+#include "Harkleswarm.h"
+#include "Harkletree.h"
+#include <limits.h>             // INT_MAX, INT_MIN
+#include <math.h>               // sqrt()
+#include <stdlib.h>             // calloc(), free(), malloc(), realloc()
+#include <string.h>             // memcpy(), memmove(), memset()
+
+
+// Defines the state of one find_kd_neighbours() query
+typedef struct hsKDSearch
+{
+    int *query_arr;           // Coordinates to measure distance from
+    int skipID;               // ID to ignore (-1 for none)
+    int sideDim;              // Dimension to constrain to one side of query_arr (-1 for none)
+    int sideSign;             // -1 for below query_arr[sideDim], 1 for above it
+    int numNeighbours;        // Capacity of id_arr and sqDist_arr
+    int numFound;             // Number of entries populated in id_arr and sqDist_arr
+    int *id_arr;              // IDs found so far, closest first
+    long long *sqDist_arr;    // Squared distances of id_arr
+} hsKDSearch, *hsKDSearch_ptr;
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Grow a k-d tree's per-ID arrays so they can hold a given ID
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        id - ID the arrays must be able to hold
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        New IDs are marked absent (see: leafOf)
+        This function does not perform input validation
+ */
+bool reserve_kd_ids(hsKDTree_ptr tree_ptr, int id)
+{
+    // LOCAL VARIABLES
+    bool success = true;      // Set this to false if anything fails
+    int newMax = 0;           // New capacity
+    int *tmp_ptr = NULL;      // Return value from realloc()
+    int i = 0;                // Iterating variable
+
+    if (id >= tree_ptr->maxIDs)
+    {
+        newMax = (tree_ptr->maxIDs > 0) ? tree_ptr->maxIDs : HS_TREE_LEAF_POINTS;
+
+        while (newMax <= id)
+        {
+            newMax *= 2;
+        }
+
+        tmp_ptr = realloc(tree_ptr->coord, (size_t)newMax * tree_ptr->numDim * sizeof(int));
+
+        if (!tmp_ptr)
+        {
+            success = false;
+        }
+        else
+        {
+            tree_ptr->coord = tmp_ptr;
+            tmp_ptr = realloc(tree_ptr->leafOf, (size_t)newMax * sizeof(int));
+        }
+        if (true == success && !tmp_ptr)
+        {
+            success = false;
+        }
+        else if (true == success)
+        {
+            tree_ptr->leafOf = tmp_ptr;
+            tmp_ptr = realloc(tree_ptr->slotOf, (size_t)newMax * sizeof(int));
+        }
+        if (true == success && !tmp_ptr)
+        {
+            success = false;
+        }
+        else if (true == success)
+        {
+            tree_ptr->slotOf = tmp_ptr;
+
+            for (i = tree_ptr->maxIDs; i < newMax; i++)
+            {
+                tree_ptr->leafOf[i] = -1;
+                tree_ptr->slotOf[i] = -1;
+            }
+
+            tree_ptr->maxIDs = newMax;
+        }
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkletree, reserve_kd_ids, realloc failed);
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Append an empty leaf to a k-d tree's nodes
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        parent - Node index of the new node's parent (-1 for the root)
+    OUTPUT
+        On success, node index of the new leaf.  It covers its parent's box (or everything, for the root).
+        On failure, -1
+    NOTES
+        This may move node_arr so don't hold hsKDNode pointers across calls
+        This function does not perform input validation
+ */
+int add_kd_node(hsKDTree_ptr tree_ptr, int parent)
+{
+    // LOCAL VARIABLES
+    int retVal = -1;                 // Node index of the new node
+    int newMax = 0;                  // New capacity
+    hsKDNode_ptr tmp_ptr = NULL;     // Return value from realloc()
+    hsKDNode_ptr node_ptr = NULL;    // The new node
+    int i = 0;                       // Iterating variable
+
+    // GROW
+    if (tree_ptr->numNodes == tree_ptr->maxNodes)
+    {
+        newMax = (tree_ptr->maxNodes > 0) ? tree_ptr->maxNodes * 2 : 16;
+        tmp_ptr = realloc(tree_ptr->node_arr, (size_t)newMax * sizeof(hsKDNode));
+
+        if (!tmp_ptr)
+        {
+            HARKLE_ERROR(Harkletree, add_kd_node, realloc failed);
+        }
+        else
+        {
+            tree_ptr->node_arr = tmp_ptr;
+            tree_ptr->maxNodes = newMax;
+        }
+    }
+
+    // INITIALIZE
+    if (tree_ptr->numNodes < tree_ptr->maxNodes)
+    {
+        retVal = tree_ptr->numNodes;
+        tree_ptr->numNodes++;
+        node_ptr = &(tree_ptr->node_arr[retVal]);
+        memset(node_ptr, 0x0, sizeof(hsKDNode));
+        node_ptr->parent = parent;
+        node_ptr->lowChild = -1;
+        node_ptr->highChild = -1;
+        node_ptr->splitDim = -1;
+
+        if (-1 == parent)
+        {
+            for (i = 0; i < tree_ptr->numDim; i++)
+            {
+                node_ptr->lo[i] = INT_MIN;
+                node_ptr->hi[i] = INT_MAX;
+            }
+        }
+        else
+        {
+            node_ptr->depth = tree_ptr->node_arr[parent].depth + 1;
+            memcpy(node_ptr->lo, tree_ptr->node_arr[parent].lo, sizeof(node_ptr->lo));
+            memcpy(node_ptr->hi, tree_ptr->node_arr[parent].hi, sizeof(node_ptr->hi));
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Determine if a node's box holds a point's current coordinates
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        node - Node index
+        id - ID of the point
+    OUTPUT
+        If so, true
+        Otherwise, false
+    NOTES
+        This function does not perform input validation
+ */
+bool is_kd_point_in_node(hsKDTree_ptr tree_ptr, int node, int id)
+{
+    // LOCAL VARIABLES
+    bool retVal = true;                                                  // Set this to false if any dimension is outside
+    int *coord_ptr = tree_ptr->coord + ((size_t)id * tree_ptr->numDim);  // The point's coordinates
+    hsKDNode_ptr node_ptr = &(tree_ptr->node_arr[node]);                 // The node
+    int i = 0;                                                           // Iterating variable
+
+    for (i = 0; i < tree_ptr->numDim && true == retVal; i++)
+    {
+        if (coord_ptr[i] < node_ptr->lo[i] || coord_ptr[i] > node_ptr->hi[i])
+        {
+            retVal = false;
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Add a point to a leaf that has room for it
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        leaf - Node index of a leaf with fewer than HS_TREE_LEAF_POINTS points
+        id - ID of the point
+    OUTPUT
+        None
+    NOTES
+        This function does not perform input validation
+ */
+void place_kd_point(hsKDTree_ptr tree_ptr, int leaf, int id)
+{
+    // LOCAL VARIABLES
+    hsKDNode_ptr leaf_ptr = &(tree_ptr->node_arr[leaf]);  // The leaf
+
+    leaf_ptr->leafPnt[leaf_ptr->numLeafPnts] = id;
+    tree_ptr->leafOf[id] = leaf;
+    tree_ptr->slotOf[id] = leaf_ptr->numLeafPnts;
+    leaf_ptr->numLeafPnts++;
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Take a point out of its leaf
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        id - ID of a point in the tree
+    OUTPUT
+        None
+    NOTES
+        The leaf's last point takes the removed point's slot so this is O(1)
+        This function does not perform input validation
+ */
+void drop_kd_point(hsKDTree_ptr tree_ptr, int id)
+{
+    // LOCAL VARIABLES
+    hsKDNode_ptr leaf_ptr = &(tree_ptr->node_arr[tree_ptr->leafOf[id]]);  // The point's leaf
+    int slot = tree_ptr->slotOf[id];                                    // The point's slot
+    int lastID = leaf_ptr->leafPnt[leaf_ptr->numLeafPnts - 1];          // The leaf's last point
+
+    leaf_ptr->leafPnt[slot] = lastID;
+    tree_ptr->slotOf[lastID] = slot;
+    leaf_ptr->numLeafPnts--;
+    tree_ptr->leafOf[id] = -1;
+    tree_ptr->slotOf[id] = -1;
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Find the nth smallest value in an array
+    INPUT
+        val_arr - Array of values (reordered in place)
+        numVals - Number of values in val_arr
+        nth - Zero-based rank of the value to find
+    OUTPUT
+        The nth smallest value
+    NOTES
+        Quickselect: O(numVals) expected
+        This function does not perform input validation
+ */
+int select_kd_value(int *val_arr, int numVals, int nth)
+{
+    // LOCAL VARIABLES
+    int left = 0;              // Lowest index still in play
+    int right = numVals - 1;   // Highest index still in play
+    int pivot = 0;             // Partition value
+    int i = 0;                 // Scans up from left
+    int j = 0;                 // Scans down from right
+    int tmpVal = 0;            // Swap space
+
+    while (left < right)
+    {
+        pivot = val_arr[left + ((right - left) / 2)];
+        i = left;
+        j = right;
+
+        while (i <= j)
+        {
+            while (val_arr[i] < pivot)
+            {
+                i++;
+            }
+            while (val_arr[j] > pivot)
+            {
+                j--;
+            }
+            if (i <= j)
+            {
+                tmpVal = val_arr[i];
+                val_arr[i] = val_arr[j];
+                val_arr[j] = tmpVal;
+                i++;
+                j--;
+            }
+        }
+
+        if (nth <= j)
+        {
+            right = j;
+        }
+        else if (nth >= i)
+        {
+            left = i;
+        }
+        else
+        {
+            break;  // Everything between j and i equals the pivot
+        }
+    }
+
+    // DONE
+    return val_arr[nth];
+}
+
+
+/*
+    PURPOSE - Choose the split for a set of points: the median of the dimension they are most spread out in
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        id_arr - IDs of the points
+        numIDs - Number of IDs in id_arr (at least two)
+        val_arr - Scratch space for numIDs values
+        splitDim_ptr - [Out] Dimension to split on
+        splitVal_ptr - [Out] Smallest coordinate, in *splitDim_ptr, that goes high
+    OUTPUT
+        On success, true.  At least one point goes each way.
+        On failure (every point shares the same coordinates), false
+    NOTES
+        This function does not perform input validation
+ */
+bool choose_kd_split(hsKDTree_ptr tree_ptr, int *id_arr, int numIDs, int *val_arr, int *splitDim_ptr,
+                     int *splitVal_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;       // Set this to true once a split is found
+    int numDim = tree_ptr->numDim;  // Number of dimensions
+    long long spread = 0;       // Widest spread found so far
+    long long tmpSpread = 0;    // Spread of the current dimension
+    int minVal = 0;             // Smallest coordinate in the current dimension
+    int maxVal = 0;             // Largest coordinate in the current dimension
+    int splitDim = 0;           // Dimension with the widest spread
+    int splitVal = 0;           // Median coordinate in splitDim
+    int nextVal = INT_MAX;      // Smallest coordinate above the minimum
+    int tmpVal = 0;             // Current coordinate
+    int i = 0;                  // Iterating variable
+    int dim = 0;                // Iterating variable
+
+    // 1. Find the widest dimension
+    for (dim = 0; dim < numDim; dim++)
+    {
+        minVal = tree_ptr->coord[(size_t)id_arr[0] * numDim + dim];
+        maxVal = minVal;
+
+        for (i = 1; i < numIDs; i++)
+        {
+            tmpVal = tree_ptr->coord[(size_t)id_arr[i] * numDim + dim];
+
+            if (tmpVal < minVal)
+            {
+                minVal = tmpVal;
+            }
+            else if (tmpVal > maxVal)
+            {
+                maxVal = tmpVal;
+            }
+        }
+
+        tmpSpread = (long long)maxVal - minVal;
+
+        if (tmpSpread > spread)
+        {
+            spread = tmpSpread;
+            splitDim = dim;
+        }
+    }
+
+    // 2. Split at its median
+    if (0 < spread)
+    {
+        success = true;
+        minVal = INT_MAX;
+
+        for (i = 0; i < numIDs; i++)
+        {
+            val_arr[i] = tree_ptr->coord[(size_t)id_arr[i] * numDim + splitDim];
+
+            if (val_arr[i] < minVal)
+            {
+                minVal = val_arr[i];
+            }
+        }
+
+        splitVal = select_kd_value(val_arr, numIDs, numIDs / 2);
+
+        // Nothing would go low so split just above the minimum instead
+        if (splitVal == minVal)
+        {
+            for (i = 0; i < numIDs; i++)
+            {
+                if (val_arr[i] > minVal && val_arr[i] < nextVal)
+                {
+                    nextVal = val_arr[i];
+                }
+            }
+
+            splitVal = nextVal;
+        }
+
+        *splitDim_ptr = splitDim;
+        *splitVal_ptr = splitVal;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Reorder IDs so the points below a split come first
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        id_arr - IDs of the points (reordered in place)
+        numIDs - Number of IDs in id_arr
+        splitDim - Dimension to split on
+        splitVal - Smallest coordinate, in splitDim, that goes high
+    OUTPUT
+        Number of IDs below the split
+    NOTES
+        This function does not perform input validation
+ */
+int partition_kd_ids(hsKDTree_ptr tree_ptr, int *id_arr, int numIDs, int splitDim, int splitVal)
+{
+    // LOCAL VARIABLES
+    int numLow = 0;    // Number of IDs moved to the front
+    int tmpID = 0;     // Swap space
+    int i = 0;         // Iterating variable
+
+    for (i = 0; i < numIDs; i++)
+    {
+        if (tree_ptr->coord[(size_t)id_arr[i] * tree_ptr->numDim + splitDim] < splitVal)
+        {
+            tmpID = id_arr[i];
+            id_arr[i] = id_arr[numLow];
+            id_arr[numLow] = tmpID;
+            numLow++;
+        }
+    }
+
+    // DONE
+    return numLow;
+}
+
+
+/*
+    PURPOSE - Turn a leaf into an internal node with two child leaves
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        node - Node index of a leaf
+        splitDim - Dimension to split on
+        splitVal - Smallest coordinate, in splitDim, that goes high
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The node's points are not redistributed
+        This function does not perform input validation
+ */
+bool split_kd_node(hsKDTree_ptr tree_ptr, int node, int splitDim, int splitVal)
+{
+    // LOCAL VARIABLES
+    bool success = true;    // Set this to false if anything fails
+    int lowChild = -1;      // Node index of the low child
+    int highChild = -1;     // Node index of the high child
+
+    lowChild = add_kd_node(tree_ptr, node);
+    highChild = add_kd_node(tree_ptr, node);
+
+    if (-1 == lowChild || -1 == highChild)
+    {
+        HARKLE_ERROR(Harkletree, split_kd_node, add_kd_node failed);
+        success = false;
+    }
+    else
+    {
+        tree_ptr->node_arr[node].lowChild = lowChild;
+        tree_ptr->node_arr[node].highChild = highChild;
+        tree_ptr->node_arr[node].splitDim = splitDim;
+        tree_ptr->node_arr[node].splitVal = splitVal;
+        tree_ptr->node_arr[node].numLeafPnts = 0;
+        tree_ptr->node_arr[lowChild].hi[splitDim] = splitVal - 1;
+        tree_ptr->node_arr[highChild].lo[splitDim] = splitVal;
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Calculate the most levels a k-d tree of a given size should have before it is rebuilt
+    INPUT
+        numPnts - Number of points in the tree
+    OUTPUT
+        Depth limit
+ */
+int calc_kd_depth_limit(int numPnts)
+{
+    // LOCAL VARIABLES
+    int numLevels = 0;         // Levels of a balanced tree
+    long long numLeaves = 1;   // Leaves of a balanced tree
+
+    while (numLeaves * HS_TREE_LEAF_POINTS < numPnts)
+    {
+        numLeaves *= 2;
+        numLevels++;
+    }
+
+    // DONE
+    return numLevels + 1 + HS_TREE_DEPTH_SLACK;
+}
+
+
+/*
+    PURPOSE - Add a point to the leaf under a node that covers it, splitting the leaf if it's full
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        node - Node index to descend from (its box must hold the point's coordinates)
+        id - ID of a point that isn't in any leaf
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Marks the tree stale if the split makes it too deep, or too sparse
+        This function does not perform input validation
+ */
+bool insert_kd_leaf(hsKDTree_ptr tree_ptr, int node, int id)
+{
+    // LOCAL VARIABLES
+    bool success = true;                          // Set this to false if anything fails
+    int leaf = node;                              // Leaf holding the point's coordinates
+    int *coord_ptr = tree_ptr->coord + ((size_t)id * tree_ptr->numDim);  // The point's coordinates
+    hsKDNode_ptr node_ptr = NULL;                 // Current node
+    int id_arr[HS_TREE_LEAF_POINTS + 1] = { 0 };  // The full leaf's points, plus this one
+    int val_arr[HS_TREE_LEAF_POINTS + 1] = { 0 }; // Scratch space for choose_kd_split()
+    int splitDim = 0;                             // Out parameter for choose_kd_split()
+    int splitVal = 0;                             // Out parameter for choose_kd_split()
+    int numLow = 0;                               // Number of points that go low
+    int lowChild = 0;                             // Node index of the new low child
+    int highChild = 0;                            // Node index of the new high child
+    int i = 0;                                    // Iterating variable
+
+    // 1. Descend
+    node_ptr = &(tree_ptr->node_arr[leaf]);
+
+    while (-1 != node_ptr->lowChild)
+    {
+        leaf = (coord_ptr[node_ptr->splitDim] < node_ptr->splitVal) ? node_ptr->lowChild : node_ptr->highChild;
+        node_ptr = &(tree_ptr->node_arr[leaf]);
+    }
+
+    // 2. Insert
+    if (node_ptr->numLeafPnts < HS_TREE_LEAF_POINTS)
+    {
+        place_kd_point(tree_ptr, leaf, id);
+    }
+    // 3. Split
+    else
+    {
+        memcpy(id_arr, node_ptr->leafPnt, sizeof(node_ptr->leafPnt));
+        id_arr[HS_TREE_LEAF_POINTS] = id;
+
+        if (false == choose_kd_split(tree_ptr, id_arr, HS_TREE_LEAF_POINTS + 1, val_arr, &splitDim, &splitVal))
+        {
+            HARKLE_ERROR(Harkletree, insert_kd_leaf, Too many points share the same coordinates);
+            success = false;
+        }
+        else if (false == split_kd_node(tree_ptr, leaf, splitDim, splitVal))
+        {
+            HARKLE_ERROR(Harkletree, insert_kd_leaf, split_kd_node failed);
+            success = false;
+        }
+        else
+        {
+            // The median split leaves room in both children
+            numLow = partition_kd_ids(tree_ptr, id_arr, HS_TREE_LEAF_POINTS + 1, splitDim, splitVal);
+            lowChild = tree_ptr->node_arr[leaf].lowChild;
+            highChild = tree_ptr->node_arr[leaf].highChild;
+
+            for (i = 0; i < HS_TREE_LEAF_POINTS + 1; i++)
+            {
+                place_kd_point(tree_ptr, (i < numLow) ? lowChild : highChild, id_arr[i]);
+            }
+
+            if (tree_ptr->node_arr[lowChild].depth > calc_kd_depth_limit(tree_ptr->numPnts + 1)
+                || tree_ptr->numNodes > 8 * ((tree_ptr->numPnts / HS_TREE_LEAF_POINTS) + 1))
+            {
+                tree_ptr->stale = true;
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Recursively build the subtree under a leaf with median splits
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        node - Node index of an empty leaf
+        id_arr - IDs of the points that belong under node (reordered in place)
+        val_arr - Scratch space for numIDs values
+        numIDs - Number of IDs in id_arr
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Recursion depth is O(log numIDs) since every split halves the points
+        This function does not perform input validation
+ */
+bool build_kd_subtree(hsKDTree_ptr tree_ptr, int node, int *id_arr, int *val_arr, int numIDs)
+{
+    // LOCAL VARIABLES
+    bool success = true;   // Set this to false if anything fails
+    int splitDim = 0;      // Out parameter for choose_kd_split()
+    int splitVal = 0;      // Out parameter for choose_kd_split()
+    int numLow = 0;        // Number of points that go low
+    int i = 0;             // Iterating variable
+
+    if (numIDs <= HS_TREE_LEAF_POINTS)
+    {
+        for (i = 0; i < numIDs; i++)
+        {
+            place_kd_point(tree_ptr, node, id_arr[i]);
+        }
+    }
+    else if (false == choose_kd_split(tree_ptr, id_arr, numIDs, val_arr, &splitDim, &splitVal))
+    {
+        HARKLE_ERROR(Harkletree, build_kd_subtree, Too many points share the same coordinates);
+        success = false;
+    }
+    else if (false == split_kd_node(tree_ptr, node, splitDim, splitVal))
+    {
+        HARKLE_ERROR(Harkletree, build_kd_subtree, split_kd_node failed);
+        success = false;
+    }
+    else
+    {
+        numLow = partition_kd_ids(tree_ptr, id_arr, numIDs, splitDim, splitVal);
+        success = build_kd_subtree(tree_ptr, tree_ptr->node_arr[node].lowChild, id_arr, val_arr, numLow);
+
+        if (true == success)
+        {
+            success = build_kd_subtree(tree_ptr, tree_ptr->node_arr[node].highChild, id_arr + numLow,
+                                       val_arr, numIDs - numLow);
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Rebuild a k-d tree, with median splits, from the points it holds
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        O(numPnts log numPnts)
+        This function does not perform input validation
+ */
+bool rebuild_kd_tree(hsKDTree_ptr tree_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;    // Set this to false if anything fails
+    int *id_arr = NULL;     // IDs of every point in the tree
+    int *val_arr = NULL;    // Scratch space for build_kd_subtree()
+    int numIDs = 0;         // Number of IDs in id_arr
+    int i = 0;              // Iterating variable
+
+    // 1. Collect the points
+    if (0 < tree_ptr->numPnts)
+    {
+        id_arr = malloc((size_t)tree_ptr->numPnts * sizeof(int));
+        val_arr = malloc((size_t)tree_ptr->numPnts * sizeof(int));
+
+        if (!id_arr || !val_arr)
+        {
+            HARKLE_ERROR(Harkletree, rebuild_kd_tree, malloc failed);
+            success = false;
+        }
+        else
+        {
+            for (i = 0; i < tree_ptr->maxIDs; i++)
+            {
+                if (-1 != tree_ptr->leafOf[i])
+                {
+                    id_arr[numIDs] = i;
+                    numIDs++;
+                    tree_ptr->leafOf[i] = -1;
+                }
+            }
+        }
+    }
+
+    // 2. Build
+    if (true == success)
+    {
+        tree_ptr->numNodes = 0;
+
+        if (0 != add_kd_node(tree_ptr, -1))
+        {
+            HARKLE_ERROR(Harkletree, rebuild_kd_tree, add_kd_node failed);
+            success = false;
+        }
+        else
+        {
+            success = build_kd_subtree(tree_ptr, 0, id_arr, val_arr, numIDs);
+        }
+    }
+
+    if (true == success)
+    {
+        tree_ptr->stale = false;
+    }
+
+    // CLEAN UP
+    if (id_arr)
+    {
+        free(id_arr);
+    }
+    if (val_arr)
+    {
+        free(val_arr);
+    }
+
+    // DONE
+    return success;
+}
+
+
+/*
+    PURPOSE - Calculate the squared distance from a query to the nearest coordinate in a node's box
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        node - Node index
+        query_arr - numDim coordinates
+    OUTPUT
+        Squared distance (0 if the box holds the query)
+    NOTES
+        This function does not perform input validation
+ */
+long long calc_kd_box_dist(hsKDTree_ptr tree_ptr, int node, int *query_arr)
+{
+    // LOCAL VARIABLES
+    long long retVal = 0;                                 // Squared distance
+    long long delta = 0;                                  // Distance in one dimension
+    hsKDNode_ptr node_ptr = &(tree_ptr->node_arr[node]);  // The node
+    int i = 0;                                            // Iterating variable
+
+    for (i = 0; i < tree_ptr->numDim; i++)
+    {
+        if (query_arr[i] < node_ptr->lo[i])
+        {
+            delta = (long long)node_ptr->lo[i] - query_arr[i];
+            retVal += delta * delta;
+        }
+        else if (query_arr[i] > node_ptr->hi[i])
+        {
+            delta = (long long)query_arr[i] - node_ptr->hi[i];
+            retVal += delta * delta;
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Keep a point if it's one of the closest found so far
+    INPUT
+        search_ptr - Pointer to the query's state
+        id - ID of the point
+        sqDist - Squared distance of the point
+    OUTPUT
+        None
+    NOTES
+        Ties go to the lower ID
+        This function does not perform input validation
+ */
+void keep_kd_neighbour(hsKDSearch_ptr search_ptr, int id, long long sqDist)
+{
+    // LOCAL VARIABLES
+    int slot = search_ptr->numFound;   // Where the point belongs
+
+    // Find the slot
+    while (slot > 0 && (search_ptr->sqDist_arr[slot - 1] > sqDist
+                        || (search_ptr->sqDist_arr[slot - 1] == sqDist && search_ptr->id_arr[slot - 1] > id)))
+    {
+        slot--;
+    }
+
+    // Insert it
+    if (slot < search_ptr->numNeighbours)
+    {
+        if (search_ptr->numFound < search_ptr->numNeighbours)
+        {
+            search_ptr->numFound++;
+        }
+
+        memmove(search_ptr->id_arr + slot + 1, search_ptr->id_arr + slot,
+                (search_ptr->numFound - slot - 1) * sizeof(int));
+        memmove(search_ptr->sqDist_arr + slot + 1, search_ptr->sqDist_arr + slot,
+                (search_ptr->numFound - slot - 1) * sizeof(long long));
+        search_ptr->id_arr[slot] = id;
+        search_ptr->sqDist_arr[slot] = sqDist;
+    }
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Recursively search the subtree under a node for the closest points
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        node - Node index
+        search_ptr - Pointer to the query's state
+    OUTPUT
+        None
+    NOTES
+        Subtrees on the wrong side of the query, or farther away than the farthest point kept, are skipped.
+            The child holding the query is searched first so that happens early.
+        This function does not perform input validation
+ */
+void search_kd_node(hsKDTree_ptr tree_ptr, int node, hsKDSearch_ptr search_ptr)
+{
+    // LOCAL VARIABLES
+    hsKDNode_ptr node_ptr = &(tree_ptr->node_arr[node]);  // The node
+    int *query_arr = search_ptr->query_arr;               // Query coordinates
+    int sideDim = search_ptr->sideDim;                    // Constrained dimension (-1 for none)
+    bool skipIt = false;                                  // Set this to true to skip this subtree
+    int *coord_ptr = NULL;                                // A point's coordinates
+    long long sqDist = 0;                                 // A point's squared distance
+    long long delta = 0;                                  // Distance in one dimension
+    int nearChild = 0;                                    // Child holding the query
+    int farChild = 0;                                     // The other child
+    int id = 0;                                           // A point's ID
+    int i = 0;                                            // Iterating variable
+    int dim = 0;                                          // Iterating variable
+
+    // 1. Prune
+    if (-1 != sideDim)
+    {
+        if ((-1 == search_ptr->sideSign && node_ptr->lo[sideDim] >= query_arr[sideDim])
+            || (1 == search_ptr->sideSign && node_ptr->hi[sideDim] <= query_arr[sideDim]))
+        {
+            skipIt = true;
+        }
+    }
+    if (false == skipIt && search_ptr->numFound == search_ptr->numNeighbours
+        && calc_kd_box_dist(tree_ptr, node, query_arr) > search_ptr->sqDist_arr[search_ptr->numFound - 1])
+    {
+        skipIt = true;
+    }
+
+    // 2. Search a leaf
+    if (false == skipIt && -1 == node_ptr->lowChild)
+    {
+        for (i = 0; i < node_ptr->numLeafPnts; i++)
+        {
+            id = node_ptr->leafPnt[i];
+            coord_ptr = tree_ptr->coord + ((size_t)id * tree_ptr->numDim);
+
+            if (id != search_ptr->skipID
+                && (-1 == sideDim || (-1 == search_ptr->sideSign && coord_ptr[sideDim] < query_arr[sideDim])
+                    || (1 == search_ptr->sideSign && coord_ptr[sideDim] > query_arr[sideDim])))
+            {
+                sqDist = 0;
+
+                for (dim = 0; dim < tree_ptr->numDim; dim++)
+                {
+                    delta = (long long)coord_ptr[dim] - query_arr[dim];
+                    sqDist += delta * delta;
+                }
+
+                keep_kd_neighbour(search_ptr, id, sqDist);
+            }
+        }
+    }
+    // 3. Search the children, nearest first
+    else if (false == skipIt)
+    {
+        if (query_arr[node_ptr->splitDim] < node_ptr->splitVal)
+        {
+            nearChild = node_ptr->lowChild;
+            farChild = node_ptr->highChild;
+        }
+        else
+        {
+            nearChild = node_ptr->highChild;
+            farChild = node_ptr->lowChild;
+        }
+
+        search_kd_node(tree_ptr, nearChild, search_ptr);
+        search_kd_node(tree_ptr, farChild, search_ptr);
+    }
+
+    // DONE
+    return;
+}
+
+
+/*
+    PURPOSE - Populate an hsLineLen struct from a k-d tree point
+    INPUT
+        tree_ptr - Pointer to a two dimensional k-d tree
+        id - ID of the point
+        sqDist - Squared distance of the point
+        lineLen_ptr - [Out] hsLineLen struct to populate
+    OUTPUT
+        None
+    NOTES
+        This function does not perform input validation
+ */
+void fill_kd_line_len(hsKDTree_ptr tree_ptr, int id, long long sqDist, hsLineLen_ptr lineLen_ptr)
+{
+    lineLen_ptr->xCoord = tree_ptr->coord[(size_t)id * 2];
+    lineLen_ptr->yCoord = tree_ptr->coord[((size_t)id * 2) + 1];
+    lineLen_ptr->dist = sqrt((double)sqDist);
+
+    // DONE
+    return;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsKDTree_ptr build_kd_tree(int numDim, int numPnts, int *coord_arr)
+{
+    // LOCAL VARIABLES
+    hsKDTree_ptr retVal = NULL;  // k-d tree to return
+    bool success = true;         // Set this to false if anything fails
+    int i = 0;                   // Iterating variable
+
+    // INPUT VALIDATION
+    if (1 > numDim || HS_TREE_MAX_DIMS < numDim)
+    {
+        HARKLE_ERROR(Harkletree, build_kd_tree, Invalid numDim);
+    }
+    else if (0 > numPnts)
+    {
+        HARKLE_ERROR(Harkletree, build_kd_tree, Invalid numPnts);
+    }
+    else if (0 < numPnts && !coord_arr)
+    {
+        HARKLE_ERROR(Harkletree, build_kd_tree, Invalid coord_arr);
+    }
+    else
+    {
+        // ALLOCATE
+        retVal = calloc(1, sizeof(hsKDTree));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harkletree, build_kd_tree, calloc failed);
+            success = false;
+        }
+        else
+        {
+            retVal->numDim = numDim;
+            success = reserve_kd_ids(retVal, (numPnts > 0) ? numPnts - 1 : 0);
+        }
+
+        // BUILD
+        if (true == success)
+        {
+            if (0 < numPnts)
+            {
+                memcpy(retVal->coord, coord_arr, (size_t)numPnts * numDim * sizeof(int));
+            }
+            for (i = 0; i < numPnts; i++)
+            {
+                retVal->leafOf[i] = 0;  // Present (rebuild_kd_tree() will place it)
+            }
+
+            retVal->numPnts = numPnts;
+            success = rebuild_kd_tree(retVal);
+        }
+
+        // CLEAN UP
+        if (false == success && retVal)
+        {
+            free_kd_tree(&retVal);
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+hsKDTree_ptr build_swarm_kd_tree(hsSwarm_ptr swarm_ptr)
+{
+    // LOCAL VARIABLES
+    hsKDTree_ptr retVal = NULL;  // k-d tree to return
+    int *coord_arr = NULL;       // Interleaved swarm coordinates
+    int i = 0;                   // Iterating variable
+
+    // INPUT VALIDATION
+    if (!swarm_ptr)
+    {
+        HARKLE_ERROR(Harkletree, build_swarm_kd_tree, Invalid swarm_ptr);
+    }
+    else
+    {
+        coord_arr = malloc(((size_t)swarm_ptr->numPnts * 2 + 1) * sizeof(int));
+
+        if (!coord_arr)
+        {
+            HARKLE_ERROR(Harkletree, build_swarm_kd_tree, malloc failed);
+        }
+        else
+        {
+            for (i = 0; i < swarm_ptr->numPnts; i++)
+            {
+                coord_arr[i * 2] = swarm_ptr->absX[i];
+                coord_arr[(i * 2) + 1] = swarm_ptr->absY[i];
+            }
+
+            retVal = build_kd_tree(2, swarm_ptr->numPnts, coord_arr);
+            free(coord_arr);
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool insert_kd_point(hsKDTree_ptr tree_ptr, int id, int *coord_arr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!tree_ptr)
+    {
+        HARKLE_ERROR(Harkletree, insert_kd_point, Invalid tree_ptr);
+        success = false;
+    }
+    else if (0 > id || (id < tree_ptr->maxIDs && -1 != tree_ptr->leafOf[id]))
+    {
+        HARKLE_ERROR(Harkletree, insert_kd_point, Invalid id);
+        success = false;
+    }
+    else if (!coord_arr)
+    {
+        HARKLE_ERROR(Harkletree, insert_kd_point, Invalid coord_arr);
+        success = false;
+    }
+    else
+    {
+        success = reserve_kd_ids(tree_ptr, id);
+    }
+
+    // INSERT
+    if (true == success)
+    {
+        memcpy(tree_ptr->coord + ((size_t)id * tree_ptr->numDim), coord_arr, tree_ptr->numDim * sizeof(int));
+        success = insert_kd_leaf(tree_ptr, 0, id);
+
+        if (true == success)
+        {
+            tree_ptr->numPnts++;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool remove_kd_point(hsKDTree_ptr tree_ptr, int id)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!tree_ptr)
+    {
+        HARKLE_ERROR(Harkletree, remove_kd_point, Invalid tree_ptr);
+        success = false;
+    }
+    else if (0 > id || id >= tree_ptr->maxIDs || -1 == tree_ptr->leafOf[id])
+    {
+        HARKLE_ERROR(Harkletree, remove_kd_point, Invalid id);
+        success = false;
+    }
+    else
+    {
+        // REMOVE
+        drop_kd_point(tree_ptr, id);
+        tree_ptr->numPnts--;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool move_kd_point(hsKDTree_ptr tree_ptr, int id, int *coord_arr)
+{
+    // LOCAL VARIABLES
+    bool success = true;                   // Set this to false if anything fails
+    int oldCoord_arr[HS_TREE_MAX_DIMS];    // The point's coordinates before the move
+    int *coord_ptr = NULL;                 // The point's coordinates
+    int oldLeaf = -1;                      // The point's leaf before the move
+    int node = -1;                         // First node, climbing from the old leaf, that covers the point
+
+    // INPUT VALIDATION
+    if (!tree_ptr)
+    {
+        HARKLE_ERROR(Harkletree, move_kd_point, Invalid tree_ptr);
+        success = false;
+    }
+    else if (0 > id || id >= tree_ptr->maxIDs || -1 == tree_ptr->leafOf[id])
+    {
+        HARKLE_ERROR(Harkletree, move_kd_point, Invalid id);
+        success = false;
+    }
+    else if (!coord_arr)
+    {
+        HARKLE_ERROR(Harkletree, move_kd_point, Invalid coord_arr);
+        success = false;
+    }
+
+    // MOVE
+    if (true == success)
+    {
+        coord_ptr = tree_ptr->coord + ((size_t)id * tree_ptr->numDim);
+        oldLeaf = tree_ptr->leafOf[id];
+        memcpy(oldCoord_arr, coord_ptr, tree_ptr->numDim * sizeof(int));
+        memcpy(coord_ptr, coord_arr, tree_ptr->numDim * sizeof(int));
+
+        // Leaving the leaf?  Climb until the point is covered (the root covers everything), then descend.
+        if (false == is_kd_point_in_node(tree_ptr, oldLeaf, id))
+        {
+            drop_kd_point(tree_ptr, id);
+            node = tree_ptr->node_arr[oldLeaf].parent;
+
+            while (false == is_kd_point_in_node(tree_ptr, node, id))
+            {
+                node = tree_ptr->node_arr[node].parent;
+            }
+
+            success = insert_kd_leaf(tree_ptr, node, id);
+
+            // Put it back where it was
+            if (false == success)
+            {
+                HARKLE_ERROR(Harkletree, move_kd_point, insert_kd_leaf failed);
+                memcpy(coord_ptr, oldCoord_arr, tree_ptr->numDim * sizeof(int));
+                place_kd_point(tree_ptr, oldLeaf, id);
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool refresh_kd_tree(hsKDTree_ptr tree_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+
+    // INPUT VALIDATION
+    if (!tree_ptr)
+    {
+        HARKLE_ERROR(Harkletree, refresh_kd_tree, Invalid tree_ptr);
+        success = false;
+    }
+    // REBUILD
+    else if (true == tree_ptr->stale)
+    {
+        success = rebuild_kd_tree(tree_ptr);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harkletree, refresh_kd_tree, rebuild_kd_tree failed);
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+int find_kd_neighbours(hsKDTree_ptr tree_ptr, int *query_arr, int skipID, int sideDim, int sideSign,
+                       int numNeighbours, int *id_arr, long long *sqDist_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = -1;                 // Number of neighbours found
+    hsKDSearch search;                 // Query state
+
+    // INPUT VALIDATION
+    if (!tree_ptr)
+    {
+        HARKLE_ERROR(Harkletree, find_kd_neighbours, Invalid tree_ptr);
+    }
+    else if (!query_arr)
+    {
+        HARKLE_ERROR(Harkletree, find_kd_neighbours, Invalid query_arr);
+    }
+    else if (-1 > sideDim || sideDim >= tree_ptr->numDim || (-1 != sideDim && 1 != sideSign && -1 != sideSign))
+    {
+        HARKLE_ERROR(Harkletree, find_kd_neighbours, Invalid side);
+    }
+    else if (1 > numNeighbours || !id_arr || !sqDist_arr)
+    {
+        HARKLE_ERROR(Harkletree, find_kd_neighbours, Invalid neighbour arrays);
+    }
+    else if (true == tree_ptr->stale && false == rebuild_kd_tree(tree_ptr))
+    {
+        HARKLE_ERROR(Harkletree, find_kd_neighbours, rebuild_kd_tree failed);
+    }
+    else
+    {
+        // SEARCH
+        search.query_arr = query_arr;
+        search.skipID = skipID;
+        search.sideDim = sideDim;
+        search.sideSign = sideSign;
+        search.numNeighbours = numNeighbours;
+        search.numFound = 0;
+        search.id_arr = id_arr;
+        search.sqDist_arr = sqDist_arr;
+        search_kd_node(tree_ptr, 0, &search);
+        numFound = search.numFound;
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+int find_closest_tree_points(hsKDTree_ptr tree_ptr, int id, hsLineLen_ptr *coord_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = -1;                            // Number of coord_arr entries populated
+    int numEntries = 0;                           // Number of entries in coord_arr
+    int *query_arr = NULL;                        // The 'origin' point's coordinates
+    int id_arr[HS_TREE_MAX_NEIGHBOURS];           // Out parameter for find_kd_neighbours()
+    long long sqDist_arr[HS_TREE_MAX_NEIGHBOURS]; // Out parameter for find_kd_neighbours()
+    int sideDim = 0;                              // Dimension the line runs along
+    int tmpFound = 0;                             // Return value from find_kd_neighbours()
+    int i = 0;                                    // Iterating variable
+
+    // INPUT VALIDATION
+    if (!tree_ptr || 2 != tree_ptr->numDim)
+    {
+        HARKLE_ERROR(Harkletree, find_closest_tree_points, Invalid tree_ptr);
+    }
+    else if (0 > id || id >= tree_ptr->maxIDs || -1 == tree_ptr->leafOf[id])
+    {
+        HARKLE_ERROR(Harkletree, find_closest_tree_points, Invalid id);
+    }
+    else if (!coord_arr)
+    {
+        HARKLE_ERROR(Harkletree, find_closest_tree_points, Invalid coord_arr);
+    }
+    else
+    {
+        while (numEntries <= HS_TREE_MAX_NEIGHBOURS && coord_arr[numEntries])
+        {
+            numEntries++;
+        }
+
+        if (2 > numEntries || HS_TREE_MAX_NEIGHBOURS < numEntries)
+        {
+            HARKLE_ERROR(Harkletree, find_closest_tree_points, Unsupported number of dimensions);
+        }
+        else
+        {
+            query_arr = tree_ptr->coord + ((size_t)id * 2);
+            numFound = 0;
+        }
+    }
+
+    // FIND POINTS
+    // One dimension: the closest point on either side of the line
+    if (2 == numEntries && 0 == numFound)
+    {
+        // 1. Determine line direction (any point sharing this x coordinate means the line is vertical)
+        tmpFound = find_kd_neighbours(tree_ptr, query_arr, id, -1, 0, 1, id_arr, sqDist_arr);
+
+        if (1 == tmpFound && tree_ptr->coord[(size_t)id_arr[0] * 2] == query_arr[0])
+        {
+            sideDim = 1;
+        }
+
+        // 2. Find nearest points on both sides of the line ("left" or, for vertical lines, "up" goes in index 0)
+        for (i = 0; i < 2 && -1 < tmpFound; i++)
+        {
+            tmpFound = find_kd_neighbours(tree_ptr, query_arr, id, sideDim, ((0 == i) == (0 == sideDim)) ? -1 : 1,
+                                          1, id_arr, sqDist_arr);
+
+            if (1 == tmpFound)
+            {
+                fill_kd_line_len(tree_ptr, id_arr[0], sqDist_arr[0], coord_arr[i]);
+                numFound++;
+            }
+        }
+    }
+    // Two or more dimensions: the closest points, closest first
+    else if (0 == numFound)
+    {
+        tmpFound = find_kd_neighbours(tree_ptr, query_arr, id, -1, 0, numEntries, id_arr, sqDist_arr);
+
+        for (i = 0; i < tmpFound; i++)
+        {
+            fill_kd_line_len(tree_ptr, id_arr[i], sqDist_arr[i], coord_arr[i]);
+            numFound++;
+        }
+    }
+
+    if (0 > tmpFound)
+    {
+        HARKLE_ERROR(Harkletree, find_closest_tree_points, find_kd_neighbours failed);
+        numFound = -1;
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+bool free_kd_tree(hsKDTree_ptr *oldTree_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;           // Set this to true if the tree is freed
+    hsKDTree_ptr tree_ptr = NULL;   // Local copy of *oldTree_ptr
+
+    // INPUT VALIDATION
+    if (!oldTree_ptr || !(*oldTree_ptr))
+    {
+        HARKLE_ERROR(Harkletree, free_kd_tree, Invalid oldTree_ptr);
+    }
+    else
+    {
+        // FREE
+        tree_ptr = *oldTree_ptr;
+
+        if (tree_ptr->coord)
+        {
+            free(tree_ptr->coord);
+        }
+        if (tree_ptr->leafOf)
+        {
+            free(tree_ptr->leafOf);
+        }
+        if (tree_ptr->slotOf)
+        {
+            free(tree_ptr->slotOf);
+        }
+        if (tree_ptr->node_arr)
+        {
+            free(tree_ptr->node_arr);
+        }
+
+        memset(tree_ptr, 0x0, sizeof(hsKDTree));
+        free(tree_ptr);
+        *oldTree_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
@@ -0,0 +1,196 @@
+#ifndef __HARKLETREE__
+#define __HARKLETREE__
+
+#include "Harklestore.h"        // hsSwarm_ptr
+#include "Harkleswarm.h"        // hsLineLen_ptr
+#include <stdbool.h>            // bool, true, false
+
+// Largest number of dimensions a k-d tree can index
+#define HS_TREE_MAX_DIMS 8
+// Number of points a leaf holds before it splits in two
+#define HS_TREE_LEAF_POINTS 8
+// Largest number of neighbours find_closest_tree_points() will find
+#define HS_TREE_MAX_NEIGHBOURS 16
+// Levels a k-d tree may grow past a balanced tree of the same size before it is rebuilt
+#define HS_TREE_DEPTH_SLACK 4
+
+// Defines one node of a k-d tree
+//  Every node covers the box [lo, hi] (inclusive).  An internal node splits its box on splitDim: the low
+//  child covers coordinates below splitVal and the high child covers the rest.  Only leaves hold points.
+typedef struct hsKDTreeNode
+{
+    int parent;                     // Node index of the parent (-1 for the root)
+    int lowChild;                   // Node index of the child below splitVal (-1 for a leaf)
+    int highChild;                  // Node index of the child at or above splitVal (-1 for a leaf)
+    int splitDim;                   // Dimension this node splits on
+    int splitVal;                   // Smallest coordinate, in splitDim, of the high child
+    int depth;                      // Number of nodes between this node and the root
+    int lo[HS_TREE_MAX_DIMS];       // Smallest coordinate, in each dimension, this node covers
+    int hi[HS_TREE_MAX_DIMS];       // Largest coordinate, in each dimension, this node covers
+    int numLeafPnts;                // Number of points in leafPnt
+    int leafPnt[HS_TREE_LEAF_POINTS];  // IDs of the points in this leaf
+} hsKDNode, *hsKDNode_ptr;
+
+// Defines the struct that holds a bucketed k-d tree of integer points in numDim dimensions
+//  Points are identified by caller-chosen IDs (e.g., swarm store indices).  Memory is proportional to the
+//  number of points, not the size of the field, and the median splits follow the points as they cluster.
+//  Moving a point one coordinate almost never leaves its leaf, so move_kd_point() is usually O(1).  When it
+//  does, the point climbs only as far as the first node that covers its new coordinates before it descends
+//  again.  Full leaves split in two.  Once the tree grows HS_TREE_DEPTH_SLACK levels deeper than a balanced
+//  tree (or collects too many empty leaves) it is rebuilt, with median splits, by the next query.
+typedef struct hsKDTree
+{
+    int numDim;               // Number of dimensions (1 through HS_TREE_MAX_DIMS)
+    int numPnts;              // Number of points currently in the tree
+    int maxIDs;               // Capacity of the per-ID arrays below
+    int *coord;               // coord[id * numDim + dim] is point 'id's coordinate in dimension 'dim'
+    int *leafOf;              // leafOf[id] is the node index of the leaf holding point 'id' (-1 if absent)
+    int *slotOf;              // slotOf[id] is point 'id's index in its leaf's leafPnt
+    int numNodes;             // Number of nodes in node_arr
+    int maxNodes;             // Capacity of node_arr
+    hsKDNode_ptr node_arr;    // Nodes (node 0 is the root)
+    bool stale;               // If true, the tree is rebuilt before the next query
+} hsKDTree, *hsKDTree_ptr;
+
+
+/*
+    PURPOSE - Build a balanced k-d tree of integer points
+    INPUT
+        numDim - Number of dimensions (1 through HS_TREE_MAX_DIMS)
+        numPnts - Number of points in coord_arr (may be 0)
+        coord_arr - numPnts * numDim coordinates, one point after another (may be NULL if numPnts is 0)
+    OUTPUT
+        On success, pointer to a heap-allocated hsKDTree struct holding points 0 through numPnts - 1
+        On failure, NULL
+    NOTES
+        More than HS_TREE_LEAF_POINTS points may not share the same coordinates
+        It is the caller's responsibility to free the memory with free_kd_tree()
+ */
+hsKDTree_ptr build_kd_tree(int numDim, int numPnts, int *coord_arr);
+
+
+/*
+    PURPOSE - Build a two dimensional k-d tree of a swarm store
+    INPUT
+        swarm_ptr - Pointer to a swarm store
+    OUTPUT
+        On success, pointer to a heap-allocated hsKDTree struct whose IDs are swarm store indices
+        On failure, NULL
+    NOTES
+        The tree does not follow the swarm store.  Mirror every move with move_kd_point().
+        It is the caller's responsibility to free the memory with free_kd_tree()
+ */
+hsKDTree_ptr build_swarm_kd_tree(hsSwarm_ptr swarm_ptr);
+
+
+/*
+    PURPOSE - Add a point to a k-d tree
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        id - Non-negative ID of the new point (must not already be in the tree)
+        coord_arr - numDim coordinates of the new point
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+bool insert_kd_point(hsKDTree_ptr tree_ptr, int id, int *coord_arr);
+
+
+/*
+    PURPOSE - Remove a point from a k-d tree
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        id - ID of a point in the tree
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+bool remove_kd_point(hsKDTree_ptr tree_ptr, int id);
+
+
+/*
+    PURPOSE - Move a point in a k-d tree to new coordinates
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        id - ID of a point in the tree
+        coord_arr - numDim new coordinates
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This is O(1) as long as the point stays inside its leaf's box, which is the common case for a point
+            moving one coordinate at a time
+ */
+bool move_kd_point(hsKDTree_ptr tree_ptr, int id, int *coord_arr);
+
+
+/*
+    PURPOSE - Rebuild a k-d tree now if it has grown too unbalanced
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        find_kd_neighbours() only ever modifies a stale tree so, after this call, any number of threads may
+            query the tree at once (as long as nothing inserts, removes or moves a point in the meantime)
+ */
+bool refresh_kd_tree(hsKDTree_ptr tree_ptr);
+
+
+/*
+    PURPOSE - Find the points closest to a set of coordinates
+    INPUT
+        tree_ptr - Pointer to a k-d tree
+        query_arr - numDim coordinates to measure distance from
+        skipID - ID of a point to ignore (e.g., the point at query_arr) or -1
+        sideDim - If not -1, only consider points on one side of query_arr in this dimension
+        sideSign - If sideDim is not -1, -1 to only consider coordinates below query_arr[sideDim] and 1 to only
+            consider coordinates above it
+        numNeighbours - Number of points to find
+        id_arr - Array of numNeighbours ints to store the IDs in
+        sqDist_arr - Array of numNeighbours long longs to store the squared distances in
+    OUTPUT
+        On success, number of points found (fewer than numNeighbours if the tree doesn't have enough), closest
+            first.  Ties are broken by the lower ID.
+        On failure, -1
+    NOTES
+        Distances are squared Euclidean distances: the search is exact and never touches floating point
+        Rebuilds the tree first if it has grown too unbalanced
+ */
+int find_kd_neighbours(hsKDTree_ptr tree_ptr, int *query_arr, int skipID, int sideDim, int sideSign,
+                       int numNeighbours, int *id_arr, long long *sqDist_arr);
+
+
+/*
+    PURPOSE - Fill the given array with coordinates and distances representing the closest points to a point
+    INPUT
+        tree_ptr - Pointer to a two dimensional k-d tree
+        id - ID of the 'origin' point
+        coord_arr - NULL-terminated array of hsLineLen struct pointers to use as 'out' parameters
+    OUTPUT
+        On success, number of hsLineLen struct pointers populated with points and distances
+        On failure, -1
+    NOTES
+        This is the k-d tree equivalent of find_closest_points() and follows the same conventions.  The
+            number of entries in coord_arr determines the dimension: two entries finds the closest point
+            on each side of a line (the closest "left"/"up" point in coord_arr[0] and the closest
+            "right"/"down" point in coord_arr[1]), three or more finds that many points, closest first.
+ */
+int find_closest_tree_points(hsKDTree_ptr tree_ptr, int id, hsLineLen_ptr *coord_arr);
+
+
+/*
+    PURPOSE - Free the heap-allocated memory associated with a k-d tree
+    INPUT
+        oldTree_ptr - A pointer to a heap-allocated hsKDTree struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Call this function as free_kd_tree(&myTree_ptr);
+ */
+bool free_kd_tree(hsKDTree_ptr *oldTree_ptr);
+
+
+#endif  // __HARKLETREE__
@@ -0,0 +1,776 @@
+#include "Harklecurse.h"
+#include "Harklepool.h"
+#include "Harklerror.h"         // HARKLE_ERROR
+#include "Harkleswarm.h"        // rando_cell_index()
+#include "Harkletree.h"
+#include "Harklevolume.h"
+#include <math.h>               // floor(), sqrt()
+#include <stdlib.h>             // calloc(), free()
+#include <string.h>             // memcmp(), memcpy(), memmove(), memset()
+
+
+// Defines the struct shared by every chunk of a volume sweep (see: shwarm_volume_sweep())
+typedef struct hsVolumeJob
+{
+    hsVolume_ptr volume_ptr;  // Volume swarm being swept
+    int maxMoves;             // Number of one-dimensional moves each point may move
+    bool intercepts;          // If true, the field's walls are treated as points
+} hsVolumeJob, *hsVolumeJob_ptr;
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// LOCAL FUNCTIONS //////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+    PURPOSE - Determine if any point in a volume swarm, other than one, occupies a coordinate
+    INPUT
+        volume_ptr - Pointer to a volume swarm
+        coord_arr - HS_VOLUME_DIMS coordinates
+        skipIndex - Index of a point to ignore (-1 for none)
+    OUTPUT
+        If so, or on error, true
+        Otherwise, false
+    NOTES
+        This function does not perform input validation
+ */
+bool is_volume_coord_occupied(hsVolume_ptr volume_ptr, int *coord_arr, int skipIndex)
+{
+    // LOCAL VARIABLES
+    bool retVal = true;      // Assume occupied so errors never let two points share a coordinate
+    int closestID = -1;      // Out parameter for find_kd_neighbours()
+    long long sqDist = 0;    // Out parameter for find_kd_neighbours()
+    int numFound = 0;        // Return value from find_kd_neighbours()
+
+    numFound = find_kd_neighbours(volume_ptr->tree_ptr, coord_arr, skipIndex, -1, 0, 1, &closestID, &sqDist);
+
+    if (0 > numFound)
+    {
+        HARKLE_ERROR(Harklevolume, is_volume_coord_occupied, find_kd_neighbours failed);
+    }
+    else if (0 == numFound || 0 < sqDist)
+    {
+        retVal = false;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Move a coordinate one step toward a target, along the axis with the furthest to go
+    INPUT
+        coord_arr - HS_VOLUME_DIMS coordinates to move (in place)
+        target_arr - HS_VOLUME_DIMS coordinates to move toward
+    OUTPUT
+        1 if the coordinate moved, 0 if it was already on target
+    NOTES
+        This is the volume equivalent of move_shawarma(..., 1).  Ties go to x, then y.
+        This function does not perform input validation
+ */
+int step_volume_coord(int *coord_arr, int *target_arr)
+{
+    // LOCAL VARIABLES
+    int retVal = 0;      // Number of steps taken
+    int bestDim = -1;    // Dimension with the furthest to go
+    int bestDelta = 0;   // Absolute distance to go in bestDim
+    int tmpDelta = 0;    // Absolute distance to go in the current dimension
+    int dim = 0;         // Iterating variable
+
+    for (dim = 0; dim < HS_VOLUME_DIMS; dim++)
+    {
+        tmpDelta = abs(target_arr[dim] - coord_arr[dim]);
+
+        if (tmpDelta > bestDelta)
+        {
+            bestDelta = tmpDelta;
+            bestDim = dim;
+        }
+    }
+
+    if (-1 != bestDim)
+    {
+        coord_arr[bestDim] += (target_arr[bestDim] > coord_arr[bestDim]) ? 1 : -1;
+        retVal = 1;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+/*
+    PURPOSE - Keep a candidate point if it's one of the closest found so far
+    INPUT
+        pnt_arr - HS_VOLUME_NEIGHBOURS * HS_VOLUME_DIMS coordinates found so far, closest first
+        dist_arr - HS_VOLUME_NEIGHBOURS distances found so far
+        numFound - Number of entries populated so far
+        coord_arr - HS_VOLUME_DIMS coordinates of the candidate
+        dist - Distance of the candidate
+    OUTPUT
+        Number of entries populated afterwards
+    NOTES
+        Ties go to the entries already found
+        This function does not perform input validation
+ */
+int keep_volume_point(int *pnt_arr, double *dist_arr, int numFound, int *coord_arr, double dist)
+{
+    // LOCAL VARIABLES
+    int slot = numFound;  // Where the candidate belongs
+
+    while (slot > 0 && dist_arr[slot - 1] > dist)
+    {
+        slot--;
+    }
+
+    if (slot < HS_VOLUME_NEIGHBOURS)
+    {
+        if (numFound < HS_VOLUME_NEIGHBOURS)
+        {
+            numFound++;
+        }
+
+        memmove(pnt_arr + ((slot + 1) * HS_VOLUME_DIMS), pnt_arr + (slot * HS_VOLUME_DIMS),
+                (numFound - slot - 1) * HS_VOLUME_DIMS * sizeof(int));
+        memmove(dist_arr + slot + 1, dist_arr + slot, (numFound - slot - 1) * sizeof(double));
+        memcpy(pnt_arr + (slot * HS_VOLUME_DIMS), coord_arr, HS_VOLUME_DIMS * sizeof(int));
+        dist_arr[slot] = dist;
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+/*
+    PURPOSE - Volume sweep phase 1: propose a move for indices [first, last) from the frozen swarm
+    INPUT
+        See: hsPoolJob
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Writes only nextCoord and nextMoves, and only reads the k-d tree, so chunks never interfere
+ */
+bool propose_volume_chunk(void *jobArg, int first, int last, int workerNum)
+{
+    // LOCAL VARIABLES
+    bool success = true;                                 // Set this to false if anything fails
+    hsVolumeJob_ptr job_ptr = (hsVolumeJob_ptr)jobArg;   // Job
+    hsVolume_ptr volume_ptr = job_ptr->volume_ptr;       // Volume swarm
+    int *next_ptr = NULL;                                // This point's proposal
+    int numClosePnts = 0;                                // Number of closest points found before the move
+    int newClosePnts = 0;                                // Number of closest points found after the move
+    int numMoves = 0;                                    // Number of moves proposed
+    int pnt_arr[HS_VOLUME_NEIGHBOURS * HS_VOLUME_DIMS];  // Closest points before the move
+    double dist_arr[HS_VOLUME_NEIGHBOURS];               // Their distances
+    int newPnt_arr[HS_VOLUME_NEIGHBOURS * HS_VOLUME_DIMS];  // Closest points after the move
+    double newDist_arr[HS_VOLUME_NEIGHBOURS];            // Their distances
+    int target_arr[HS_VOLUME_DIMS];                      // Point equidistant from the closest points
+    int tmp_arr[HS_VOLUME_DIMS];                         // The point after its next step
+    int index = 0;                                       // Iterating variable
+
+    (void)workerNum;  // Proposals only write their own points so no per-worker state is needed
+
+    for (index = first; index < last && true == success; index++)
+    {
+        // 1. Stay put unless a move is proposed
+        next_ptr = volume_ptr->nextCoord + ((size_t)index * HS_VOLUME_DIMS);
+        next_ptr[0] = volume_ptr->absX[index];
+        next_ptr[1] = volume_ptr->absY[index];
+        next_ptr[2] = volume_ptr->absZ[index];
+        numMoves = 0;
+
+        // 2. Find closest points
+        numClosePnts = find_volume_neighbours(volume_ptr, index, next_ptr, job_ptr->intercepts, pnt_arr,
+                                              dist_arr);
+
+        if (0 > numClosePnts)
+        {
+            HARKLE_ERROR(Harklevolume, propose_volume_chunk, find_volume_neighbours failed);
+            success = false;
+        }
+        // 3. Calculate the target (as long as the point is pinned by four others)
+        else if (HS_VOLUME_NEIGHBOURS == numClosePnts)
+        {
+            success = determine_tetrahedral_point(&(volume_ptr->field), pnt_arr, target_arr);
+
+            if (false == success)
+            {
+                HARKLE_ERROR(Harklevolume, propose_volume_chunk, determine_tetrahedral_point failed);
+            }
+        }
+
+        // 4. Step toward the target until it's reached, or blocked
+        while (true == success && HS_VOLUME_NEIGHBOURS == numClosePnts && numMoves < job_ptr->maxMoves)
+        {
+            memcpy(tmp_arr, next_ptr, sizeof(tmp_arr));
+
+            if (0 == step_volume_coord(tmp_arr, target_arr)
+                || true == is_volume_coord_occupied(volume_ptr, tmp_arr, index))
+            {
+                break;  // On target or blocked
+            }
+
+            memcpy(next_ptr, tmp_arr, sizeof(tmp_arr));
+            numMoves++;
+        }
+
+        // 5. Only keep a move that leaves the point closer to equidistant from its (new) closest points
+        if (true == success && 0 < numMoves)
+        {
+            newClosePnts = find_volume_neighbours(volume_ptr, index, next_ptr, job_ptr->intercepts, newPnt_arr,
+                                                  newDist_arr);
+
+            if (0 > newClosePnts)
+            {
+                HARKLE_ERROR(Harklevolume, propose_volume_chunk, find_volume_neighbours failed);
+                success = false;
+            }
+            else if (HS_VOLUME_NEIGHBOURS == newClosePnts
+                     && (newDist_arr[HS_VOLUME_NEIGHBOURS - 1] - newDist_arr[0])
+                        > (dist_arr[HS_VOLUME_NEIGHBOURS - 1] - dist_arr[0]) - 1.0)
+            {
+                numMoves = 0;  // No better off
+            }
+
+            if (0 == numMoves)
+            {
+                next_ptr[0] = volume_ptr->absX[index];
+                next_ptr[1] = volume_ptr->absY[index];
+                next_ptr[2] = volume_ptr->absZ[index];
+            }
+        }
+
+        volume_ptr->nextMoves[index] = numMoves;
+    }
+
+    // DONE
+    return success;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// GLOBAL FUNCTIONS /////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+hsVolume_ptr build_volume_swarm(hsBox_ptr field_ptr, int numPnts)
+{
+    // LOCAL VARIABLES
+    hsVolume_ptr retVal = NULL;      // Volume swarm to return
+    bool success = true;             // Set this to false if anything fails
+    long long width = 0;             // Number of coordinates along x
+    long long height = 0;            // Number of coordinates along y
+    long long numCells = 0;          // Number of coordinates in the field
+    long long cellIndex = 0;         // Randomized cell index
+    long long j = 0;                 // Floyd's upper bound
+    int coord_arr[HS_VOLUME_DIMS];   // Coordinates of the current point
+    int i = 0;                       // Iterating variable
+
+    // INPUT VALIDATION
+    if (!field_ptr || field_ptr->xMin > field_ptr->xMax || field_ptr->yMin > field_ptr->yMax
+        || field_ptr->zMin > field_ptr->zMax)
+    {
+        HARKLE_ERROR(Harklevolume, build_volume_swarm, Invalid field_ptr);
+        success = false;
+    }
+    else
+    {
+        width = (long long)field_ptr->xMax - field_ptr->xMin + 1;
+        height = (long long)field_ptr->yMax - field_ptr->yMin + 1;
+        numCells = width * height * ((long long)field_ptr->zMax - field_ptr->zMin + 1);
+
+        if (1 > numPnts || numPnts > numCells)
+        {
+            HARKLE_ERROR(Harklevolume, build_volume_swarm, Invalid number of points for this field);
+            success = false;
+        }
+    }
+
+    // ALLOCATE
+    if (true == success)
+    {
+        retVal = calloc(1, sizeof(hsVolume));
+
+        if (!retVal)
+        {
+            HARKLE_ERROR(Harklevolume, build_volume_swarm, calloc failed);
+            success = false;
+        }
+        else
+        {
+            retVal->field = *field_ptr;
+            retVal->absX = calloc(numPnts, sizeof(int));
+            retVal->absY = calloc(numPnts, sizeof(int));
+            retVal->absZ = calloc(numPnts, sizeof(int));
+            retVal->posNum = calloc(numPnts, sizeof(int));
+            retVal->nextCoord = calloc((size_t)numPnts * HS_VOLUME_DIMS, sizeof(int));
+            retVal->nextMoves = calloc(numPnts, sizeof(int));
+            retVal->tree_ptr = build_kd_tree(HS_VOLUME_DIMS, 0, NULL);
+
+            if (!(retVal->absX) || !(retVal->absY) || !(retVal->absZ) || !(retVal->posNum)
+                || !(retVal->nextCoord) || !(retVal->nextMoves) || !(retVal->tree_ptr))
+            {
+                HARKLE_ERROR(Harklevolume, build_volume_swarm, Allocation failed);
+                success = false;
+            }
+        }
+    }
+
+    // SAMPLE
+    // Floyd's algorithm, like sample_distinct_cells(), with the k-d tree as the set of cells already taken
+    for (i = 0, j = numCells - numPnts; true == success && i < numPnts; i++, j++)
+    {
+        // Pick from [0, j].  If that cell is taken, j itself never has been.
+        cellIndex = rando_cell_index(j);
+        coord_arr[0] = field_ptr->xMin + (int)(cellIndex % width);
+        coord_arr[1] = field_ptr->yMin + (int)((cellIndex / width) % height);
+        coord_arr[2] = field_ptr->zMin + (int)(cellIndex / (width * height));
+
+        if (true == is_volume_coord_occupied(retVal, coord_arr, -1))
+        {
+            coord_arr[0] = field_ptr->xMin + (int)(j % width);
+            coord_arr[1] = field_ptr->yMin + (int)((j / width) % height);
+            coord_arr[2] = field_ptr->zMin + (int)(j / (width * height));
+        }
+
+        success = insert_kd_point(retVal->tree_ptr, i, coord_arr);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Harklevolume, build_volume_swarm, insert_kd_point failed);
+        }
+        else
+        {
+            retVal->absX[i] = coord_arr[0];
+            retVal->absY[i] = coord_arr[1];
+            retVal->absZ[i] = coord_arr[2];
+            retVal->posNum[i] = i + 1;
+            retVal->numPnts++;
+        }
+    }
+
+    if (true == success && false == refresh_kd_tree(retVal->tree_ptr))
+    {
+        HARKLE_ERROR(Harklevolume, build_volume_swarm, refresh_kd_tree failed);
+        success = false;
+    }
+
+    // CLEAN UP
+    if (false == success && retVal)
+    {
+        free_volume_swarm(&retVal);
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool calculate_plane_intercepts(hsBox_ptr field_ptr, int *coord_arr, int *wall_arr)
+{
+    // LOCAL VARIABLES
+    bool success = true;  // Set this to false if anything fails
+    int wall = 0;         // Iterating variable
+
+    // INPUT VALIDATION
+    if (!field_ptr)
+    {
+        HARKLE_ERROR(Harklevolume, calculate_plane_intercepts, Invalid field_ptr);
+        success = false;
+    }
+    else if (!coord_arr)
+    {
+        HARKLE_ERROR(Harklevolume, calculate_plane_intercepts, Invalid coord_arr);
+        success = false;
+    }
+    else if (!wall_arr)
+    {
+        HARKLE_ERROR(Harklevolume, calculate_plane_intercepts, Invalid wall_arr);
+        success = false;
+    }
+    else
+    {
+        // CALCULATE
+        // Every wall point shares two coordinates with the point
+        for (wall = 0; wall < HS_VOLUME_WALLS; wall++)
+        {
+            memcpy(wall_arr + (wall * HS_VOLUME_DIMS), coord_arr, HS_VOLUME_DIMS * sizeof(int));
+        }
+
+        wall_arr[0] = field_ptr->xMin - 1;
+        wall_arr[HS_VOLUME_DIMS] = field_ptr->xMax + 1;
+        wall_arr[(2 * HS_VOLUME_DIMS) + 1] = field_ptr->yMin - 1;
+        wall_arr[(3 * HS_VOLUME_DIMS) + 1] = field_ptr->yMax + 1;
+        wall_arr[(4 * HS_VOLUME_DIMS) + 2] = field_ptr->zMin - 1;
+        wall_arr[(5 * HS_VOLUME_DIMS) + 2] = field_ptr->zMax + 1;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool determine_tetrahedral_point(hsBox_ptr field_ptr, int *pnt_arr, int *target_arr)
+{
+    // LOCAL VARIABLES
+    bool success = true;                     // Set this to false if anything fails
+    long long edge_arr[3][HS_VOLUME_DIMS];   // Edges from the first point to the other three
+    long long cross_arr[3][HS_VOLUME_DIMS];  // Cross products of the edges (edge 1 x 2, 2 x 0, 0 x 1)
+    double half_arr[3];                      // Half the squared length of each edge
+    long long det = 0;                       // Triple product of the edges (0 if coplanar)
+    double center = 0.0;                     // One coordinate of the center
+    int minVal = 0;                          // Smallest coordinate the field allows in this dimension
+    int maxVal = 0;                          // Largest coordinate the field allows in this dimension
+    int i = 0;                               // Iterating variable
+    int dim = 0;                             // Iterating variable
+
+    // INPUT VALIDATION
+    if (!field_ptr)
+    {
+        HARKLE_ERROR(Harklevolume, determine_tetrahedral_point, Invalid field_ptr);
+        success = false;
+    }
+    else if (!pnt_arr)
+    {
+        HARKLE_ERROR(Harklevolume, determine_tetrahedral_point, Invalid pnt_arr);
+        success = false;
+    }
+    else if (!target_arr)
+    {
+        HARKLE_ERROR(Harklevolume, determine_tetrahedral_point, Invalid target_arr);
+        success = false;
+    }
+    else
+    {
+        // 1. Measure the edges
+        for (i = 0; i < 3; i++)
+        {
+            half_arr[i] = 0.0;
+
+            for (dim = 0; dim < HS_VOLUME_DIMS; dim++)
+            {
+                edge_arr[i][dim] = (long long)pnt_arr[((i + 1) * HS_VOLUME_DIMS) + dim] - pnt_arr[dim];
+                half_arr[i] += (double)(edge_arr[i][dim] * edge_arr[i][dim]) / 2.0;
+            }
+        }
+
+        // 2. Solve edge_i . center = half_i (Cramer's rule, with the determinant in exact integers)
+        for (i = 0; i < 3; i++)
+        {
+            cross_arr[i][0] = edge_arr[(i + 1) % 3][1] * edge_arr[(i + 2) % 3][2]
+                              - edge_arr[(i + 1) % 3][2] * edge_arr[(i + 2) % 3][1];
+            cross_arr[i][1] = edge_arr[(i + 1) % 3][2] * edge_arr[(i + 2) % 3][0]
+                              - edge_arr[(i + 1) % 3][0] * edge_arr[(i + 2) % 3][2];
+            cross_arr[i][2] = edge_arr[(i + 1) % 3][0] * edge_arr[(i + 2) % 3][1]
+                              - edge_arr[(i + 1) % 3][1] * edge_arr[(i + 2) % 3][0];
+        }
+
+        det = edge_arr[0][0] * cross_arr[0][0] + edge_arr[0][1] * cross_arr[0][1]
+              + edge_arr[0][2] * cross_arr[0][2];
+
+        for (dim = 0; dim < HS_VOLUME_DIMS; dim++)
+        {
+            if (0 != det)
+            {
+                center = pnt_arr[dim] + ((half_arr[0] * cross_arr[0][dim] + half_arr[1] * cross_arr[1][dim]
+                                          + half_arr[2] * cross_arr[2][dim]) / det);
+            }
+            // Coplanar: no sphere passes through all four so settle for their centroid
+            else
+            {
+                center = ((double)pnt_arr[dim] + pnt_arr[HS_VOLUME_DIMS + dim] + pnt_arr[(2 * HS_VOLUME_DIMS) + dim]
+                          + pnt_arr[(3 * HS_VOLUME_DIMS) + dim]) / HS_VOLUME_NEIGHBOURS;
+            }
+
+            // 3. Keep it inside the field
+            minVal = (0 == dim) ? field_ptr->xMin : ((1 == dim) ? field_ptr->yMin : field_ptr->zMin);
+            maxVal = (0 == dim) ? field_ptr->xMax : ((1 == dim) ? field_ptr->yMax : field_ptr->zMax);
+
+            if (center < minVal)
+            {
+                target_arr[dim] = minVal;
+            }
+            else if (center > maxVal)
+            {
+                target_arr[dim] = maxVal;
+            }
+            else
+            {
+                target_arr[dim] = (int)floor(center + 0.5);
+            }
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+int find_volume_neighbours(hsVolume_ptr volume_ptr, int index, int *coord_arr, bool intercepts, int *pnt_arr,
+                           double *dist_arr)
+{
+    // LOCAL VARIABLES
+    int numFound = -1;                                   // Number of closest points found
+    int id_arr[HS_VOLUME_NEIGHBOURS];                    // Out parameter for find_kd_neighbours()
+    long long sqDist_arr[HS_VOLUME_NEIGHBOURS];          // Out parameter for find_kd_neighbours()
+    int wall_arr[HS_VOLUME_WALLS * HS_VOLUME_DIMS];      // Out parameter for calculate_plane_intercepts()
+    int *wall_ptr = NULL;                                // One wall point
+    int tmpFound = 0;                                    // Return value from find_kd_neighbours()
+    double tmpDist = 0.0;                                // Distance to one wall
+    int i = 0;                                           // Iterating variable
+    int dim = 0;                                         // Iterating variable
+
+    // INPUT VALIDATION
+    if (!volume_ptr || !(volume_ptr->tree_ptr))
+    {
+        HARKLE_ERROR(Harklevolume, find_volume_neighbours, Invalid volume_ptr);
+    }
+    else if (0 > index || index >= volume_ptr->numPnts)
+    {
+        HARKLE_ERROR(Harklevolume, find_volume_neighbours, Invalid index);
+    }
+    else if (!coord_arr || !pnt_arr || !dist_arr)
+    {
+        HARKLE_ERROR(Harklevolume, find_volume_neighbours, Invalid array);
+    }
+    else
+    {
+        // 1. Find the closest points
+        tmpFound = find_kd_neighbours(volume_ptr->tree_ptr, coord_arr, index, -1, 0, HS_VOLUME_NEIGHBOURS, id_arr,
+                                      sqDist_arr);
+
+        if (0 > tmpFound)
+        {
+            HARKLE_ERROR(Harklevolume, find_volume_neighbours, find_kd_neighbours failed);
+        }
+        else
+        {
+            for (i = 0; i < tmpFound; i++)
+            {
+                pnt_arr[(i * HS_VOLUME_DIMS)] = volume_ptr->absX[id_arr[i]];
+                pnt_arr[(i * HS_VOLUME_DIMS) + 1] = volume_ptr->absY[id_arr[i]];
+                pnt_arr[(i * HS_VOLUME_DIMS) + 2] = volume_ptr->absZ[id_arr[i]];
+                dist_arr[i] = sqrt((double)sqDist_arr[i]);
+            }
+
+            numFound = tmpFound;
+        }
+
+        // 2. Consider the walls
+        if (-1 < numFound && true == intercepts)
+        {
+            if (false == calculate_plane_intercepts(&(volume_ptr->field), coord_arr, wall_arr))
+            {
+                HARKLE_ERROR(Harklevolume, find_volume_neighbours, calculate_plane_intercepts failed);
+                numFound = -1;
+            }
+            else
+            {
+                for (i = 0; i < HS_VOLUME_WALLS; i++)
+                {
+                    wall_ptr = wall_arr + (i * HS_VOLUME_DIMS);
+                    dim = i / 2;  // Each pair of walls is perpendicular to one axis
+                    tmpDist = (double)abs(wall_ptr[dim] - coord_arr[dim]);
+                    numFound = keep_volume_point(pnt_arr, dist_arr, numFound, wall_ptr, tmpDist);
+                }
+            }
+        }
+    }
+
+    // DONE
+    return numFound;
+}
+
+
+long shwarm_volume_sweep(hsVolume_ptr volume_ptr, hsPool_ptr pool_ptr, int maxMoves, bool intercepts)
+{
+    // LOCAL VARIABLES
+    long totMoves = -1;           // Total number of moves made
+    bool success = true;          // Set this to false if anything fails
+    hsVolumeJob job;              // Shared by every chunk
+    int *next_ptr = NULL;         // One point's proposal
+    int index = 0;                // Iterating variable
+
+    memset(&job, 0x0, sizeof(job));
+
+    // INPUT VALIDATION
+    if (!volume_ptr || !(volume_ptr->tree_ptr))
+    {
+        HARKLE_ERROR(Harklevolume, shwarm_volume_sweep, Invalid volume_ptr);
+        success = false;
+    }
+    else if (!pool_ptr)
+    {
+        HARKLE_ERROR(Harklevolume, shwarm_volume_sweep, Invalid pool_ptr);
+        success = false;
+    }
+    else if (maxMoves < 1)
+    {
+        HARKLE_ERROR(Harklevolume, shwarm_volume_sweep, Invalid maxMoves);
+        success = false;
+    }
+    // Nothing may rebuild the tree while the workers read it
+    else if (false == refresh_kd_tree(volume_ptr->tree_ptr))
+    {
+        HARKLE_ERROR(Harklevolume, shwarm_volume_sweep, refresh_kd_tree failed);
+        success = false;
+    }
+
+    // SWEEP
+    // 1. Propose moves from the frozen swarm
+    if (true == success)
+    {
+        job.volume_ptr = volume_ptr;
+        job.maxMoves = maxMoves;
+        job.intercepts = intercepts;
+
+        if (false == run_pool_job(pool_ptr, propose_volume_chunk, &job, volume_ptr->numPnts))
+        {
+            HARKLE_ERROR(Harklevolume, shwarm_volume_sweep, Propose phase failed);
+            success = false;
+        }
+    }
+
+    // 2. Commit, in index order, skipping proposals that collide with an earlier commit
+    if (true == success)
+    {
+        totMoves = 0;
+
+        for (index = 0; index < volume_ptr->numPnts && true == success; index++)
+        {
+            next_ptr = volume_ptr->nextCoord + ((size_t)index * HS_VOLUME_DIMS);
+
+            if (0 < volume_ptr->nextMoves[index] && false == is_volume_coord_occupied(volume_ptr, next_ptr, index))
+            {
+                success = move_kd_point(volume_ptr->tree_ptr, index, next_ptr);
+
+                if (false == success)
+                {
+                    HARKLE_ERROR(Harklevolume, shwarm_volume_sweep, move_kd_point failed);
+                    totMoves = -1;
+                }
+                else
+                {
+                    volume_ptr->absX[index] = next_ptr[0];
+                    volume_ptr->absY[index] = next_ptr[1];
+                    volume_ptr->absZ[index] = next_ptr[2];
+                    totMoves += volume_ptr->nextMoves[index];
+                }
+            }
+        }
+    }
+
+    // DONE
+    return totMoves;
+}
+
+
+bool verify_volume_swarm(hsVolume_ptr volume_ptr)
+{
+    // LOCAL VARIABLES
+    bool retVal = true;              // Set this to false if anything is wrong
+    hsBox_ptr field_ptr = NULL;      // The field
+    int coord_arr[HS_VOLUME_DIMS];   // Coordinates of the current point
+    int index = 0;                   // Iterating variable
+
+    // INPUT VALIDATION
+    if (!volume_ptr || !(volume_ptr->tree_ptr))
+    {
+        HARKLE_ERROR(Harklevolume, verify_volume_swarm, Invalid volume_ptr);
+        retVal = false;
+    }
+    else
+    {
+        // VERIFY
+        field_ptr = &(volume_ptr->field);
+
+        for (index = 0; index < volume_ptr->numPnts && true == retVal; index++)
+        {
+            coord_arr[0] = volume_ptr->absX[index];
+            coord_arr[1] = volume_ptr->absY[index];
+            coord_arr[2] = volume_ptr->absZ[index];
+
+            if (coord_arr[0] < field_ptr->xMin || coord_arr[0] > field_ptr->xMax
+                || coord_arr[1] < field_ptr->yMin || coord_arr[1] > field_ptr->yMax
+                || coord_arr[2] < field_ptr->zMin || coord_arr[2] > field_ptr->zMax)
+            {
+                HARKLE_ERROR(Harklevolume, verify_volume_swarm, A point left the field);
+                retVal = false;
+            }
+            else if (0 != memcmp(coord_arr, volume_ptr->tree_ptr->coord + ((size_t)index * HS_VOLUME_DIMS),
+                                 sizeof(coord_arr)))
+            {
+                HARKLE_ERROR(Harklevolume, verify_volume_swarm, The k-d tree is out of sync);
+                retVal = false;
+            }
+            else if (true == is_volume_coord_occupied(volume_ptr, coord_arr, index))
+            {
+                HARKLE_ERROR(Harklevolume, verify_volume_swarm, Two points share a coordinate);
+                retVal = false;
+            }
+        }
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+bool free_volume_swarm(hsVolume_ptr *oldVolume_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;            // Set this to true if the swarm is freed
+    hsVolume_ptr volume_ptr = NULL;  // Local copy of *oldVolume_ptr
+
+    // INPUT VALIDATION
+    if (!oldVolume_ptr || !(*oldVolume_ptr))
+    {
+        HARKLE_ERROR(Harklevolume, free_volume_swarm, Invalid oldVolume_ptr);
+    }
+    else
+    {
+        // FREE
+        volume_ptr = *oldVolume_ptr;
+
+        if (volume_ptr->absX)
+        {
+            free(volume_ptr->absX);
+        }
+        if (volume_ptr->absY)
+        {
+            free(volume_ptr->absY);
+        }
+        if (volume_ptr->absZ)
+        {
+            free(volume_ptr->absZ);
+        }
+        if (volume_ptr->posNum)
+        {
+            free(volume_ptr->posNum);
+        }
+        if (volume_ptr->nextCoord)
+        {
+            free(volume_ptr->nextCoord);
+        }
+        if (volume_ptr->nextMoves)
+        {
+            free(volume_ptr->nextMoves);
+        }
+        if (volume_ptr->tree_ptr)
+        {
+            free_kd_tree(&(volume_ptr->tree_ptr));
+        }
+
+        memset(volume_ptr, 0x0, sizeof(hsVolume));
+        free(volume_ptr);
+        *oldVolume_ptr = NULL;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
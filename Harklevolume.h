@@ -0,0 +1,162 @@
+#ifndef __HARKLEVOLUME__
+#define __HARKLEVOLUME__
+
+#include "Harklepool.h"         // hsPool_ptr
+#include "Harkletree.h"         // hsKDTree_ptr
+#include <stdbool.h>            // bool, true, false
+
+// Number of dimensions a volume swarm lives in
+#define HS_VOLUME_DIMS 3
+// Number of closest points that pin a point in three dimensions (see: determine_tetrahedral_point())
+#define HS_VOLUME_NEIGHBOURS 4
+// Number of walls around a volume field (see: calculate_plane_intercepts())
+#define HS_VOLUME_WALLS 6
+
+// Defines the box-shaped field a volume swarm lives in
+//  Points may occupy any coordinate from the minimum to the maximum, inclusive, in each dimension.  The
+//  walls are one coordinate outside: the volume equivalent of a window's border.
+typedef struct hsVolumeBox
+{
+    int xMin;                 // Smallest x coordinate a point may occupy
+    int xMax;                 // Largest x coordinate a point may occupy
+    int yMin;                 // Smallest y coordinate a point may occupy
+    int yMax;                 // Largest y coordinate a point may occupy
+    int zMin;                 // Smallest z coordinate a point may occupy
+    int zMax;                 // Largest z coordinate a point may occupy
+} hsBox, *hsBox_ptr;
+
+// Defines the struct that holds a swarm in three dimensions
+//  The coordinates are parallel arrays, like a swarm store, and index i of every array describes the same
+//  point.  A three dimensional k-d tree of the swarm (IDs are array indices) answers both the closest point
+//  and the occupancy questions.  Move points with the volume engine functions so the tree stays in sync.
+//  Every point moves toward the point equidistant from its four closest points, treating the field's walls
+//  as points if asked to.  As in two dimensions (see: is_triangulation_improved()), a move is only kept if
+//  it shrinks the spread of those four distances by at least one step.
+typedef struct hsVolumeSwarm
+{
+    hsBox field;              // Coordinates the swarm may occupy
+    int numPnts;              // Number of points in the swarm
+    int *absX;                // X coordinate
+    int *absY;                // Y coordinate
+    int *absZ;                // Z coordinate
+    int *posNum;              // Uniquely number the points with this member (1 through numPnts)
+    hsKDTree_ptr tree_ptr;    // Spatial index of the swarm
+    int *nextCoord;           // Sweep buffer: nextCoord[index * HS_VOLUME_DIMS + dim] is a proposed coordinate
+    int *nextMoves;           // Sweep buffer: nextMoves[index] is the number of moves proposed (0 to stay put)
+} hsVolume, *hsVolume_ptr;
+
+
+/*
+    PURPOSE - Allocate a volume swarm scattered across a box-shaped field
+    INPUT
+        field_ptr - Pointer to the field
+        numPnts - Number of points in the swarm
+    OUTPUT
+        On success, pointer to a heap-allocated hsVolume struct
+        On failure, NULL
+    NOTES
+        Points are placed on distinct random coordinates by sampling without replacement (see:
+            rando_cell_index()) so this finishes in O(numPnts log numPnts) even if numPnts fills the field
+        It is the caller's responsibility to free the memory with free_volume_swarm()
+ */
+hsVolume_ptr build_volume_swarm(hsBox_ptr field_ptr, int numPnts);
+
+
+/*
+    PURPOSE - Calculate where the three axis-aligned lines through a point meet the field's walls
+    INPUT
+        field_ptr - Pointer to the field
+        coord_arr - HS_VOLUME_DIMS coordinates of the point
+        wall_arr - [Out] Array of HS_VOLUME_WALLS * HS_VOLUME_DIMS ints for the wall points, in the order
+            low x, high x, low y, high y, low z, high z
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        This is the volume equivalent of calculate_line_intercepts() and calc_two_dim_wall_points()
+ */
+bool calculate_plane_intercepts(hsBox_ptr field_ptr, int *coord_arr, int *wall_arr);
+
+
+/*
+    PURPOSE - Calculate the point equidistant from four points (the center of their circumscribed sphere)
+    INPUT
+        field_ptr - Pointer to the field (the result is clamped inside it)
+        pnt_arr - HS_VOLUME_NEIGHBOURS * HS_VOLUME_DIMS coordinates of the four points
+        target_arr - [Out] HS_VOLUME_DIMS coordinates of the rounded result
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        The determinant that decides whether the four points are coplanar is calculated exactly, in integers.
+            Coplanar points have no circumscribed sphere so their centroid is used instead.
+ */
+bool determine_tetrahedral_point(hsBox_ptr field_ptr, int *pnt_arr, int *target_arr);
+
+
+/*
+    PURPOSE - Find the four closest points to one point in the swarm
+    INPUT
+        volume_ptr - Pointer to a volume swarm
+        index - Index of the 'origin' point
+        coord_arr - HS_VOLUME_DIMS coordinates to measure from (usually the point's own, but not always)
+        intercepts - If true, the field's walls are treated as points
+        pnt_arr - [Out] HS_VOLUME_NEIGHBOURS * HS_VOLUME_DIMS ints for the closest points' coordinates
+        dist_arr - [Out] HS_VOLUME_NEIGHBOURS doubles for the closest points' distances
+    OUTPUT
+        On success, number of points found, closest first
+        On failure, -1
+    NOTES
+        The point at index is never one of its own neighbours
+        Safe to call from several threads at once as long as the swarm isn't moving (see: refresh_kd_tree())
+ */
+int find_volume_neighbours(hsVolume_ptr volume_ptr, int index, int *coord_arr, bool intercepts, int *pnt_arr,
+                           double *dist_arr);
+
+
+/*
+    PURPOSE - Move every point in the swarm once, simultaneously, toward equilibrium across a pool of threads
+    INPUT
+        volume_ptr - Pointer to a volume swarm
+        pool_ptr - Pointer to the worker pool to split the sweep across
+        maxMoves - Number of one-dimensional moves each point may move to pursue equilibrium
+        intercepts - If true, the field's walls will be treated as points for the purposes of equilibrium
+    OUTPUT
+        On success, total number of moves made by all points.  0 indicates equilibrium.
+        On failure, -1
+    NOTES
+        Like shwarm_line_jacobi_sweep(), every move is proposed from the same frozen swarm, across the pool,
+            and then committed.  Points step one coordinate at a time, along the axis with the furthest to
+            go, and stop short of occupied coordinates.
+        Proposals are committed on the calling thread, in index order, since the k-d tree isn't thread safe
+            to modify.  A proposal that lands on a coordinate an earlier commit has since taken is dropped so
+            the result doesn't depend on the number of threads.
+ */
+long shwarm_volume_sweep(hsVolume_ptr volume_ptr, hsPool_ptr pool_ptr, int maxMoves, bool intercepts);
+
+
+/*
+    PURPOSE - Verify every point in a volume swarm is inside the field on a coordinate of its own
+    INPUT
+        volume_ptr - Pointer to a volume swarm
+    OUTPUT
+        If so, true
+        Otherwise, false
+ */
+bool verify_volume_swarm(hsVolume_ptr volume_ptr);
+
+
+/*
+    PURPOSE - Free the heap-allocated memory associated with a volume swarm
+    INPUT
+        oldVolume_ptr - A pointer to a heap-allocated hsVolume struct pointer
+    OUTPUT
+        On success, true
+        On failure, false
+    NOTES
+        Call this function as free_volume_swarm(&myVolume_ptr);
+ */
+bool free_volume_swarm(hsVolume_ptr *oldVolume_ptr);
+
+
+#endif  // __HARKLEVOLUME__
@@ -1,19 +1,411 @@
+#include "Harklearena.h"        // hsArena_ptr, create_arena_shawarma_line()
 #include "Harklecurse.h"        // winDetails, winDetails_ptr
 #include "Harklerror.h"         // HARKLE_ERROR
+#include "Harkleline.h"         // hsLine_ptr, shwarm_line_sweep()
+#include "Harkleplane.h"        // hsPlane_ptr, shwarm_plane_sweep(), shwarm_plane_bulk_sweep()
+#include "Harklepool.h"         // hsPool_ptr
+#include "Harklerender.h"       // hsRender_ptr, hsRenderLoop_ptr, commit_render_move()
+#include "Harklesnap.h"         // hsSnapshot_ptr, map_swarm_snapshot(), verify_snapshot_swarm()
+#include "Harklestore.h"        // hsSwarm_ptr
 #include "Harkleswarm.h"
+#include "Harkletraj.h"         // hsTrajLog_ptr, hsTrajReader_ptr, log_trajectory_sweep(), replay_trajectory_sweep()
+#include "Harklevolume.h"       // hsVolume_ptr, shwarm_volume_sweep()
+#include <getopt.h>             // getopt_long()
+#include <limits.h>             // INT_MAX
 #include <ncurses.h>            // WINDOW
 #include <stdio.h>              // puts()
 #include <stdbool.h>            // bool, true, false
-#include <unistd.h>             // sleep()
+#include <stdlib.h>             // calloc(), free(), srand(), strtol()
+#include <string.h>             // memset(), strcmp()
+#include <time.h>               // clock_gettime()
 
-#define NUM_STARTING_POINTS 3  // Number of initial shawarma
-#define SLEEPY_SHAWARMA 1      // Number of seconds to sleep between shwarm iterations
+#define NUM_STARTING_POINTS 3        // Number of initial shawarma
+#define HEADLESS_MAX_SWEEPS 1000000  // Default number of headless sweeps before giving up on equilibrium
+#define HEADLESS_DEFAULT_SEED 1      // Default srand() seed (rand()'s own default)
+// Headless swarm engines
+#define HEADLESS_ENGINE_LIST 1       // shwarm_it() over the shawarma linked list
+#define HEADLESS_ENGINE_LINE 2       // shwarm_line_sweep() over a sorted swarm store
+#define HEADLESS_ENGINE_SOLVE 3      // shwarm_solve_one_dim() straight to equilibrium
+#define HEADLESS_ENGINE_ANIMATE 4    // shwarm_solve_one_dim() then shwarm_animate_one_dim() toward it
+#define HEADLESS_ENGINE_JACOBI 5     // shwarm_line_jacobi_sweep() across a pool of threads
+#define HEADLESS_ENGINE_LIST2D 6     // shwarm_it() over the shawarma linked list, in two dimensions
+#define HEADLESS_ENGINE_PLANE 7      // shwarm_plane_sweep() over a uniform grid, in two dimensions
+#define HEADLESS_ENGINE_VOLUME 8     // shwarm_volume_sweep() over a k-d tree, in three dimensions, across a pool
+#define HEADLESS_ENGINE_BULK 9       // shwarm_plane_bulk_sweep() over a uniform grid, in two dimensions
 
 // void print_debug_info(winDetails_ptr stdWin, winDetails_ptr fieldWin, shawarma_ptr headNode_ptr);
 
 // void print_node_info(shawarma_ptr node_ptr);
 
-int main(void)
+/*
+    PURPOSE - Run the swarm in an ncurses window
+    INPUT
+        frameRate - Number of times to redraw the field window each second
+    OUTPUT
+        On success, 0
+        On failure, -1
+    NOTES
+        The swarm is simulated at full speed on the calling thread, publishing every move, while a render
+            thread draws them frameRate times a second (see: start_render_loop())
+ */
+int shwarm_curses(int frameRate);
+
+/*
+    PURPOSE - Run the swarm to equilibrium, at full speed, without ncurses
+    INPUT
+        numRows - Number of rows in the (virtual) main window, replacing getmaxyx()
+        numCols - Number of columns in the (virtual) main window, replacing getmaxyx()
+        numPoints - Number of shawarma in the swarm
+        maxSweeps - Maximum number of sweeps to make before giving up on equilibrium
+        engine - HEADLESS_ENGINE_* value selecting the swarm engine
+        numThreads - Number of threads for the jacobi engine (0 for one per processor)
+        tolerance - Line engine only: stop once no point is more than this many steps from equilibrium
+            (-1 to wait for equilibrium)
+        convergence - Line engine only: if true, print every sweep's progress toward equilibrium
+        seed - srand() seed to scatter the swarm with
+        snapFile - [Optional] Swarm store engines only: write a snapshot of the swarm here when it's done
+        snapEvery - Also write snapFile every snapEvery sweeps (0 to only write it when it's done)
+        resumeFile - [Optional] Swarm store engines only: resume the swarm from this snapshot
+        trajFile - [Optional] Swarm store engines only: stream every sweep's moves to this trajectory log
+    OUTPUT
+        On success, 0
+        On failure, -1
+    NOTES
+        The field window is derived from numRows and numCols exactly the way shwarm_curses() derives it
+            from stdscr so the geometry of both modes matches
+        A resumed swarm takes its points, sweep count, total moves, intercept mode and seed from the snapshot.
+            Its field must match numRows and numCols and it must have been swarmed in as many dimensions.
+        A trajectory log starts from the swarm as it was before the first sweep (e.g., the resumed snapshot)
+        Prints the number of sweeps, total moves and wall time to stdout
+ */
+int shwarm_headless(int numRows, int numCols, int numPoints, int maxSweeps, int engine, int numThreads,
+                    int tolerance, bool convergence, unsigned int seed, char *snapFile, int snapEvery,
+                    char *resumeFile, char *trajFile);
+
+/*
+    PURPOSE - Run a swarm to equilibrium in three dimensions, at full speed, without ncurses
+    INPUT
+        numRows - Number of rows (y) in the field, walls included
+        numCols - Number of columns (x) in the field, walls included
+        numDepth - Number of layers (z) in the field, walls included
+        numPoints - Number of points in the swarm
+        maxSweeps - Maximum number of sweeps to make before giving up on equilibrium
+        numThreads - Number of threads to sweep with (0 for one per processor)
+    OUTPUT
+        On success, 0
+        On failure, -1
+    NOTES
+        There is no terminal to derive the field from so the outermost coordinate in every dimension is the
+            wall, the volume equivalent of a window's border
+        Prints the number of sweeps, total moves and wall time to stdout
+ */
+int shwarm_headless_volume(int numRows, int numCols, int numDepth, int numPoints, int maxSweeps, int numThreads);
+
+/*
+    PURPOSE - Convert a command line argument into a positive int
+    INPUT
+        arg - Command line argument to convert
+        outVal_ptr - Out parameter to store the converted value in
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+bool parse_positive_arg(char *arg, int *outVal_ptr);
+
+/*
+    PURPOSE - Convert a command line argument into a non-negative int
+    INPUT
+        arg - Command line argument to convert
+        outVal_ptr - Out parameter to store the converted value in
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+bool parse_non_negative_arg(char *arg, int *outVal_ptr);
+
+/*
+    PURPOSE - Convert a command line argument into a HEADLESS_ENGINE_* value
+    INPUT
+        arg - Command line argument to convert
+    OUTPUT
+        On success, a HEADLESS_ENGINE_* value
+        On failure, -1
+ */
+int parse_engine_arg(char *arg);
+
+/*
+    PURPOSE - Determine how many dimensions a headless engine swarms in
+    INPUT
+        engine - HEADLESS_ENGINE_* value
+    OUTPUT
+        1, 2 or 3
+ */
+int get_engine_dims(int engine);
+
+/*
+    PURPOSE - Determine if a headless engine keeps its swarm in a swarm store
+    INPUT
+        engine - HEADLESS_ENGINE_* value
+    OUTPUT
+        True if it does (and so can write and resume snapshots), false otherwise
+ */
+bool is_store_engine(int engine);
+
+/*
+    PURPOSE - Write a headless swarm store to a snapshot file
+    INPUT
+        snapFile - Snapshot file to write
+        swarm_ptr - Swarm store to write
+        numRows - Number of rows in the (virtual) main window
+        numCols - Number of columns in the (virtual) main window
+        engine - HEADLESS_ENGINE_* value swarming it
+        intercepts - Intercept mode the engine swarms with
+        numSweeps - Number of sweeps made so far
+        totalMoves - Number of moves made so far
+        seed - srand() seed the swarm was scattered with
+    OUTPUT
+        On success, true
+        On failure, false
+ */
+bool write_headless_snapshot(char *snapFile, hsSwarm_ptr swarm_ptr, int numRows, int numCols, int engine,
+                             bool intercepts, int numSweeps, long totalMoves, unsigned int seed);
+
+/*
+    PURPOSE - Replay a trajectory log, without simulating anything, and summarise the run it recorded
+    INPUT
+        trajFile - Trajectory log written by shwarm_headless()
+    OUTPUT
+        On success, 0
+        On failure, -1
+    NOTES
+        Prints the number of sweeps, the points moved, their total displacement and the replay's wall time
+            to stdout
+ */
+int replay_trajectory(char *trajFile);
+
+void print_usage(char *progName);
+
+
+int main(int argc, char *argv[])
+{
+    // LOCAL VARIABLES
+    int retVal = 0;                       // Program's return value
+    bool headless = false;                // Set this to true to swarm without ncurses
+    int engine = HEADLESS_ENGINE_LIST;    // Headless swarm engine
+    int numRows = 0;                      // Headless main window rows
+    int numCols = 0;                      // Headless main window columns
+    int numPoints = NUM_STARTING_POINTS;  // Headless number of shawarma
+    int maxSweeps = HEADLESS_MAX_SWEEPS;  // Headless sweep limit
+    int numThreads = 0;                   // Headless jacobi engine threads (0 for one per processor)
+    int numDepth = 0;                     // Headless volume engine layers (0 to match numRows)
+    int frameRate = 0;                    // ncurses frames per second (0 for HS_RENDER_DEFAULT_FPS)
+    int tolerance = -1;                   // Headless line engine residual tolerance (-1 for equilibrium)
+    bool convergence = false;             // Set this to true to print the line engine's progress each sweep
+    int seed = HEADLESS_DEFAULT_SEED;     // Headless srand() seed
+    char *snapFile = NULL;                // Headless snapshot to write
+    int snapEvery = 0;                    // Headless sweeps between snapshots (0 to only write the last one)
+    char *resumeFile = NULL;              // Headless snapshot to resume from
+    char *trajFile = NULL;                // Headless trajectory log to write
+    char *replayFile = NULL;              // Trajectory log to replay
+    bool showHelp = false;                // Print the usage and stop
+    int numArgs = 0;                      // Number of positional arguments
+    int opt = 0;                          // Return value from getopt_long()
+    struct option longOpts[] = {
+        { "headless", no_argument, NULL, 'H' },
+        { "engine", required_argument, NULL, 'e' },
+        { "threads", required_argument, NULL, 'j' },
+        { "depth", required_argument, NULL, 'D' },
+        { "tolerance", required_argument, NULL, 'T' },
+        { "convergence", no_argument, NULL, 'C' },
+        { "frame-rate", required_argument, NULL, 'r' },
+        { "seed", required_argument, NULL, 's' },
+        { "snapshot", required_argument, NULL, 'S' },
+        { "snapshot-every", required_argument, NULL, 'k' },
+        { "resume", required_argument, NULL, 'R' },
+        { "trajectory", required_argument, NULL, 't' },
+        { "replay", required_argument, NULL, 'P' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    // PARSE ARGUMENTS
+    while (0 == retVal && -1 != (opt = getopt_long(argc, argv, "He:j:D:T:Cr:s:S:k:R:t:P:h", longOpts, NULL)))
+    {
+        switch (opt)
+        {
+            case 'H':
+                headless = true;
+                break;
+            case 'e':
+                engine = parse_engine_arg(optarg);
+                if (0 > engine)
+                {
+                    HARKLE_ERROR(Shwarm_It, main, Invalid engine argument);
+                    retVal = -1;
+                }
+                break;
+            case 'j':
+                if (false == parse_positive_arg(optarg, &numThreads) || HS_POOL_MAX_THREADS < numThreads)
+                {
+                    HARKLE_ERROR(Shwarm_It, main, Invalid threads argument);
+                    retVal = -1;
+                }
+                break;
+            case 'D':
+                if (false == parse_positive_arg(optarg, &numDepth))
+                {
+                    HARKLE_ERROR(Shwarm_It, main, Invalid depth argument);
+                    retVal = -1;
+                }
+                break;
+            case 'T':
+                if (false == parse_non_negative_arg(optarg, &tolerance))
+                {
+                    HARKLE_ERROR(Shwarm_It, main, Invalid tolerance argument);
+                    retVal = -1;
+                }
+                break;
+            case 'C':
+                convergence = true;
+                break;
+            case 'r':
+                if (false == parse_positive_arg(optarg, &frameRate) || HS_RENDER_MAX_FPS < frameRate)
+                {
+                    HARKLE_ERROR(Shwarm_It, main, Invalid frame rate argument);
+                    retVal = -1;
+                }
+                break;
+            case 's':
+                if (false == parse_positive_arg(optarg, &seed))
+                {
+                    HARKLE_ERROR(Shwarm_It, main, Invalid seed argument);
+                    retVal = -1;
+                }
+                break;
+            case 'S':
+                snapFile = optarg;
+                break;
+            case 'k':
+                if (false == parse_positive_arg(optarg, &snapEvery))
+                {
+                    HARKLE_ERROR(Shwarm_It, main, Invalid snapshot-every argument);
+                    retVal = -1;
+                }
+                break;
+            case 'R':
+                resumeFile = optarg;
+                break;
+            case 't':
+                trajFile = optarg;
+                break;
+            case 'P':
+                replayFile = optarg;
+                break;
+            case 'h':
+                showHelp = true;
+                break;
+            default:
+                retVal = -1;
+                break;
+        }
+    }
+    numArgs = argc - optind;
+
+    if (0 == retVal && HEADLESS_ENGINE_LINE != engine && (0 <= tolerance || true == convergence))
+    {
+        HARKLE_ERROR(Shwarm_It, main, Residuals are only tracked by the line engine);
+        retVal = -1;
+    }
+    if (0 == retVal && 0 < numThreads
+        && (false == headless || (HEADLESS_ENGINE_JACOBI != engine && HEADLESS_ENGINE_VOLUME != engine)))
+    {
+        HARKLE_ERROR(Shwarm_It, main, Only the jacobi and volume engines use threads);
+        retVal = -1;
+    }
+    if (0 == retVal && HEADLESS_ENGINE_VOLUME != engine && 0 < numDepth)
+    {
+        HARKLE_ERROR(Shwarm_It, main, Only the volume engine has depth);
+        retVal = -1;
+    }
+    if (0 == retVal && true == headless && 0 < frameRate)
+    {
+        HARKLE_ERROR(Shwarm_It, main, Only the ncurses swarm has a frame rate);
+        retVal = -1;
+    }
+    if (0 == retVal && (snapFile || resumeFile) && (false == headless || false == is_store_engine(engine)))
+    {
+        HARKLE_ERROR(Shwarm_It, main, Only the headless swarm store engines take snapshots);
+        retVal = -1;
+    }
+    if (0 == retVal && 0 < snapEvery && !snapFile)
+    {
+        HARKLE_ERROR(Shwarm_It, main, There is no snapshot file to write every N sweeps);
+        retVal = -1;
+    }
+    if (0 == retVal && trajFile && (false == headless || false == is_store_engine(engine)))
+    {
+        HARKLE_ERROR(Shwarm_It, main, Only the headless swarm store engines log trajectories);
+        retVal = -1;
+    }
+    if (0 == retVal && replayFile && (true == headless || 0 < numArgs))
+    {
+        HARKLE_ERROR(Shwarm_It, main, A trajectory log is replayed on its own);
+        retVal = -1;
+    }
+
+    if (0 != retVal)
+    {
+        print_usage(argv[0]);
+    }
+    else if (true == showHelp)
+    {
+        print_usage(argv[0]);
+    }
+    else if (replayFile)
+    {
+        retVal = replay_trajectory(replayFile);
+    }
+    else if (false == headless && 0 == numArgs)
+    {
+        retVal = shwarm_curses(0 < frameRate ? frameRate : HS_RENDER_DEFAULT_FPS);
+    }
+    else if (true == headless && numArgs >= 2 && numArgs <= 4)
+    {
+        if (false == parse_positive_arg(argv[optind], &numRows)
+            || false == parse_positive_arg(argv[optind + 1], &numCols)
+            || (numArgs > 2 && false == parse_positive_arg(argv[optind + 2], &numPoints))
+            || (numArgs > 3 && false == parse_positive_arg(argv[optind + 3], &maxSweeps)))
+        {
+            HARKLE_ERROR(Shwarm_It, main, Invalid headless argument);
+            print_usage(argv[0]);
+            retVal = -1;
+        }
+        else if (HEADLESS_ENGINE_VOLUME == engine)
+        {
+            srand((unsigned int)seed);
+            retVal = shwarm_headless_volume(numRows, numCols, 0 < numDepth ? numDepth : numRows, numPoints,
+                                            maxSweeps, numThreads);
+        }
+        else
+        {
+            srand((unsigned int)seed);
+            retVal = shwarm_headless(numRows, numCols, numPoints, maxSweeps, engine, numThreads, tolerance,
+                                     convergence, (unsigned int)seed, snapFile, snapEvery, resumeFile,
+                                     trajFile);
+        }
+    }
+    else
+    {
+        print_usage(argv[0]);
+        retVal = -1;
+    }
+
+    // DONE
+    return retVal;
+}
+
+
+int shwarm_curses(int frameRate)
 {
     // LOCAL VARIABLES
     int retVal = 0;                    // Program's return value
@@ -21,11 +413,22 @@ int main(void)
     winDetails_ptr stdWin = NULL;      // hCurseWinDetails struct pointer for the stdscr window
     winDetails_ptr fieldWin = NULL;    // hCurseWinDetails struct pointer for the field window
     shawarma_ptr headNode_ptr = NULL;  // Head node of the linked list of shawarmas
+    hsRender_ptr render_ptr = NULL;    // Redraws only the field window cells that change
+    hsRenderLoop_ptr loop_ptr = NULL;  // Draws the published moves frameRate times a second
+    winDetails simWin;                 // fieldWin without its window, so swarming never draws
+    shawarma_ptr srcNode_ptr = NULL;   // The node being swarmed
+    int oldX = 0;                      // srcNode_ptr's x coordinate before it's swarmed
+    int oldY = 0;                      // srcNode_ptr's y coordinate before it's swarmed
+    int *pntX = NULL;                  // Every point's starting x coordinate, indexed by posNum - 1
+    int *pntY = NULL;                  // Every point's starting y coordinate, indexed by posNum - 1
+    char *pntGraphic = NULL;           // Every point's graphic, indexed by posNum - 1
     int tmpNumMoves = 0;               // Capture error codes before incrementing numMoves
     int numMoves = 0;                  // Number of total moves made each 'cycle'
     int i = 0;                         // Iterating variable
     // Current number of points
     int curNumPoints = NUM_STARTING_POINTS;
+
+    memset(&simWin, 0x0, sizeof(simWin));
     
     // SETUP THE WINDOWS
     if (true == success)
@@ -41,7 +444,7 @@ int main(void)
 
         if (!stdWin)
         {
-            HARKLE_ERROR(Shwarm_It, main, build_a_winDetails_ptr failed);
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, build_a_winDetails_ptr failed);
             success = false;
         }
         else
@@ -53,7 +456,7 @@ int main(void)
             getmaxyx(stdscr, stdWin->nRows, stdWin->nCols);  // Determine the maximum dimensions
             if (ERR == stdWin->nRows || ERR == stdWin->nCols)
             {
-                HARKLE_ERROR(Shwarm_It, main, getmaxyx failed);
+                HARKLE_ERROR(Shwarm_It, shwarm_curses, getmaxyx failed);
                 success = false;
             }
             else
@@ -64,7 +467,7 @@ int main(void)
 
                 if (OK != retVal)
                 {
-                    HARKLE_ERROR(Shwarm_It, main, wborder failed);
+                    HARKLE_ERROR(Shwarm_It, shwarm_curses, wborder failed);
                     success = false;
                 }
             }
@@ -80,7 +483,7 @@ int main(void)
 
         if (!fieldWin)
         {
-            HARKLE_ERROR(Shwarm_It, main, populate_a_winDetails_ptr failed);
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, populate_a_winDetails_ptr failed);
             success = false;
         }
         else
@@ -90,7 +493,7 @@ int main(void)
 
             if (OK != retVal)
             {
-                HARKLE_ERROR(Shwarm_It, main, wborder failed);
+                HARKLE_ERROR(Shwarm_It, shwarm_curses, wborder failed);
                 success = false;
             }
         }
@@ -101,12 +504,31 @@ int main(void)
     {
         if (OK != wrefresh(fieldWin->win_ptr))  // Print it on the real screen
         {
-            HARKLE_ERROR(Shwarm_It, main, wrefresh failed on fieldWin);
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, wrefresh failed on fieldWin);
             success = false;
         }
     }
     // getchar();  // DEBUGGING
 
+    // 5. Draw only what changes from here on
+    if (true == success)
+    {
+        render_ptr = build_renderer(stdWin, fieldWin);
+
+        if (!render_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, build_renderer failed);
+            success = false;
+        }
+        else
+        {
+            // The swarm is simulated against a copy of the field without a window so the renderer does all the
+            //  drawing (instead of clear_this_coord() inside every move)
+            simWin = *fieldWin;
+            simWin.win_ptr = NULL;
+        }
+    }
+
     // SETUP SWARM
     // 1. Create swarm
     if (true == success)
@@ -119,7 +541,7 @@ int main(void)
 
         if (!headNode_ptr)
         {
-            HARKLE_ERROR(Shwarm_It, main, create_shawarma_list failed);
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, create_shawarma_list failed);
             success = false;
         }
     }
@@ -147,20 +569,66 @@ while (tmpNode_ptr)
     tmpNode_ptr = tmpNode_ptr->nextPnt;
 }
 /* DEBUGGING END */
-        // Update field window
-        if (false == print_plot_list(fieldWin->win_ptr, headNode_ptr))
+        // Update field window (every point, this once)
+        for (srcNode_ptr = headNode_ptr; srcNode_ptr && true == success; srcNode_ptr = srcNode_ptr->nextPnt)
         {
-            HARKLE_ERROR(Shwarm_It, main, print_plot_list failed);
+            if (false == record_render_point(render_ptr, srcNode_ptr->absX, srcNode_ptr->absY, srcNode_ptr->graphic))
+            {
+                HARKLE_ERROR(Shwarm_It, shwarm_curses, record_render_point failed);
+                success = false;
+            }
+        }
+        if (true == success && false == flush_renderer(render_ptr))  // Print it on the real screen
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, flush_renderer failed);
             success = false;
             // print_debug_info(stdWin, fieldWin, headNode_ptr);  // DEBUGGING
         }
-        else if (OK != wrefresh(fieldWin->win_ptr))  // Print it on the real screen
+    }
+    // getchar();  // DEBUGGING
+
+    // 3. Hand the screen to the render thread
+    if (true == success)
+    {
+        pntX = calloc(curNumPoints, sizeof(int));
+        pntY = calloc(curNumPoints, sizeof(int));
+        pntGraphic = calloc(curNumPoints, sizeof(char));
+
+        if (!pntX || !pntY || !pntGraphic)
         {
-            HARKLE_ERROR(Shwarm_It, main, wrefresh failed on fieldWin);
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, calloc failed);
             success = false;
         }
+        else
+        {
+            for (i = 1; i <= curNumPoints && true == success; i++)
+            {
+                srcNode_ptr = get_pos_num(headNode_ptr, i);
+
+                if (!srcNode_ptr)
+                {
+                    HARKLE_ERROR(Shwarm_It, shwarm_curses, get_pos_num failed);
+                    success = false;
+                }
+                else
+                {
+                    pntX[i - 1] = srcNode_ptr->absX;
+                    pntY[i - 1] = srcNode_ptr->absY;
+                    pntGraphic[i - 1] = srcNode_ptr->graphic;
+                }
+            }
+        }
+        if (true == success)
+        {
+            loop_ptr = start_render_loop(render_ptr, curNumPoints, pntX, pntY, pntGraphic, frameRate, 0);
+
+            if (!loop_ptr)
+            {
+                HARKLE_ERROR(Shwarm_It, shwarm_curses, start_render_loop failed);
+                success = false;
+            }
+        }
     }
-    // getchar();  // DEBUGGING
 
     // START SWARMING
     if (true == success)
@@ -172,65 +640,60 @@ while (tmpNode_ptr)
 
             for (i = 1; i <= curNumPoints; i++)
             {
-                // tmpNumMoves = shwarm_it(fieldWin, headNode_ptr, HS_MAX_SWARM_MOVES, i, 1, false);
-                tmpNumMoves = shwarm_it(fieldWin, headNode_ptr, HS_MAX_SWARM_MOVES, i, 1, true);
+                srcNode_ptr = get_pos_num(headNode_ptr, i);
+
+                if (!srcNode_ptr)
+                {
+                    HARKLE_ERROR(Shwarm_It, shwarm_curses, get_pos_num failed);
+                    success = false;
+                    break;
+                }
+
+                oldX = srcNode_ptr->absX;
+                oldY = srcNode_ptr->absY;
+                // tmpNumMoves = shwarm_it(&simWin, headNode_ptr, HS_MAX_SWARM_MOVES, i, 1, false);
+                tmpNumMoves = shwarm_it(&simWin, headNode_ptr, HS_MAX_SWARM_MOVES, i, 1, true);
                 // printf("Node %d was moved %d times.\n", i, tmpNumMoves);  // DEBUGGING
 
                 if (0 > tmpNumMoves)
                 {
-                    HARKLE_ERROR(Shwarm_It, main, shwarm_it failed);
+                    HARKLE_ERROR(Shwarm_It, shwarm_curses, shwarm_it failed);
                     success = false;
                     getchar();  // DEBUGGING
                     break;
                 }
+                else if (false == commit_render_move(loop_ptr, i - 1, oldX, oldY, srcNode_ptr->absX,
+                                                     srcNode_ptr->absY))
+                {
+                    HARKLE_ERROR(Shwarm_It, shwarm_curses, commit_render_move failed);
+                    success = false;
+                    break;
+                }
                 else
                 {
                     numMoves += tmpNumMoves;
                 }
             }
-
-            // Update field window
-            // clear();  // Clear the screen
-            // if (OK != wrefresh(stdWin->win_ptr))  // Print it on the real screen
-            // {
-            //     HARKLE_ERROR(Shwarm_It, main, wrefresh failed on stdWin);
-            //     success = false;
-            // }
-            // else if (OK != wrefresh(fieldWin->win_ptr))  // Print it on the real screen
-            // {
-            //     HARKLE_ERROR(Shwarm_It, main, wrefresh failed on fieldWin);
-            //     success = false;
-            // }
-            if (false == print_plot_list(fieldWin->win_ptr, headNode_ptr))
-            {
-                HARKLE_ERROR(Shwarm_It, main, print_plot_list failed);
-                success = false;
-                print_debug_info(stdWin, fieldWin, headNode_ptr);
-            }
-            else if (OK != wrefresh(fieldWin->win_ptr))  // Print it on the real screen
-            {
-                HARKLE_ERROR(Shwarm_It, main, wrefresh failed on fieldWin);
-                success = false;
-            }
-            else
-            {
-                // 𝄞 Why are you sleepy? ♬
-                // ♩ Sleepy thread ♪
-                // ♭ Thread is sleepy ♫
-                // 𝄫 Sleepy thread ♫
-                sleep(SLEEPY_SHAWARMA);
-            }
         }
         while (numMoves && true == success);  // Keep swarming until equilibrium is reached
     }
 
     // END THE SWARM
+    // Draw the final moves and take the screen back from the render thread
+    if (loop_ptr)
+    {
+        if (false == free_render_loop(&loop_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, free_render_loop failed);
+            success = false;
+        }
+    }
     if (true == success)
     {
         // Print "Press any key to end race"
         if (OK != mvwaddstr(stdWin->win_ptr, 1, 1, "Press any key to end the swarm"))
         {
-            HARKLE_ERROR(Shwarm_It, main, mvwaddstr failed);
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, mvwaddstr failed);
             success = false;
         }
         // print_debug_info(stdWin, fieldWin, headNode_ptr);  // DEBUGGING
@@ -239,6 +702,27 @@ while (tmpNode_ptr)
     }
 
 	// CLEAN UP
+    // Coordinates
+    if (pntX)
+    {
+        free(pntX);
+    }
+    if (pntY)
+    {
+        free(pntY);
+    }
+    if (pntGraphic)
+    {
+        free(pntGraphic);
+    }
+    // Renderer
+    if (render_ptr)
+    {
+        if (false == free_renderer(&render_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, free_renderer failed);
+        }
+    }
 	// ncurses Windows
     // 1. fieldWin
     if (fieldWin)
@@ -246,12 +730,12 @@ while (tmpNode_ptr)
         // Delete the field window
         if (OK != kill_a_window(&(fieldWin->win_ptr)))
         {
-            HARKLE_ERROR(Shwarm_It, main, kill_a_window failed);
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, kill_a_window failed);
         }
         // Free the struct
         if (false == kill_a_winDetails_ptr(&fieldWin))
         {
-            HARKLE_ERROR(Shwarm_It, main, kill_a_winDetails_ptr failed);
+            HARKLE_ERROR(Shwarm_It, shwarm_curses, kill_a_winDetails_ptr failed);
         }
     }
 	// 2. stdWin
@@ -260,12 +744,12 @@ while (tmpNode_ptr)
 		// Delete the main window
         if (OK != kill_a_window(&(stdWin->win_ptr)))
 		{
-			HARKLE_ERROR(Shwarm_It, main, kill_a_window failed);
+			HARKLE_ERROR(Shwarm_It, shwarm_curses, kill_a_window failed);
 		}
 		// Free the struct
 		if (false == kill_a_winDetails_ptr(&stdWin))
 		{
-			HARKLE_ERROR(Shwarm_It, main, kill_a_winDetails_ptr failed);	
+			HARKLE_ERROR(Shwarm_It, shwarm_curses, kill_a_winDetails_ptr failed);	
 		}
 	}
     
@@ -282,6 +766,955 @@ while (tmpNode_ptr)
 }
 
 
+int shwarm_headless(int numRows, int numCols, int numPoints, int maxSweeps, int engine, int numThreads,
+                    int tolerance, bool convergence, unsigned int seed, char *snapFile, int snapEvery,
+                    char *resumeFile, char *trajFile)
+{
+    // LOCAL VARIABLES
+    int retVal = 0;                    // Function's return value
+    bool success = true;               // Set this to false if anything fails
+    winDetails_ptr fieldWin = NULL;    // hCurseWinDetails struct pointer for the (virtual) field window
+    hsArena_ptr arena_ptr = NULL;      // Every shawarma node comes from here
+    shawarma_ptr headNode_ptr = NULL;  // Head node of the linked list of shawarmas
+    hsSwarm_ptr swarm_ptr = NULL;      // Swarm store for the store-based engines
+    hsLine_ptr line_ptr = NULL;        // Line engine
+    hsPool_ptr pool_ptr = NULL;        // Worker threads for the jacobi engine
+    hsPlane_ptr plane_ptr = NULL;      // Plane engine
+    hsSnapshot_ptr snap_ptr = NULL;    // Snapshot to resume from
+    hsTrajLog_ptr traj_ptr = NULL;     // Trajectory log to stream every sweep's moves to
+    hsTrajHeader trajHeader;           // Describes the run to the trajectory log
+    long trajEntries = 0;              // Number of moved points logged to the trajectory log
+    long trajStalls = 0;               // Number of times a sweep waited on the trajectory log's writer thread
+    int numDim = 1;                    // Number of dimensions the engine swarms in
+    bool intercepts = true;            // Treat the field's edges as points
+    int tmpNumMoves = 0;               // Capture error codes before incrementing numMoves
+    long numMoves = 0;                 // Number of total moves made each 'cycle'
+    long totalMoves = 0;               // Number of moves made across all cycles
+    int numSweeps = 0;                 // Number of cycles made
+    bool settled = false;              // Set this to true once the swarm is within tolerance (or solved)
+    hsLineStats_ptr stats_ptr = NULL;  // Line engine's progress
+    int lineLen = 0;                   // Number of diagonal coordinates available in the field
+    int snapMaxX = 0;                  // Largest x coordinate a resumed swarm may hold
+    int snapMaxY = 0;                  // Largest y coordinate a resumed swarm may hold
+    int i = 0;                         // Iterating variable
+    struct timespec startTime;         // Wall time before swarming
+    struct timespec stopTime;          // Wall time after swarming
+
+    // SETUP THE FIELD
+    // 1. Field Window (no ncurses window, just the dimensions)
+    if (numRows <= (2 * HS_OUTER_BORDER_WIDTH_V) + 2 || numCols <= (2 * HS_OUTER_BORDER_WIDTH_H) + 2)
+    {
+        HARKLE_ERROR(Shwarm_It, shwarm_headless, Field dimensions are too small);
+        success = false;
+    }
+    else
+    {
+        fieldWin = build_a_winDetails_ptr();
+
+        if (!fieldWin)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, build_a_winDetails_ptr failed);
+            success = false;
+        }
+        else
+        {
+            fieldWin->win_ptr = NULL;  // Headless
+            fieldWin->nRows = numRows - (2 * HS_OUTER_BORDER_WIDTH_V);
+            fieldWin->nCols = numCols - (2 * HS_OUTER_BORDER_WIDTH_H);
+            fieldWin->upperR = HS_OUTER_BORDER_WIDTH_V;
+            fieldWin->leftC = HS_OUTER_BORDER_WIDTH_H;
+        }
+    }
+
+    // SETUP SWARM
+    numDim = get_engine_dims(engine);
+
+    // 0. Map the snapshot to resume from, and carry on where it left off
+    if (true == success && resumeFile)
+    {
+        snap_ptr = map_swarm_snapshot(resumeFile);
+
+        if (!snap_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, map_swarm_snapshot failed);
+            success = false;
+        }
+        else if (2 != snap_ptr->header_ptr->numDims || numRows != snap_ptr->header_ptr->numRows
+                 || numCols != snap_ptr->header_ptr->numCols)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, The snapshot is from a different field);
+            success = false;
+        }
+        else if (numDim != get_engine_dims(snap_ptr->header_ptr->engine))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, The snapshot was swarmed in a different dimension);
+            success = false;
+        }
+        else if (0 > snap_ptr->header_ptr->numSweeps || INT_MAX < snap_ptr->header_ptr->numSweeps
+                 || 0 > snap_ptr->header_ptr->totMoves)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, The snapshot has an invalid sweep or move count);
+            success = false;
+        }
+        else
+        {
+            numPoints = snap_ptr->header_ptr->numPnts;
+            numSweeps = (int)snap_ptr->header_ptr->numSweeps;
+            totalMoves = (long)snap_ptr->header_ptr->totMoves;
+            intercepts = 0 != snap_ptr->header_ptr->intercepts;
+            seed = (unsigned int)snap_ptr->header_ptr->rngSeed;
+        }
+    }
+
+    // 1. Create swarm along a diagonal line (same slope as the ncurses mode), or scattered across the field
+    if (true == success)
+    {
+        lineLen = fieldWin->nCols - 2 - (fieldWin->leftC + 1 - HS_OUTER_BORDER_WIDTH_H) + 1;
+        if (fieldWin->nRows - 2 - (fieldWin->upperR + 1 - HS_OUTER_BORDER_WIDTH_V) + 1 < lineLen)
+        {
+            lineLen = fieldWin->nRows - 2 - (fieldWin->upperR + 1 - HS_OUTER_BORDER_WIDTH_V) + 1;
+        }
+
+        // A resumed swarm must lie inside the field.  In one dimension the far end is pushed out by leftC and
+        //  upperR: the line is seeded in window coordinates but its intercepts are absolute (see:
+        //  shwarm_solve_one_dim()) so the one dimensional engines legitimately swarm that far.
+        snapMaxX = fieldWin->nCols - 2 + ((1 == numDim) ? fieldWin->leftC : 0);
+        snapMaxY = fieldWin->nRows - 2 + ((1 == numDim) ? fieldWin->upperR : 0);
+
+        if (numPoints < 2 || (1 == numDim && numPoints > lineLen)
+            || (2 == numDim && numPoints > (fieldWin->nCols - 2) * (fieldWin->nRows - 2)))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, Invalid number of points for this field);
+            success = false;
+        }
+        else if (snap_ptr && false == verify_snapshot_swarm(snap_ptr, snapMaxX, snapMaxY))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, The snapshot swarm does not fit this field);
+            success = false;
+        }
+        else if (!snap_ptr)
+        {
+            // One slab holds the entire swarm
+            arena_ptr = build_shawarma_arena(numPoints);
+
+            if (!arena_ptr)
+            {
+                HARKLE_ERROR(Shwarm_It, shwarm_headless, build_shawarma_arena failed);
+                success = false;
+            }
+        }
+    }
+    if (true == success && snap_ptr)
+    {
+        // Nothing to create: the swarm store is copied straight out of the snapshot
+    }
+    else if (true == success && 2 == numDim)
+    {
+        headNode_ptr = create_arena_shawarma_list(arena_ptr, 1, fieldWin->nCols - 2, 1, fieldWin->nRows - 2,
+                                                  numPoints, 0, 0);
+
+        if (!headNode_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, create_arena_shawarma_list failed);
+            success = false;
+        }
+    }
+    else if (true == success)
+    {
+        headNode_ptr = create_arena_shawarma_line(arena_ptr, fieldWin->leftC + 1 - HS_OUTER_BORDER_WIDTH_H,
+                                                  fieldWin->upperR + 1 - HS_OUTER_BORDER_WIDTH_V,
+                                                  fieldWin->leftC + 1 - HS_OUTER_BORDER_WIDTH_H + lineLen - 1,
+                                                  fieldWin->upperR + 1 - HS_OUTER_BORDER_WIDTH_V + lineLen - 1,
+                                                  numPoints, 0, 0);
+
+        if (!headNode_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, create_arena_shawarma_line failed);
+            success = false;
+        }
+    }
+
+    // 2. Copy the swarm into a swarm store
+    if (true == success && true == is_store_engine(engine))
+    {
+        if (snap_ptr)
+        {
+            swarm_ptr = swarm_from_arrays(numPoints, snap_ptr->absX, snap_ptr->absY, snap_ptr->posNum,
+                                          snap_ptr->graphic);
+        }
+        else
+        {
+            swarm_ptr = swarm_from_shawarma_list(headNode_ptr);
+        }
+
+        if (!swarm_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, Failed to build the swarm store);
+            success = false;
+        }
+        // Catch any collision as soon as it happens (the jacobi engine is checked once it's done instead)
+        else if (HEADLESS_ENGINE_JACOBI != engine
+                 && false == attach_swarm_occupancy(swarm_ptr, 0, numCols - 1, 0, numRows - 1))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, attach_swarm_occupancy failed);
+            success = false;
+        }
+    }
+
+    // 3. Start the worker threads
+    if (true == success && HEADLESS_ENGINE_JACOBI == engine)
+    {
+        pool_ptr = build_worker_pool(numThreads);
+
+        if (!pool_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, build_worker_pool failed);
+            success = false;
+        }
+    }
+
+    // 4. Start the trajectory log's writer thread
+    if (true == success && trajFile)
+    {
+        memset(&trajHeader, 0x0, sizeof(trajHeader));
+        trajHeader.numRows = numRows;
+        trajHeader.numCols = numCols;
+        trajHeader.engine = engine;
+        trajHeader.numPnts = swarm_ptr->numPnts;
+        trajHeader.firstSweep = numSweeps;
+        traj_ptr = open_trajectory_log(trajFile, &trajHeader, swarm_ptr->posNum, swarm_ptr->absX, swarm_ptr->absY);
+
+        if (!traj_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, open_trajectory_log failed);
+            success = false;
+        }
+    }
+
+    // START SWARMING
+    if (true == success)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+        if (HEADLESS_ENGINE_PLANE == engine || HEADLESS_ENGINE_BULK == engine)
+        {
+            plane_ptr = build_plane_engine(swarm_ptr, 0);
+
+            if (!plane_ptr)
+            {
+                HARKLE_ERROR(Shwarm_It, shwarm_headless, build_plane_engine failed);
+                success = false;
+            }
+        }
+        else if (HEADLESS_ENGINE_LIST != engine && HEADLESS_ENGINE_LIST2D != engine)
+        {
+            line_ptr = build_line_engine(swarm_ptr);
+
+            if (!line_ptr)
+            {
+                HARKLE_ERROR(Shwarm_It, shwarm_headless, build_line_engine failed);
+                success = false;
+            }
+            else if ((0 <= tolerance || true == convergence) && false == track_line_equilibrium(line_ptr, true))
+            {
+                HARKLE_ERROR(Shwarm_It, shwarm_headless, track_line_equilibrium failed);
+                success = false;
+            }
+            else
+            {
+                stats_ptr = &(line_ptr->sweepStats);
+            }
+        }
+
+        if (true == success && true == convergence)
+        {
+            printf("%8s %10s %10s %14s %12s %10s\n", "Sweep", "Moves", "Moved", "Tot residual", "Max residual",
+                   "Unsettled");
+        }
+
+        while (true == success)
+        {
+            switch (engine)
+            {
+                case HEADLESS_ENGINE_LIST:
+                case HEADLESS_ENGINE_LIST2D:
+                    numMoves = 0;  // Reset counting variable
+
+                    for (i = 1; i <= numPoints; i++)
+                    {
+                        tmpNumMoves = shwarm_it(fieldWin, headNode_ptr, HS_MAX_SWARM_MOVES, i, numDim, intercepts);
+
+                        if (0 > tmpNumMoves)
+                        {
+                            HARKLE_ERROR(Shwarm_It, shwarm_headless, shwarm_it failed);
+                            success = false;
+                            break;
+                        }
+                        else
+                        {
+                            numMoves += tmpNumMoves;
+                        }
+                    }
+                    break;
+                case HEADLESS_ENGINE_LINE:
+                    numMoves = shwarm_line_sweep(fieldWin, line_ptr, HS_MAX_SWARM_MOVES, intercepts);
+
+                    if (0 > numMoves)
+                    {
+                        HARKLE_ERROR(Shwarm_It, shwarm_headless, shwarm_line_sweep failed);
+                        success = false;
+                    }
+                    break;
+                case HEADLESS_ENGINE_SOLVE:
+                    numMoves = shwarm_solve_one_dim(fieldWin, line_ptr, intercepts, false);
+
+                    if (0 > numMoves)
+                    {
+                        HARKLE_ERROR(Shwarm_It, shwarm_headless, shwarm_solve_one_dim failed);
+                        success = false;
+                    }
+                    else
+                    {
+                        settled = true;  // One 'sweep' reaches equilibrium
+                    }
+                    break;
+                case HEADLESS_ENGINE_ANIMATE:
+                    if (false == line_ptr->hasTargets
+                        && 0 > shwarm_solve_one_dim(fieldWin, line_ptr, intercepts, true))
+                    {
+                        HARKLE_ERROR(Shwarm_It, shwarm_headless, shwarm_solve_one_dim failed);
+                        success = false;
+                    }
+                    else
+                    {
+                        numMoves = shwarm_animate_one_dim(fieldWin, line_ptr, HS_MAX_SWARM_MOVES);
+
+                        if (0 > numMoves)
+                        {
+                            HARKLE_ERROR(Shwarm_It, shwarm_headless, shwarm_animate_one_dim failed);
+                            success = false;
+                        }
+                    }
+                    break;
+                case HEADLESS_ENGINE_JACOBI:
+                    numMoves = shwarm_line_jacobi_sweep(fieldWin, line_ptr, pool_ptr, HS_MAX_SWARM_MOVES, intercepts);
+
+                    if (0 > numMoves)
+                    {
+                        HARKLE_ERROR(Shwarm_It, shwarm_headless, shwarm_line_jacobi_sweep failed);
+                        success = false;
+                    }
+                    break;
+                case HEADLESS_ENGINE_PLANE:
+                    numMoves = shwarm_plane_sweep(fieldWin, plane_ptr, HS_MAX_SWARM_MOVES, intercepts);
+
+                    if (0 > numMoves)
+                    {
+                        HARKLE_ERROR(Shwarm_It, shwarm_headless, shwarm_plane_sweep failed);
+                        success = false;
+                    }
+                    break;
+                case HEADLESS_ENGINE_BULK:
+                    numMoves = shwarm_plane_bulk_sweep(fieldWin, plane_ptr, HS_MAX_SWARM_MOVES, intercepts);
+
+                    if (0 > numMoves)
+                    {
+                        HARKLE_ERROR(Shwarm_It, shwarm_headless, shwarm_plane_bulk_sweep failed);
+                        success = false;
+                    }
+                    break;
+                default:
+                    HARKLE_ERROR(Shwarm_It, shwarm_headless, Unsupported engine);
+                    success = false;
+                    break;
+            }
+
+            if (true == success)
+            {
+                totalMoves += numMoves;
+                numSweeps++;
+
+                // Log the sweep (the writer thread does the writing)
+                if (traj_ptr && false == log_trajectory_sweep(traj_ptr, swarm_ptr->absX, swarm_ptr->absY))
+                {
+                    HARKLE_ERROR(Shwarm_It, shwarm_headless, log_trajectory_sweep failed);
+                    success = false;
+                }
+
+                // Checkpoint
+                if (snapFile && 0 < snapEvery && 0 == numSweeps % snapEvery
+                    && false == write_headless_snapshot(snapFile, swarm_ptr, numRows, numCols, engine, intercepts,
+                                                        numSweeps, totalMoves, seed))
+                {
+                    HARKLE_ERROR(Shwarm_It, shwarm_headless, write_headless_snapshot failed);
+                    success = false;
+                }
+
+                if (true == convergence)
+                {
+                    printf("%8ld %10ld %10d %14lld %12d %10d\n", stats_ptr->sweepNum, stats_ptr->numMoves,
+                           stats_ptr->numMoved, stats_ptr->totResidual, stats_ptr->maxResidual,
+                           stats_ptr->numUnsettled);
+                }
+                if (0 <= tolerance && true == stats_ptr->hasResiduals && stats_ptr->maxResidual <= tolerance)
+                {
+                    settled = true;
+                }
+            }
+
+            // Keep swarming until equilibrium (or the tolerance) is reached
+            if (0 == numMoves || true == settled || numSweeps >= maxSweeps)
+            {
+                break;
+            }
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &stopTime);
+    }
+
+    // 5. Verify no two points collided
+    if (true == success && HEADLESS_ENGINE_JACOBI == engine
+        && false == attach_swarm_occupancy(swarm_ptr, 0, numCols - 1, 0, numRows - 1))
+    {
+        HARKLE_ERROR(Shwarm_It, shwarm_headless, The jacobi engine left two points on one coordinate);
+        success = false;
+    }
+
+    // 6. Copy the results back into the linked list
+    if (true == success && swarm_ptr && headNode_ptr)
+    {
+        success = sync_shawarma_list(swarm_ptr, headNode_ptr);
+
+        if (false == success)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, sync_shawarma_list failed);
+        }
+    }
+
+    // 7. Write the final snapshot (even short of equilibrium, so the run can be resumed)
+    if (true == success && snapFile
+        && false == write_headless_snapshot(snapFile, swarm_ptr, numRows, numCols, engine, intercepts, numSweeps,
+                                            totalMoves, seed))
+    {
+        HARKLE_ERROR(Shwarm_It, shwarm_headless, write_headless_snapshot failed);
+        success = false;
+    }
+
+    // 8. Write what's left of the trajectory log
+    if (traj_ptr)
+    {
+        trajEntries = traj_ptr->numEntries;
+        trajStalls = traj_ptr->numStalls;
+
+        if (false == close_trajectory_log(&traj_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, close_trajectory_log failed);
+            success = false;
+        }
+    }
+
+    // REPORT
+    if (true == success)
+    {
+        if (numMoves && false == settled)
+        {
+            fprintf(stderr, "Equilibrium was not reached within %d sweeps\n", maxSweeps);
+            success = false;
+        }
+        if (resumeFile)
+        {
+            printf("Resumed:     %s at sweep %lld\n", resumeFile, (long long)snap_ptr->header_ptr->numSweeps);
+        }
+        if (snapFile)
+        {
+            printf("Snapshot:    %s at sweep %d\n", snapFile, numSweeps);
+        }
+        if (trajFile)
+        {
+            printf("Trajectory:  %s, %ld points moved (%ld stalls)\n", trajFile, trajEntries, trajStalls);
+        }
+        printf("Points:      %d\n", numPoints);
+        if (pool_ptr)
+        {
+            printf("Threads:     %d\n", pool_ptr->numThreads);
+        }
+        printf("Field:       %d x %d\n", fieldWin->nCols, fieldWin->nRows);
+        printf("Iterations:  %d\n", numSweeps);
+        printf("Total moves: %ld\n", totalMoves);
+        if (stats_ptr && true == stats_ptr->hasResiduals)
+        {
+            printf("Residual:    %lld total, %d max, %d unsettled\n", stats_ptr->totResidual,
+                   stats_ptr->maxResidual, stats_ptr->numUnsettled);
+        }
+        printf("Wall time:   %.6f seconds\n", (stopTime.tv_sec - startTime.tv_sec)
+               + ((stopTime.tv_nsec - startTime.tv_nsec) / 1000000000.0));
+
+        for (i = 0; pool_ptr && i < pool_ptr->numThreads; i++)
+        {
+            printf("Thread %3d:  %ld chunks (%ld stolen), %.6f seconds busy, %.6f seconds idle\n", i,
+                   pool_ptr->worker_arr[i].stats.numChunks, pool_ptr->worker_arr[i].stats.numSteals,
+                   pool_ptr->worker_arr[i].stats.busySecs, pool_ptr->worker_arr[i].stats.idleSecs);
+        }
+    }
+
+    // CLEAN UP
+    if (snap_ptr)
+    {
+        if (false == unmap_swarm_snapshot(&snap_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, unmap_swarm_snapshot failed);
+        }
+    }
+    if (pool_ptr)
+    {
+        if (false == free_worker_pool(&pool_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, free_worker_pool failed);
+        }
+    }
+    if (plane_ptr)
+    {
+        if (false == free_plane_engine(&plane_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, free_plane_engine failed);
+        }
+    }
+    if (line_ptr)
+    {
+        if (false == free_line_engine(&line_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, free_line_engine failed);
+        }
+    }
+    if (swarm_ptr)
+    {
+        if (false == free_swarm_store(&swarm_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, free_swarm_store failed);
+        }
+    }
+    if (arena_ptr)
+    {
+        // Releases every node in headNode_ptr's linked list at once
+        if (false == free_shawarma_arena(&arena_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, free_shawarma_arena failed);
+        }
+        headNode_ptr = NULL;
+    }
+    if (fieldWin)
+    {
+        if (false == kill_a_winDetails_ptr(&fieldWin))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless, kill_a_winDetails_ptr failed);
+        }
+    }
+
+    // DONE
+    if (false == success)
+    {
+        retVal = -1;
+    }
+
+    return retVal;
+}
+
+
+int shwarm_headless_volume(int numRows, int numCols, int numDepth, int numPoints, int maxSweeps, int numThreads)
+{
+    // LOCAL VARIABLES
+    int retVal = 0;                    // Function's return value
+    bool success = true;               // Set this to false if anything fails
+    hsBox field;                       // Coordinates the swarm may occupy
+    hsVolume_ptr volume_ptr = NULL;    // Volume swarm
+    hsPool_ptr pool_ptr = NULL;        // Worker threads
+    long numMoves = 0;                 // Number of total moves made each 'cycle'
+    long totalMoves = 0;               // Number of moves made across all cycles
+    int numSweeps = 0;                 // Number of cycles made
+    int i = 0;                         // Iterating variable
+    struct timespec startTime;         // Wall time before swarming
+    struct timespec stopTime;          // Wall time after swarming
+
+    // SETUP THE FIELD
+    if (numRows < 3 || numCols < 3 || numDepth < 3)
+    {
+        HARKLE_ERROR(Shwarm_It, shwarm_headless_volume, Field dimensions are too small);
+        success = false;
+    }
+    else
+    {
+        field.xMin = 1;
+        field.xMax = numCols - 2;
+        field.yMin = 1;
+        field.yMax = numRows - 2;
+        field.zMin = 1;
+        field.zMax = numDepth - 2;
+    }
+
+    // SETUP SWARM
+    // 1. Scatter the swarm across the field
+    if (true == success)
+    {
+        volume_ptr = build_volume_swarm(&field, numPoints);
+
+        if (!volume_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless_volume, build_volume_swarm failed);
+            success = false;
+        }
+    }
+
+    // 2. Start the worker threads
+    if (true == success)
+    {
+        pool_ptr = build_worker_pool(numThreads);
+
+        if (!pool_ptr)
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless_volume, build_worker_pool failed);
+            success = false;
+        }
+    }
+
+    // START SWARMING
+    if (true == success)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+        while (true == success)
+        {
+            numMoves = shwarm_volume_sweep(volume_ptr, pool_ptr, HS_MAX_SWARM_MOVES, true);
+
+            if (0 > numMoves)
+            {
+                HARKLE_ERROR(Shwarm_It, shwarm_headless_volume, shwarm_volume_sweep failed);
+                success = false;
+            }
+            else
+            {
+                totalMoves += numMoves;
+                numSweeps++;
+            }
+
+            // Keep swarming until equilibrium is reached
+            if (0 == numMoves || numSweeps >= maxSweeps)
+            {
+                break;
+            }
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &stopTime);
+    }
+
+    // 3. Verify no two points collided
+    if (true == success && false == verify_volume_swarm(volume_ptr))
+    {
+        HARKLE_ERROR(Shwarm_It, shwarm_headless_volume, verify_volume_swarm failed);
+        success = false;
+    }
+
+    // REPORT
+    if (true == success)
+    {
+        if (numMoves)
+        {
+            fprintf(stderr, "Equilibrium was not reached within %d sweeps\n", maxSweeps);
+            success = false;
+        }
+        printf("Points:      %d\n", numPoints);
+        printf("Threads:     %d\n", pool_ptr->numThreads);
+        printf("Field:       %d x %d x %d\n", field.xMax - field.xMin + 1, field.yMax - field.yMin + 1,
+               field.zMax - field.zMin + 1);
+        printf("Iterations:  %d\n", numSweeps);
+        printf("Total moves: %ld\n", totalMoves);
+        printf("Wall time:   %.6f seconds\n", (stopTime.tv_sec - startTime.tv_sec)
+               + ((stopTime.tv_nsec - startTime.tv_nsec) / 1000000000.0));
+
+        for (i = 0; i < pool_ptr->numThreads; i++)
+        {
+            printf("Thread %3d:  %ld chunks (%ld stolen), %.6f seconds busy, %.6f seconds idle\n", i,
+                   pool_ptr->worker_arr[i].stats.numChunks, pool_ptr->worker_arr[i].stats.numSteals,
+                   pool_ptr->worker_arr[i].stats.busySecs, pool_ptr->worker_arr[i].stats.idleSecs);
+        }
+    }
+
+    // CLEAN UP
+    if (pool_ptr)
+    {
+        if (false == free_worker_pool(&pool_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless_volume, free_worker_pool failed);
+        }
+    }
+    if (volume_ptr)
+    {
+        if (false == free_volume_swarm(&volume_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, shwarm_headless_volume, free_volume_swarm failed);
+        }
+    }
+
+    // DONE
+    if (false == success)
+    {
+        retVal = -1;
+    }
+
+    return retVal;
+}
+
+
+int get_engine_dims(int engine)
+{
+    // LOCAL VARIABLES
+    int numDim = 1;  // Number of dimensions engine swarms in
+
+    if (HEADLESS_ENGINE_LIST2D == engine || HEADLESS_ENGINE_PLANE == engine || HEADLESS_ENGINE_BULK == engine)
+    {
+        numDim = 2;
+    }
+    else if (HEADLESS_ENGINE_VOLUME == engine)
+    {
+        numDim = 3;
+    }
+
+    // DONE
+    return numDim;
+}
+
+
+bool is_store_engine(int engine)
+{
+    return HEADLESS_ENGINE_LIST != engine && HEADLESS_ENGINE_LIST2D != engine && HEADLESS_ENGINE_VOLUME != engine;
+}
+
+
+bool write_headless_snapshot(char *snapFile, hsSwarm_ptr swarm_ptr, int numRows, int numCols, int engine,
+                             bool intercepts, int numSweeps, long totalMoves, unsigned int seed)
+{
+    // LOCAL VARIABLES
+    hsSnapHeader header;  // Describes the run
+
+    memset(&header, 0x0, sizeof(header));
+    header.numDims = 2;  // Every swarm store point has an x and a y, even on a line
+    header.numRows = numRows;
+    header.numCols = numCols;
+    header.engine = engine;
+    header.intercepts = true == intercepts ? 1 : 0;
+    header.numPnts = swarm_ptr->numPnts;
+    header.numSweeps = numSweeps;
+    header.totMoves = totalMoves;
+    header.rngSeed = seed;
+
+    // DONE
+    return write_swarm_snapshot(snapFile, &header, swarm_ptr->posNum, swarm_ptr->absX, swarm_ptr->absY, NULL,
+                                swarm_ptr->graphic);
+}
+
+
+int replay_trajectory(char *trajFile)
+{
+    // LOCAL VARIABLES
+    int retVal = 0;                        // Function's return value
+    bool success = true;                   // Set this to false if anything fails
+    hsTrajReader_ptr reader_ptr = NULL;    // Trajectory log being replayed
+    int numMoved = 0;                      // Number of points moved in one sweep
+    int maxMoved = 0;                      // Most points moved in one sweep
+    long logSize = 0;                      // Size of the trajectory log
+    struct timespec startTime;             // Wall time before replaying
+    struct timespec stopTime;              // Wall time after replaying
+
+    // REPLAY
+    reader_ptr = open_trajectory_reader(trajFile);
+
+    if (!reader_ptr)
+    {
+        HARKLE_ERROR(Shwarm_It, replay_trajectory, open_trajectory_reader failed);
+        success = false;
+    }
+    else
+    {
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+        while (0 <= (numMoved = replay_trajectory_sweep(reader_ptr)))
+        {
+            if (numMoved > maxMoved)
+            {
+                maxMoved = numMoved;
+            }
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &stopTime);
+        logSize = ftell(reader_ptr->inFile);
+
+        if (false == reader_ptr->atEnd)
+        {
+            HARKLE_ERROR(Shwarm_It, replay_trajectory, replay_trajectory_sweep failed);
+            success = false;
+        }
+    }
+
+    // REPORT
+    if (true == success)
+    {
+        printf("Trajectory:  %s, %ld bytes\n", trajFile, logSize);
+        printf("Points:      %d\n", reader_ptr->header.numPnts);
+        printf("Field:       %d x %d\n", reader_ptr->header.numCols - (2 * HS_OUTER_BORDER_WIDTH_H),
+               reader_ptr->header.numRows - (2 * HS_OUTER_BORDER_WIDTH_V));
+        printf("Sweeps:      %d through %ld\n", reader_ptr->header.firstSweep + 1,
+               reader_ptr->header.firstSweep + reader_ptr->numSweeps);
+        printf("Moved:       %ld points, at most %d in one sweep\n", reader_ptr->numEntries, maxMoved);
+        printf("Displacement: %lld\n", reader_ptr->displacement);
+        printf("Wall time:   %.6f seconds\n", (stopTime.tv_sec - startTime.tv_sec)
+               + ((stopTime.tv_nsec - startTime.tv_nsec) / 1000000000.0));
+    }
+
+    // CLEAN UP
+    if (reader_ptr)
+    {
+        if (false == close_trajectory_reader(&reader_ptr))
+        {
+            HARKLE_ERROR(Shwarm_It, replay_trajectory, close_trajectory_reader failed);
+        }
+    }
+
+    // DONE
+    if (false == success)
+    {
+        retVal = -1;
+    }
+
+    return retVal;
+}
+
+
+int parse_engine_arg(char *arg)
+{
+    // LOCAL VARIABLES
+    int engine = -1;  // HEADLESS_ENGINE_* value
+
+    // INPUT VALIDATION
+    if (arg)
+    {
+        if (0 == strcmp(arg, "list"))
+        {
+            engine = HEADLESS_ENGINE_LIST;
+        }
+        else if (0 == strcmp(arg, "line"))
+        {
+            engine = HEADLESS_ENGINE_LINE;
+        }
+        else if (0 == strcmp(arg, "solve"))
+        {
+            engine = HEADLESS_ENGINE_SOLVE;
+        }
+        else if (0 == strcmp(arg, "animate"))
+        {
+            engine = HEADLESS_ENGINE_ANIMATE;
+        }
+        else if (0 == strcmp(arg, "jacobi"))
+        {
+            engine = HEADLESS_ENGINE_JACOBI;
+        }
+        else if (0 == strcmp(arg, "list2d"))
+        {
+            engine = HEADLESS_ENGINE_LIST2D;
+        }
+        else if (0 == strcmp(arg, "plane"))
+        {
+            engine = HEADLESS_ENGINE_PLANE;
+        }
+        else if (0 == strcmp(arg, "volume"))
+        {
+            engine = HEADLESS_ENGINE_VOLUME;
+        }
+        else if (0 == strcmp(arg, "bulk"))
+        {
+            engine = HEADLESS_ENGINE_BULK;
+        }
+    }
+
+    // DONE
+    return engine;
+}
+
+
+bool parse_positive_arg(char *arg, int *outVal_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if arg is a positive number
+    int tmpVal = 0;        // Converted value
+
+    if (outVal_ptr && true == parse_non_negative_arg(arg, &tmpVal) && tmpVal > 0)
+    {
+        *outVal_ptr = tmpVal;
+        success = true;
+    }
+
+    // DONE
+    return success;
+}
+
+
+bool parse_non_negative_arg(char *arg, int *outVal_ptr)
+{
+    // LOCAL VARIABLES
+    bool success = false;  // Set this to true if arg is a non-negative number
+    char *end_ptr = NULL;  // End of the number strtol() found
+    long tmpVal = 0;       // Return value from strtol()
+
+    // INPUT VALIDATION
+    if (arg && *arg && outVal_ptr)
+    {
+        tmpVal = strtol(arg, &end_ptr, 10);
+
+        if (end_ptr && 0x0 == *end_ptr && tmpVal >= 0 && tmpVal <= 0x7FFFFFFF)
+        {
+            *outVal_ptr = (int)tmpVal;
+            success = true;
+        }
+    }
+
+    // DONE
+    return success;
+}
+
+
+void print_usage(char *progName)
+{
+    fprintf(stderr, "Usage: %s [-r|--frame-rate FPS | -H|--headless [-e|--engine ENGINE] [-j|--threads N] [-D|--depth N] [-T|--tolerance N] [-C|--convergence] [-s|--seed SEED] [-S|--snapshot FILE [-k|--snapshot-every N]] [-R|--resume FILE] [-t|--trajectory FILE] ROWS COLS [POINTS [MAX_SWEEPS]] | -P|--replay FILE | -h|--help]\n",
+            progName);
+    fprintf(stderr, "\tNo positional arguments: swarm in the terminal with ncurses\n");
+    fprintf(stderr, "\t-r, --frame-rate: ncurses only, number of times to redraw the swarm each second (default: %d)\n",
+            HS_RENDER_DEFAULT_FPS);
+    fprintf(stderr, "\t-H, --headless: swarm a ROWS x COLS field to equilibrium at full speed and report timing\n");
+    fprintf(stderr, "\t-e, --engine: headless swarm engine\n");
+    fprintf(stderr, "\t\tlist - shwarm_it() over the shawarma linked list (default)\n");
+    fprintf(stderr, "\t\tline - Sorted swarm store with O(1) neighbour lookup\n");
+    fprintf(stderr, "\t\tsolve - Closed-form equilibrium, no iteration\n");
+    fprintf(stderr, "\t\tanimate - Closed-form equilibrium, animated HS_MAX_SWARM_MOVES per sweep\n");
+    fprintf(stderr, "\t\tjacobi - Sorted swarm store, every point moved at once across a pool of threads\n");
+    fprintf(stderr, "\t\tlist2d - shwarm_it() over the shawarma linked list, scattered in two dimensions\n");
+    fprintf(stderr, "\t\tplane - Swarm store with a uniform grid neighbour index, scattered in two dimensions\n");
+    fprintf(stderr, "\t\tbulk - Swarm store with a uniform grid neighbour index, every point moved at once in two dimensions\n");
+    fprintf(stderr, "\t\tvolume - Volume swarm with a k-d tree neighbour index, scattered in three dimensions across a pool of threads\n");
+    fprintf(stderr, "\t-j, --threads: number of jacobi or volume engine threads (default: one per processor)\n");
+    fprintf(stderr, "\t-D, --depth: volume engine only, number of layers in the field (default: ROWS)\n");
+    fprintf(stderr, "\t-T, --tolerance: line engine only, stop once no point is more than N steps from equilibrium\n");
+    fprintf(stderr, "\t-C, --convergence: line engine only, print each sweep's moves and residuals\n");
+    fprintf(stderr, "\t-s, --seed: srand() seed to scatter the swarm with (default: %d)\n", HEADLESS_DEFAULT_SEED);
+    fprintf(stderr, "\t-S, --snapshot: swarm store engines only, write a snapshot of the swarm to FILE when it's done\n");
+    fprintf(stderr, "\t-k, --snapshot-every: also write the snapshot every N sweeps\n");
+    fprintf(stderr, "\t-R, --resume: swarm store engines only, resume the swarm (points, sweeps and moves) from a snapshot FILE\n");
+    fprintf(stderr, "\t-t, --trajectory: swarm store engines only, stream every sweep's moves to a trajectory log FILE\n");
+    fprintf(stderr, "\t-P, --replay: replay a trajectory log FILE and summarise the run it recorded\n");
+    fprintf(stderr, "\t-h, --help: print this usage and exit\n");
+
+    // DONE
+    return;
+}
+
+
 // void print_debug_info(winDetails_ptr stdWin, winDetails_ptr fieldWin, shawarma_ptr headNode_ptr)
 // {
 //     // LOCAL VARIABLES